@@ -16,8 +16,34 @@
   ******************************************************************************
   */
 
+/* the driver APIs are not wrapped by the instrumentation inside the driver */
+#define ST1VAFE6AX_INSTR_NO_WRAP
 #include "st1vafe6ax_reg.h"
 
+/*
+ * Vector kernels for the array conversion functions. They are used only if
+ * float_t is float (FLT_EVAL_METHOD == 0), so that results are the same as
+ * the scalar conversion functions. Define ST1VAFE6AX_NO_SIMD to disable.
+ */
+#include <float.h>
+
+#if !defined(ST1VAFE6AX_NO_SIMD) && defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0)
+#if defined(__AVX2__)
+#include <immintrin.h>
+#define ST1VAFE6AX_SIMD_AVX2
+#elif defined(__SSE2__)
+#include <emmintrin.h>
+#define ST1VAFE6AX_SIMD_SSE2
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#define ST1VAFE6AX_SIMD_NEON
+#endif /* __AVX2__ */
+#endif /* ST1VAFE6AX_NO_SIMD */
+
+#if defined(ST1VAFE6AX_INSTRUMENTATION)
+#include <stdio.h>
+#endif /* ST1VAFE6AX_INSTRUMENTATION */
+
 /**
   * @defgroup  ST1VAFE6AX
   * @brief     This file provides a set of functions needed to drive the
@@ -35,3873 +61,4715 @@
   *
   */
 
-/**
-  * @brief  Read generic device register
-  *
-  * @param  ctx   communication interface handler.(ptr)
-  * @param  reg   first register address to read.
-  * @param  data  buffer for data read.(ptr)
-  * @param  len   number of consecutive register to read.
-  * @retval       interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t __weak st1vafe6ax_read_reg(const stmdev_ctx_t *ctx, uint8_t reg,
-                                   uint8_t *data,
-                                   uint16_t len)
+#if defined(ST1VAFE6AX_INSTRUMENTATION)
+
+static st1vafe6ax_instr_t instr = { { { "(none)", 0U, 0U, 0U, 0U, 0U } }, 1U };
+static st1vafe6ax_instr_clock_t instr_clock;
+static uint16_t instr_cur;    /* entry of the API running, 0 -> none */
+static uint8_t instr_depth;
+static uint8_t instr_bank;    /* FUNC_CFG_ACCESS last written */
+
+static uint64_t instr_now(void)
 {
-  int32_t ret = 0;
+  return (instr_clock != NULL) ? instr_clock() : 0U;
+}
 
-  if (ctx == NULL)
+/*
+ * A bank switch is a FUNC_CFG_ACCESS write changing emb_func_reg_access;
+ * sw_por and CTRL3.sw_reset / boot bring back the main bank
+ */
+static void instr_account(uint8_t reg, const uint8_t *data, uint16_t len,
+                          uint8_t write, uint64_t ns)
+{
+  st1vafe6ax_instr_entry_t *e = &instr.entry[instr_cur];
+  uint8_t val;
+
+  e->xfers++;
+  e->bytes += len;
+  e->cb_ns += ns;
+  if ((write == 1U) && (reg <= ST1VAFE6AX_FUNC_CFG_ACCESS) &&
+      (((uint16_t)reg + len) > ST1VAFE6AX_FUNC_CFG_ACCESS))
   {
-    return -1;
+    val = data[ST1VAFE6AX_FUNC_CFG_ACCESS - reg];
+    if (((val ^ instr_bank) & 0x80U) != 0U)
+    {
+      e->bank_switch++;
+    }
+    instr_bank = ((val & 0x04U) != 0U) ? 0x00U : val;
   }
+  if ((write == 1U) && (reg <= ST1VAFE6AX_CTRL3) &&
+      (((uint16_t)reg + len) > ST1VAFE6AX_CTRL3) &&
+      ((data[ST1VAFE6AX_CTRL3 - reg] & 0x81U) != 0U))
+  {
+    instr_bank = 0x00U;
+  }
+}
+
+static int32_t instr_bus_read(const stmdev_ctx_t *ctx, uint8_t reg, uint8_t *data,
+                              uint16_t len)
+{
+  uint64_t t_ns = instr_now();
+  int32_t ret;
 
   ret = ctx->read_reg(ctx->handle, reg, data, len);
+  instr_account(reg, data, len, 0U, instr_now() - t_ns);
+
+  return ret;
+}
+
+static int32_t instr_bus_write(const stmdev_ctx_t *ctx, uint8_t reg,
+                               const uint8_t *data, uint16_t len)
+{
+  uint64_t t_ns = instr_now();
+  int32_t ret;
+
+  ret = ctx->write_reg(ctx->handle, reg, data, len);
+  instr_account(reg, data, len, 1U, instr_now() - t_ns);
+
+  return ret;
+}
+
+static int32_t instr_bus_submit(const stmdev_ctx_t *ctx, st1vafe6ax_xfer_submit_t submit,
+                                const st1vafe6ax_xfer_t *xfer)
+{
+  uint64_t t_ns = instr_now();
+  int32_t ret;
+
+  ret = submit(ctx->handle, xfer);
+  instr_account(xfer->reg, xfer->buf, xfer->len, xfer->dir, instr_now() - t_ns);
 
   return ret;
 }
 
+#define ST1VAFE6AX_BUS_READ(ctx, reg, data, len) \
+  instr_bus_read((ctx), (reg), (data), (len))
+#define ST1VAFE6AX_BUS_WRITE(ctx, reg, data, len) \
+  instr_bus_write((ctx), (reg), (data), (len))
+#define ST1VAFE6AX_BUS_SUBMIT(ctx, submit, xfer) \
+  instr_bus_submit((ctx), (submit), (xfer))
+
 /**
-  * @brief  Write generic device register
+  * @brief  Start of a public API call (used by the wrappers of
+  *         st1vafe6ax_reg.h): the transport calls up to the matching
+  *         st1vafe6ax_instr_leave() are accounted to name.
   *
-  * @param  ctx   communication interface handler.(ptr)
-  * @param  reg   first register address to write.
-  * @param  data  the buffer contains data to be written.(ptr)
-  * @param  len   number of consecutive register to write.
-  * @retval       interface status (MANDATORY: return 0 -> no Error)
+  * @param  name     API name
   *
   */
-int32_t __weak st1vafe6ax_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
-                                    uint8_t *data,
-                                    uint16_t len)
+void st1vafe6ax_instr_enter(const char *name)
 {
-  int32_t ret = 0;
+  uint16_t i;
 
-  if (ctx == NULL)
+  instr_depth++;
+  if (instr_depth != 1U)
   {
-    return -1;
+    /* nested call: accounted to the outer API */
+    return;
   }
 
-  ret = ctx->write_reg(ctx->handle, reg, data, len);
+  for (i = 1U; i < instr.num; i++)
+  {
+    if (strcmp(instr.entry[i].name, name) == 0)
+    {
+      break;
+    }
+  }
 
-  return ret;
+  if (i == instr.num)
+  {
+    if (instr.num == ST1VAFE6AX_INSTR_MAX)
+    {
+      /* table full */
+      i = 0U;
+    }
+    else
+    {
+      (void)memset(&instr.entry[i], 0, sizeof(st1vafe6ax_instr_entry_t));
+      instr.entry[i].name = name;
+      instr.num++;
+    }
+  }
+
+  instr.entry[i].calls++;
+  instr_cur = i;
 }
 
 /**
-  * @}
+  * @brief  End of a public API call.
   *
-  */
-
-/**
-  * @defgroup  Private functions
-  * @brief     Section collect all the utility functions needed by APIs.
-  * @{
+  * @param  ret      API result
+  * @retval          ret
   *
   */
-
-static void bytecpy(uint8_t *target, const uint8_t *source)
+int32_t st1vafe6ax_instr_leave(int32_t ret)
 {
-  if ((target != NULL) && (source != NULL))
+  if (instr_depth != 0U)
   {
-    *target = *source;
+    instr_depth--;
   }
+  if (instr_depth == 0U)
+  {
+    instr_cur = 0U;
+  }
+
+  return ret;
 }
 
 /**
-  * @}
+  * @brief  Time source of the callback time, NULL -> not measured.
+  *
+  * @param  clock    monotonic time in ns
   *
   */
+void st1vafe6ax_instr_clock_set(st1vafe6ax_instr_clock_t clock)
+{
+  instr_clock = clock;
+}
 
 /**
-  * @defgroup  Sensitivity
-  * @brief     These functions convert raw-data into engineering units.
-  * @{
+  * @brief  Copy of the counters.
+  *
+  * @param  val      counters, entry 0 collects the transport calls done
+  *                  outside the public APIs
   *
   */
-float_t st1vafe6ax_from_sflp_to_mg(int16_t lsb)
+void st1vafe6ax_instr_snapshot(st1vafe6ax_instr_t *val)
 {
-  return ((float_t)lsb) * 0.061f;
+  *val = instr;
 }
 
-float_t st1vafe6ax_from_fs2_to_mg(int16_t lsb)
+/**
+  * @brief  Clear the counters.
+  *
+  */
+void st1vafe6ax_instr_reset(void)
 {
-  return ((float_t)lsb) * 0.061f;
+  (void)memset(&instr, 0, sizeof(st1vafe6ax_instr_t));
+  instr.entry[0].name = "(none)";
+  instr.num = 1U;
+  instr_cur = 0U;
 }
 
-float_t st1vafe6ax_from_fs4_to_mg(int16_t lsb)
+/**
+  * @brief  Print the counters as a text table, one line per API.
+  *
+  * @param  val      counters (see st1vafe6ax_instr_snapshot())
+  * @param  buf      output, NUL terminated
+  * @param  size     output size
+  * @retval          length of the table, -1 -> truncated
+  *
+  */
+int32_t st1vafe6ax_instr_dump(const st1vafe6ax_instr_t *val, char *buf,
+                              uint32_t size)
 {
-  return ((float_t)lsb) * 0.122f;
-}
+  const st1vafe6ax_instr_entry_t *e;
+  uint32_t len;
+  int n;
+  uint16_t i;
 
-float_t st1vafe6ax_from_fs8_to_mg(int16_t lsb)
-{
-  return ((float_t)lsb) * 0.244f;
-}
+  n = snprintf(buf, size, "%-48s %8s %8s %8s %8s %12s\n", "api", "calls",
+               "xfers", "bytes", "bank_sw", "cb_ns");
 
-float_t st1vafe6ax_from_fs16_to_mg(int16_t lsb)
-{
-  return ((float_t)lsb) * 0.488f;
-}
+  for (i = 0U; (i < val->num) && (n >= 0) && ((uint32_t)n < size); i++)
+  {
+    e = &val->entry[i];
+    if ((i == 0U) && (e->xfers == 0U))
+    {
+      continue;
+    }
 
-float_t st1vafe6ax_from_fs125_to_mdps(int16_t lsb)
-{
-  return ((float_t)lsb) * 4.375f;
-}
+    len = (uint32_t)n;
+    n = snprintf(&buf[len], size - len, "%-48s %8lu %8lu %8lu %8lu %12llu\n",
+                 e->name, (unsigned long)e->calls, (unsigned long)e->xfers,
+                 (unsigned long)e->bytes, (unsigned long)e->bank_switch,
+                 (unsigned long long)e->cb_ns);
+    n = (n >= 0) ? (n + (int)len) : n;
+  }
 
-float_t st1vafe6ax_from_fs250_to_mdps(int16_t lsb)
-{
-  return ((float_t)lsb) * 8.750f;
-}
+  if ((n < 0) || ((uint32_t)n >= size))
+  {
+    return -1;
+  }
 
-float_t st1vafe6ax_from_fs500_to_mdps(int16_t lsb)
-{
-  return ((float_t)lsb) * 17.50f;
+  return (int32_t)n;
 }
 
-float_t st1vafe6ax_from_fs1000_to_mdps(int16_t lsb)
+#else
+
+#define ST1VAFE6AX_BUS_READ(ctx, reg, data, len) \
+  ((ctx)->read_reg((ctx)->handle, (reg), (data), (len)))
+#define ST1VAFE6AX_BUS_WRITE(ctx, reg, data, len) \
+  ((ctx)->write_reg((ctx)->handle, (reg), (data), (len)))
+#define ST1VAFE6AX_BUS_SUBMIT(ctx, submit, xfer) \
+  ((submit)((ctx)->handle, (xfer)))
+
+#endif /* ST1VAFE6AX_INSTRUMENTATION */
+
+/* Main bank registers kept in the register shadow (one bit per address). */
+static const uint8_t shadow_map[ST1VAFE6AX_SHADOW_SIZE / 8U] =
 {
-  return ((float_t)lsb) * 35.0f;
-}
+  0x8EU, /* 0x01 - 0x03, 0x07 */
+  0x7FU, /* 0x08 - 0x0E */
+  0xFFU, /* 0x10 - 0x17 */
+  0x03U, /* 0x18 - 0x19 */
+  0x00U, 0x00U, 0x00U, 0x00U, 0x00U, 0x00U,
+  0xF1U, /* 0x50, 0x54 - 0x57 */
+  0xFFU, /* 0x58 - 0x5F */
+  0x08U, /* 0x63 */
+  0x00U,
+  0x38U, /* 0x73 - 0x75 */
+  0x00U,
+};
 
-float_t st1vafe6ax_from_fs2000_to_mdps(int16_t lsb)
+static uint8_t shadow_bit(const uint8_t *map, uint8_t reg)
 {
-  return ((float_t)lsb) * 70.0f;
+  return (map[reg >> 3] >> (reg & 0x07U)) & 0x01U;
 }
 
-float_t st1vafe6ax_from_fs4000_to_mdps(int16_t lsb)
+static void shadow_bit_set(uint8_t *map, uint8_t reg)
 {
-  return ((float_t)lsb) * 140.0f;
+  map[reg >> 3] |= (uint8_t)(0x01U << (reg & 0x07U));
 }
 
-float_t st1vafe6ax_from_lsb_to_celsius(int16_t lsb)
+static void shadow_drop(st1vafe6ax_priv_t *priv)
 {
-  return (((float_t)lsb / 256.0f) + 25.0f);
+  (void)memset(priv->shadow_valid, 0x00, sizeof(priv->shadow_valid));
+  priv->route_valid = 0U;
 }
 
-uint64_t st1vafe6ax_from_lsb_to_nsec(uint32_t lsb)
+/* Register 'reg' of the currently selected bank may live in the shadow */
+static uint8_t shadow_is_main(const st1vafe6ax_priv_t *priv, uint8_t reg)
 {
-  return ((uint64_t)lsb * 21750u);
+  if (reg == ST1VAFE6AX_FUNC_CFG_ACCESS)
+  {
+    /* accessible from every bank */
+    return 1U;
+  }
+
+  if (priv->bank_depth != 0U)
+  {
+    return ((priv->bank_req & 0xF0U) == 0x00U) ? 1U : 0U;
+  }
+
+  if (shadow_bit(priv->shadow_valid, ST1VAFE6AX_FUNC_CFG_ACCESS) == 0U)
+  {
+    /* selected bank unknown */
+    return 0U;
+  }
+
+  return ((priv->shadow[ST1VAFE6AX_FUNC_CFG_ACCESS] & 0xF0U) == 0x00U) ? 1U : 0U;
 }
 
-float_t st1vafe6ax_from_lsb_to_mv(int16_t lsb)
+/* FUNC_CFG_ACCESS is always tracked, the other registers only if enabled */
+static uint8_t shadow_is_tracked(const st1vafe6ax_priv_t *priv, uint8_t reg)
 {
-  return ((float_t)lsb) / 78.0f;
-}
+  if (reg == ST1VAFE6AX_FUNC_CFG_ACCESS)
+  {
+    return 1U;
+  }
 
-/**
-  * @}
-  *
-  */
+  if ((reg >= ST1VAFE6AX_SHADOW_SIZE) || (priv->shadow_en == PROPERTY_DISABLE))
+  {
+    return 0U;
+  }
 
-/**
-  * @defgroup  Common
-  * @brief     This section groups common useful functions.
-  *
-  */
+  return shadow_bit(shadow_map, reg);
+}
 
-/**
-  * @brief  Reset of the device.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Reset of the device.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_reset_set(const stmdev_ctx_t *ctx, st1vafe6ax_reset_t val)
+/* Record the value of a register just written to / read from the device */
+static void shadow_store(st1vafe6ax_priv_t *priv, uint8_t reg, uint8_t val)
 {
-  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
-  st1vafe6ax_ctrl3_t ctrl3 = {0};
-  int32_t ret = 0;
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+  st1vafe6ax_reg_t reg_val;
 
-  if (ret != 0)
+  if (shadow_is_main(priv, reg) == 0U)
   {
-    return ret;
+    return;
   }
 
-  ctrl3.boot = (val == ST1VAFE6AX_RESTORE_CAL_PARAM) ? 1u : 0u;
-  ctrl3.sw_reset = (val == ST1VAFE6AX_RESTORE_CTRL_REGS) ? 1u : 0u;
-  func_cfg_access.sw_por = (val == ST1VAFE6AX_GLOBAL_RST) ? 1u : 0u;
+  /* checked even if the shadow is disabled: the tracked bank is reset too */
+  reg_val.byte = val;
+  if (((reg == ST1VAFE6AX_FUNC_CFG_ACCESS) && (reg_val.func_cfg_access.sw_por != 0U)) ||
+      ((reg == ST1VAFE6AX_CTRL3) &&
+       ((reg_val.ctrl3.boot != 0U) || (reg_val.ctrl3.sw_reset != 0U))))
+  {
+    /* device is rebooting: registers go back to their default value */
+    shadow_drop(priv);
+    return;
+  }
 
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
-  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+  if (shadow_is_tracked(priv, reg) == 0U)
+  {
+    return;
+  }
 
-  return ret;
+  priv->shadow[reg] = val;
+  shadow_bit_set(priv->shadow_valid, reg);
 }
 
-/**
-  * @brief  Global reset of the device.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Global reset of the device.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_reset_get(const stmdev_ctx_t *ctx, st1vafe6ax_reset_t *val)
+/* Multi-byte transfers address consecutive registers only if CTRL3.IF_INC */
+static uint8_t shadow_if_inc(const st1vafe6ax_priv_t *priv)
 {
-  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
-  st1vafe6ax_ctrl3_t ctrl3 = {0};
-  int32_t ret = 0;
+  st1vafe6ax_reg_t reg_val;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+  if (shadow_bit(priv->shadow_valid, ST1VAFE6AX_CTRL3) == 0U)
+  {
+    /* IF_INC is enabled by default and the driver relies on it */
+    return 1U;
+  }
 
-  if (ret != 0)
+  reg_val.byte = priv->shadow[ST1VAFE6AX_CTRL3];
+
+  return reg_val.ctrl3.if_inc;
+}
+
+static uint8_t shadow_lookup(const st1vafe6ax_priv_t *priv, uint8_t reg,
+                             uint8_t *data, uint16_t len)
+{
+  uint16_t i;
+
+  if ((len == 0U) || (((uint16_t)reg + len) > ST1VAFE6AX_SHADOW_SIZE) ||
+      (shadow_is_main(priv, reg) == 0U) ||
+      ((len > 1U) && (shadow_if_inc(priv) == 0U)))
   {
-    return ret;
+    return 0U;
   }
 
-  switch ((ctrl3.sw_reset << 2) + (ctrl3.boot << 1) + func_cfg_access.sw_por)
+  for (i = 0U; i < len; i++)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_READY;
-      break;
+    if ((shadow_is_tracked(priv, (uint8_t)(reg + i)) == 0U) ||
+        (shadow_bit(priv->shadow_valid, (uint8_t)(reg + i)) == 0U))
+    {
+      return 0U;
+    }
+  }
 
-    case 0x01:
-      *val = ST1VAFE6AX_GLOBAL_RST;
-      break;
+  (void)memcpy(data, &priv->shadow[reg], len);
 
-    case 0x02:
-      *val = ST1VAFE6AX_RESTORE_CAL_PARAM;
-      break;
+  return 1U;
+}
 
-    case 0x04:
-      *val = ST1VAFE6AX_RESTORE_CTRL_REGS;
-      break;
+static void shadow_update(st1vafe6ax_priv_t *priv, uint8_t reg,
+                          const uint8_t *data, uint16_t len)
+{
+  uint16_t i;
 
-    default:
-      *val = ST1VAFE6AX_GLOBAL_RST;
-      break;
+  if (len == 0U)
+  {
+    return;
   }
-  return ret;
-}
 
-/**
-  * @brief  Change memory bank.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      MAIN_MEM_BANK, EMBED_FUNC_MEM_BANK,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_mem_bank_set(const stmdev_ctx_t *ctx, st1vafe6ax_mem_bank_t val)
-{
-  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
-  int32_t ret = 0;
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
-  if (ret == 0)
+  if ((len > 1U) && (shadow_if_inc(priv) == 0U))
   {
-    func_cfg_access.emb_func_reg_access = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+    /* all bytes went to the same register, the last one is retained */
+    shadow_store(priv, reg, data[len - 1U]);
+    return;
   }
 
-  return ret;
+  for (i = 0U; (i < len) && (((uint16_t)reg + i) < ST1VAFE6AX_SHADOW_SIZE); i++)
+  {
+    shadow_store(priv, (uint8_t)(reg + i), data[i]);
+  }
 }
 
-/**
-  * @brief  Change memory bank.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      MAIN_MEM_BANK, SENSOR_HUB_MEM_BANK, EMBED_FUNC_MEM_BANK,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_mem_bank_get(const stmdev_ctx_t *ctx, st1vafe6ax_mem_bank_t *val)
+/*
+ * Interrupt route cache: dropped by a write to the embedded bank routes of
+ * a pin or to PAGE_VALUE (PEDO_CMD_REG), or if the selected bank is unknown
+ */
+static void route_cache_write(st1vafe6ax_priv_t *priv, uint8_t reg, uint16_t len)
 {
-  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
-  int32_t ret = 0;
+  uint16_t end = (uint16_t)reg + len;
+  uint8_t bank;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
-  if (ret != 0)
+  if (priv->cmd_list != NULL)
   {
-    return ret;
+    bank = priv->cmd_list->bank;
   }
-
-  switch (func_cfg_access.emb_func_reg_access)
+  else if (priv->bank_depth != 0U)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_MAIN_MEM_BANK;
-      break;
+    bank = priv->bank_req;
+  }
+  else if (shadow_bit(priv->shadow_valid, ST1VAFE6AX_FUNC_CFG_ACCESS) == 1U)
+  {
+    bank = priv->shadow[ST1VAFE6AX_FUNC_CFG_ACCESS];
+  }
+  else
+  {
+    bank = 0x80U;
+  }
 
-    case 0x01:
-      *val = ST1VAFE6AX_EMBED_FUNC_MEM_BANK;
-      break;
+  if ((bank & 0x80U) == 0x00U)
+  {
+    return;
+  }
 
-    default:
-      *val = ST1VAFE6AX_MAIN_MEM_BANK;
-      break;
+  if ((reg <= ST1VAFE6AX_PAGE_VALUE) && (end > ST1VAFE6AX_PAGE_VALUE))
+  {
+    priv->route_valid &= (uint8_t)~0x04U;
+  }
+  if ((reg <= ST1VAFE6AX_MLC_INT1) && (end > ST1VAFE6AX_EMB_FUNC_INT1))
+  {
+    priv->route_valid &= (uint8_t)~0x01U;
+  }
+  if ((reg <= ST1VAFE6AX_MLC_INT2) && (end > ST1VAFE6AX_EMB_FUNC_INT2))
+  {
+    priv->route_valid &= (uint8_t)~0x02U;
   }
-  return ret;
 }
 
-/**
-  * @brief  Device ID.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Device ID.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_device_id_get(const stmdev_ctx_t *ctx, uint8_t *val)
+/* Inside a bank session, select on the bus the bank requested last */
+static int32_t bank_sync(const stmdev_ctx_t *ctx, st1vafe6ax_priv_t *priv)
 {
-  st1vafe6ax_who_am_i_t who_am_i = {0};
+  uint8_t func_cfg_access = priv->bank_req;
   int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WHO_AM_I, (uint8_t *)&who_am_i, 1);
-  if (ret != 0)
+  if ((shadow_bit(priv->shadow_valid, ST1VAFE6AX_FUNC_CFG_ACCESS) == 0U) ||
+      (priv->shadow[ST1VAFE6AX_FUNC_CFG_ACCESS] != func_cfg_access))
   {
-    return ret;
+    ret = ST1VAFE6AX_BUS_WRITE(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &func_cfg_access, 1);
+    if (ret == 0)
+    {
+      priv->shadow[ST1VAFE6AX_FUNC_CFG_ACCESS] = func_cfg_access;
+      shadow_bit_set(priv->shadow_valid, ST1VAFE6AX_FUNC_CFG_ACCESS);
+    }
   }
 
-  *val = who_am_i.id;
-
   return ret;
 }
 
-/**
-  * @brief  Accelerometer output data rate (ODR) selection.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_xl_data_rate_t enum
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_xl_data_rate_set(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_xl_data_rate_t val)
+/* Command list: registers whose value can not be taken from the list */
+static uint8_t cmd_list_volatile(uint8_t bank, uint8_t reg)
 {
-  st1vafe6ax_ctrl1_t ctrl1 = {0};
-  int32_t ret;
+  if ((bank & 0xF0U) == 0x00U)
+  {
+    return 0U;
+  }
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
-  if (ret == 0)
+  if ((bank & 0xF0U) == 0x80U)
   {
-    ctrl1.odr_xl = (uint8_t)val & 0xFU;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
+    return ((reg == ST1VAFE6AX_PAGE_ADDRESS) || (reg == ST1VAFE6AX_PAGE_VALUE) ||
+            (reg == ST1VAFE6AX_EMB_FUNC_INIT_A) || (reg == ST1VAFE6AX_EMB_FUNC_INIT_B)) ?
+           1U : 0U;
   }
 
-  return ret;
+  /* other hidden banks */
+  return 1U;
 }
 
-/**
-  * @brief  Accelerometer output data rate (ODR) selection.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_xl_data_rate_t enum
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_xl_data_rate_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_xl_data_rate_t *val)
+/* Command list: registers whose writes have side effects, never merged */
+static uint8_t cmd_list_side_effect(uint8_t bank, uint8_t reg)
 {
-  st1vafe6ax_ctrl1_t ctrl1 = {0};
-  int32_t ret = 0;
+  if (reg == ST1VAFE6AX_FUNC_CFG_ACCESS)
+  {
+    return 1U;
+  }
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
-  if (ret != 0)
+  if ((bank & 0xF0U) == 0x00U)
   {
-    return ret;
+    return ((reg == ST1VAFE6AX_CTRL3) || (reg == ST1VAFE6AX_FIFO_CTRL4) ||
+            (reg == ST1VAFE6AX_FUNCTIONS_ENABLE)) ? 1U : 0U;
   }
 
-  switch (ctrl1.odr_xl)
+  if ((bank & 0xF0U) == 0x80U)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_XL_ODR_OFF;
-      break;
+    return ((reg == ST1VAFE6AX_PAGE_SEL) || (reg == ST1VAFE6AX_PAGE_ADDRESS) ||
+            (reg == ST1VAFE6AX_PAGE_VALUE) || (reg == ST1VAFE6AX_PAGE_RW) ||
+            (reg == ST1VAFE6AX_EMB_FUNC_INIT_A) || (reg == ST1VAFE6AX_EMB_FUNC_INIT_B)) ?
+           1U : 0U;
+  }
 
-    case 0x01:
-      *val = ST1VAFE6AX_XL_ODR_AT_1Hz875;
-      break;
+  /* other hidden banks */
+  return 1U;
+}
 
-    case 0x02:
-      *val = ST1VAFE6AX_XL_ODR_AT_7Hz5;
-      break;
+/* Command list: main bank control register, its device value can be read */
+static uint8_t cmd_list_config(uint8_t bank, uint8_t reg)
+{
+  if (((bank & 0xF0U) != 0x00U) || (reg >= ST1VAFE6AX_SHADOW_SIZE) ||
+      (reg == ST1VAFE6AX_FUNC_CFG_ACCESS))
+  {
+    return 0U;
+  }
 
-    case 0x03:
-      *val = ST1VAFE6AX_XL_ODR_AT_15Hz;
-      break;
+  return shadow_bit(shadow_map, reg);
+}
 
-    case 0x04:
-      *val = ST1VAFE6AX_XL_ODR_AT_30Hz;
-      break;
+/* Execute the recorded entries */
+static int32_t cmd_list_exec(const stmdev_ctx_t *ctx, st1vafe6ax_priv_t *priv)
+{
+  st1vafe6ax_cmd_list_t *list = priv->cmd_list;
+  uint16_t i = 0U;
+  int32_t ret = 0;
 
-    case 0x05:
-      *val = ST1VAFE6AX_XL_ODR_AT_60Hz;
-      break;
+  priv->cmd_list = NULL;
+  while ((ret == 0) && (i < list->used))
+  {
+    ret = st1vafe6ax_write_reg(ctx, list->buf[i + 1U], &list->buf[i + 3U], list->buf[i + 2U]);
+    i += (uint16_t)(3U + list->buf[i + 2U]);
+  }
+  priv->cmd_list = list;
 
-    case 0x06:
-      *val = ST1VAFE6AX_XL_ODR_AT_120Hz;
-      break;
+  if (list->used != 0U)
+  {
+    list->n_flush++;
+  }
+  list->used = 0U;
+  list->last = 0xFFFFU;
+  list->bus_bank = list->bank;
+  list->volatile_wr = 0U;
 
-    case 0x07:
-      *val = ST1VAFE6AX_XL_ODR_AT_240Hz;
-      break;
+  return ret;
+}
 
-    case 0x08:
-      *val = ST1VAFE6AX_XL_ODR_AT_480Hz;
-      break;
+/*
+ * Append a write to the list. It is merged with the last entry when the
+ * order of the bus writes is kept: either it continues the last entry, or
+ * it rewrites its final registers (none with side effects), so that only
+ * writes superseded right away are dropped.
+ */
+static int32_t cmd_list_append(const stmdev_ctx_t *ctx, st1vafe6ax_priv_t *priv,
+                               uint8_t reg, const uint8_t *data, uint16_t len)
+{
+  st1vafe6ax_cmd_list_t *list = priv->cmd_list;
+  uint8_t *last;
+  uint16_t i;
+  int32_t ret = 0;
 
-    case 0x09:
-      *val = ST1VAFE6AX_XL_ODR_AT_960Hz;
-      break;
+  if (list->last != 0xFFFFU)
+  {
+    last = &list->buf[list->last];
+    if ((last[0] == list->bank) && (last[1] != ST1VAFE6AX_FUNC_CFG_ACCESS) &&
+        (reg >= last[1]) && (((uint16_t)reg + len) == ((uint16_t)last[1] + last[2])) &&
+        ((len == 1U) || (list->no_inc == 0U)))
+    {
+      for (i = 0U; i < len; i++)
+      {
+        if (cmd_list_side_effect(list->bank, (uint8_t)(reg + i)) != 0U)
+        {
+          break;
+        }
+      }
+      if (i == len)
+      {
+        /* same final registers written again: the last value is enough */
+        (void)memcpy(&last[3U + reg - last[1]], data, len);
+        return ret;
+      }
+    }
 
-    case 0x0A:
-      *val = ST1VAFE6AX_XL_ODR_AT_1920Hz;
-      break;
+    if ((list->no_inc == 0U) && (last[0] == list->bank) &&
+        (last[1] != ST1VAFE6AX_FUNC_CFG_ACCESS) && (reg != ST1VAFE6AX_FUNC_CFG_ACCESS) &&
+        (((uint16_t)last[1] + last[2]) == reg) && (((uint16_t)last[2] + len) <= 0xFFU) &&
+        (((uint32_t)list->used + len) <= list->size))
+    {
+      (void)memcpy(&list->buf[list->used], data, len);
+      last[2] += (uint8_t)len;
+      list->used += len;
+      return ret;
+    }
+  }
 
-    case 0x0B:
-      *val = ST1VAFE6AX_XL_ODR_AT_3840Hz;
-      break;
+  if (((uint32_t)list->used + 3U + len) > list->size)
+  {
+    ret = cmd_list_exec(ctx, priv);
+    if ((ret == 0) && ((3U + (uint32_t)len) > list->size))
+    {
+      /* does not fit in the list at all */
+      priv->cmd_list = NULL;
+      ret = st1vafe6ax_write_reg(ctx, reg, (uint8_t *)data, len);
+      priv->cmd_list = list;
+      list->n_cmd++;
+      return ret;
+    }
+  }
 
-    default:
-      *val = ST1VAFE6AX_XL_ODR_OFF;
-      break;
+  if (ret == 0)
+  {
+    list->last = list->used;
+    list->buf[list->used] = list->bank;
+    list->buf[list->used + 1U] = reg;
+    list->buf[list->used + 2U] = (uint8_t)len;
+    (void)memcpy(&list->buf[list->used + 3U], data, len);
+    list->used += (uint16_t)(3U + len);
+    list->n_cmd++;
   }
+
   return ret;
 }
 
-/**
-  * @brief  Accelerometer operating mode selection.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_xl_mode_t struct
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_xl_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_xl_mode_t val)
+/* Value of a register after the writes recorded so far, if known */
+static uint8_t cmd_list_lookup(const st1vafe6ax_priv_t *priv, uint8_t reg,
+                               uint8_t *val)
 {
-  st1vafe6ax_ctrl1_t ctrl1 = {0};
-  int32_t ret = 0;
+  const st1vafe6ax_cmd_list_t *list = priv->cmd_list;
+  uint8_t found = 0U;
+  uint16_t i = 0U;
+  const uint8_t *entry;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
+  while (i < list->used)
+  {
+    entry = &list->buf[i];
+    if ((entry[0] == list->bank) && (reg >= entry[1]) &&
+        ((uint16_t)reg < ((uint16_t)entry[1] + entry[2])))
+    {
+      *val = entry[3U + reg - entry[1]];
+      found = 1U;
+    }
+    i += (uint16_t)(3U + entry[2]);
+  }
 
-  if (ret == 0)
+  if ((found == 0U) && (list->volatile_wr == 0U) && ((list->bank & 0xF0U) == 0x00U) &&
+      (shadow_is_tracked(priv, reg) == 1U) && (shadow_bit(priv->shadow_valid, reg) == 1U))
   {
-    ctrl1.op_mode_xl = (uint8_t)val & 0x07U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
+    *val = priv->shadow[reg];
+    found = 1U;
   }
 
-  return ret;
+  return found;
 }
 
-/**
-  * @brief  Accelerometer operating mode selection.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_xl_mode_t struct
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_xl_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_xl_mode_t *val)
-{
-  st1vafe6ax_ctrl1_t ctrl1 = {0};
+/*
+ * Read while recording: from the list when possible. Only main bank
+ * control registers not written by the list are read from the device as
+ * is; any other read (status, output, embedded functions registers) first
+ * executes the list recorded so far, as a direct execution would.
+ */
+static int32_t cmd_list_read(const stmdev_ctx_t *ctx, st1vafe6ax_priv_t *priv,
+                             uint8_t reg, uint8_t *data, uint16_t len)
+{
+  st1vafe6ax_cmd_list_t *list = priv->cmd_list;
+  uint8_t known[ST1VAFE6AX_SHADOW_SIZE / 8U] = {0};
+  uint8_t val;
+  uint8_t miss = 0U;
+  uint16_t i;
   int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
-  if (ret != 0)
+  if ((reg == ST1VAFE6AX_FUNC_CFG_ACCESS) && (len == 1U))
   {
+    *data = list->bank;
     return ret;
   }
 
-  switch (ctrl1.op_mode_xl)
+  if ((len > ST1VAFE6AX_SHADOW_SIZE) || ((len > 1U) && (list->no_inc != 0U)))
   {
-    case 0x00:
-      *val = ST1VAFE6AX_XL_HIGH_PERFORMANCE_MD;
-      break;
+    miss = 2U;
+  }
 
-    case 0x02:
-      *val = ST1VAFE6AX_XL_HIGH_PERFORMANCE_2_MD;
-      break;
+  for (i = 0U; (miss < 2U) && (i < len); i++)
+  {
+    if (cmd_list_volatile(list->bank, (uint8_t)(reg + i)) != 0U)
+    {
+      miss = 2U;
+    }
+    else if (cmd_list_lookup(priv, (uint8_t)(reg + i), &val) == 1U)
+    {
+      data[i] = val;
+      shadow_bit_set(known, (uint8_t)i);
+    }
+    else if (cmd_list_config(list->bank, (uint8_t)(reg + i)) == 1U)
+    {
+      miss = 1U;
+    }
+    else
+    {
+      miss = 2U;
+    }
+  }
 
-    case 0x04:
-      *val = ST1VAFE6AX_XL_LOW_POWER_2_AVG_MD;
-      break;
+  if (miss == 0U)
+  {
+    return ret;
+  }
 
-    case 0x05:
-      *val = ST1VAFE6AX_XL_LOW_POWER_4_AVG_MD;
-      break;
-
-    case 0x06:
-      *val = ST1VAFE6AX_XL_LOW_POWER_8_AVG_MD;
-      break;
+  if ((miss == 2U) || (list->volatile_wr != 0U) || (list->bank != list->bus_bank))
+  {
+    /* the device must first see the recorded writes */
+    ret = cmd_list_exec(ctx, priv);
+    if (ret == 0)
+    {
+      priv->cmd_list = NULL;
+      ret = st1vafe6ax_read_reg(ctx, reg, data, len);
+      priv->cmd_list = list;
+    }
+    return ret;
+  }
 
-    default:
-      *val = ST1VAFE6AX_XL_HIGH_PERFORMANCE_MD;
-      break;
+  /* control registers not written by the list: the device value is current */
+  priv->cmd_list = NULL;
+  ret = st1vafe6ax_read_reg(ctx, reg, data, len);
+  priv->cmd_list = list;
+  for (i = 0U; (ret == 0) && (i < len); i++)
+  {
+    if ((shadow_bit(known, (uint8_t)i) != 0U) &&
+        (cmd_list_lookup(priv, (uint8_t)(reg + i), &val) == 1U))
+    {
+      data[i] = val;
+    }
   }
+
   return ret;
 }
 
-/**
-  * @brief  Gyroscope output data rate (ODR) selection.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_gy_data_rate_t enum
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_gy_data_rate_set(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_gy_data_rate_t val)
+/* Write while recording, in the order of the calls */
+static int32_t cmd_list_write(const stmdev_ctx_t *ctx, st1vafe6ax_priv_t *priv,
+                              uint8_t reg, const uint8_t *data, uint16_t len)
 {
-  st1vafe6ax_ctrl2_t ctrl2 = {0};
+  st1vafe6ax_cmd_list_t *list = priv->cmd_list;
+  st1vafe6ax_reg_t reg_val;
+  uint16_t i;
   int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
+  list->n_write++;
+  if (len == 0U)
+  {
+    return ret;
+  }
 
-  if (ret == 0)
+  ret = cmd_list_append(ctx, priv, reg, data, len);
+
+  if ((reg == ST1VAFE6AX_FUNC_CFG_ACCESS) && (len == 1U))
   {
-    ctrl2.odr_g = (uint8_t)val & 0xFU;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
+    reg_val.byte = data[0];
+    list->bank = data[0];
+    if (reg_val.func_cfg_access.sw_por != 0U)
+    {
+      list->volatile_wr = 1U;
+      list->bank = 0x00U;
+    }
+    return ret;
+  }
+
+  for (i = 0U; i < len; i++)
+  {
+    if (cmd_list_volatile(list->bank, (uint8_t)(reg + i)) != 0U)
+    {
+      list->volatile_wr = 1U;
+    }
+  }
+
+  if (((list->bank & 0xF0U) == 0x00U) && (reg <= ST1VAFE6AX_CTRL3) &&
+      (((uint16_t)reg + len) > ST1VAFE6AX_CTRL3))
+  {
+    reg_val.byte = data[ST1VAFE6AX_CTRL3 - reg];
+    if ((reg_val.ctrl3.boot != 0U) || (reg_val.ctrl3.sw_reset != 0U))
+    {
+      list->volatile_wr = 1U;
+    }
+    list->no_inc = (reg_val.ctrl3.if_inc == 0U) ? 1U : 0U;
   }
 
   return ret;
 }
 
-/**
-  * @brief  Gyroscope output data rate (ODR) selection.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_gy_data_rate_t enum
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_gy_data_rate_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_gy_data_rate_t *val)
+/* Delay of the driver: a command list being recorded is executed first */
+static int32_t cmd_list_mdelay(const stmdev_ctx_t *ctx, uint32_t millisec)
 {
-  st1vafe6ax_ctrl2_t ctrl2 = {0};
+  st1vafe6ax_priv_t *priv = (st1vafe6ax_priv_t *)ctx->priv_data;
   int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
-  if (ret != 0)
+  if ((priv != NULL) && (priv->cmd_list != NULL))
   {
-    return ret;
+    ret = cmd_list_exec(ctx, priv);
   }
+  ctx->mdelay(millisec);
 
-  switch (ctrl2.odr_g)
+  return ret;
+}
+
+/* Read coalescing: groups of configuration registers read with one burst */
+static const uint8_t rd_group[][3] =
+{
+  /* bank (FUNC_CFG_ACCESS & 0xF0), first, last */
+  { 0x00U, ST1VAFE6AX_PIN_CTRL, ST1VAFE6AX_IF_CFG },
+  { 0x00U, ST1VAFE6AX_FIFO_CTRL1, ST1VAFE6AX_CTRL10 },
+  { 0x00U, ST1VAFE6AX_INTERNAL_FREQ, ST1VAFE6AX_FUNCTIONS_ENABLE },
+  { 0x00U, ST1VAFE6AX_INACTIVITY_DUR, ST1VAFE6AX_MD2_CFG },
+  { 0x00U, ST1VAFE6AX_Z_OFS_USR, ST1VAFE6AX_X_OFS_USR },
+  { 0x80U, ST1VAFE6AX_EMB_FUNC_EN_A, ST1VAFE6AX_EMB_FUNC_EN_B },
+  { 0x80U, ST1VAFE6AX_EMB_FUNC_INT1, ST1VAFE6AX_FSM_INT1 },
+  { 0x80U, ST1VAFE6AX_MLC_INT1, ST1VAFE6AX_FSM_INT2 },
+  { 0x80U, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, ST1VAFE6AX_FSM_ENABLE },
+  { 0x80U, ST1VAFE6AX_SFLP_ODR, ST1VAFE6AX_MLC_ODR },
+};
+
+/* Cache index of the selected bank: 0 main, 1 embedded, 0xFF other/unknown */
+static uint8_t rd_coalesce_bank(const st1vafe6ax_priv_t *priv)
+{
+  uint8_t func_cfg_access;
+
+  if (priv->bank_depth != 0U)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_GY_ODR_OFF;
-      break;
+    func_cfg_access = priv->bank_req;
+  }
+  else if (shadow_bit(priv->shadow_valid, ST1VAFE6AX_FUNC_CFG_ACCESS) != 0U)
+  {
+    func_cfg_access = priv->shadow[ST1VAFE6AX_FUNC_CFG_ACCESS];
+  }
+  else
+  {
+    return 0xFFU;
+  }
 
-    case 0x02:
-      *val = ST1VAFE6AX_GY_ODR_AT_7Hz5;
-      break;
+  if ((func_cfg_access & 0xF0U) == 0x00U)
+  {
+    return 0U;
+  }
 
-    case 0x03:
-      *val = ST1VAFE6AX_GY_ODR_AT_15Hz;
-      break;
+  return ((func_cfg_access & 0xF0U) == 0x80U) ? 1U : 0xFFU;
+}
 
-    case 0x04:
-      *val = ST1VAFE6AX_GY_ODR_AT_30Hz;
-      break;
+static void rd_coalesce_drop(st1vafe6ax_read_coalesce_t *rc)
+{
+  (void)memset(rc->valid, 0x00, sizeof(rc->valid));
+}
 
-    case 0x05:
-      *val = ST1VAFE6AX_GY_ODR_AT_60Hz;
-      break;
+/*
+ * Serve a read inside a register group, reading the whole group from the
+ * device the first time. Return 0 in *done if the read is not coalesced.
+ */
+static int32_t rd_coalesce_read(const stmdev_ctx_t *ctx, st1vafe6ax_priv_t *priv,
+                                uint8_t reg, uint8_t *data, uint16_t len,
+                                uint8_t *done)
+{
+  st1vafe6ax_read_coalesce_t *rc = priv->rd_coalesce;
+  uint8_t func_cfg_access;
+  uint8_t first;
+  uint8_t num;
+  uint8_t idx;
+  uint8_t g;
+  uint16_t i;
+  int32_t ret = 0;
 
-    case 0x06:
-      *val = ST1VAFE6AX_GY_ODR_AT_120Hz;
-      break;
+  *done = 0U;
 
-    case 0x07:
-      *val = ST1VAFE6AX_GY_ODR_AT_240Hz;
+  for (g = 0U; g < (sizeof(rd_group) / sizeof(rd_group[0])); g++)
+  {
+    if ((reg >= rd_group[g][1]) && (((uint16_t)reg + len) <= ((uint16_t)rd_group[g][2] + 1U)))
+    {
       break;
+    }
+  }
 
-    case 0x08:
-      *val = ST1VAFE6AX_GY_ODR_AT_480Hz;
-      break;
+  if ((len == 0U) || (g == (sizeof(rd_group) / sizeof(rd_group[0]))) ||
+      (shadow_if_inc(priv) == 0U))
+  {
+    return ret;
+  }
 
-    case 0x09:
-      *val = ST1VAFE6AX_GY_ODR_AT_960Hz;
-      break;
+  if (rd_coalesce_bank(priv) == 0xFFU)
+  {
+    /* learn the selected bank once */
+    ret = ST1VAFE6AX_BUS_READ(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &func_cfg_access, 1);
+    if (ret != 0)
+    {
+      return ret;
+    }
+    rc->n_bus++;
+    shadow_store(priv, ST1VAFE6AX_FUNC_CFG_ACCESS, func_cfg_access);
+  }
 
-    case 0x0A:
-      *val = ST1VAFE6AX_GY_ODR_AT_1920Hz;
-      break;
+  idx = rd_coalesce_bank(priv);
+  if ((idx == 0xFFU) || (rd_group[g][0] != ((idx == 0U) ? 0x00U : 0x80U)))
+  {
+    return ret;
+  }
 
-    case 0x0B:
-      *val = ST1VAFE6AX_GY_ODR_AT_3840Hz;
+  rc->n_read++;
+  for (i = 0U; i < len; i++)
+  {
+    if (shadow_bit(rc->valid[idx], (uint8_t)(reg + i)) == 0U)
+    {
       break;
+    }
+  }
 
-    default:
-      *val = ST1VAFE6AX_GY_ODR_OFF;
-      break;
+  if (i != len)
+  {
+    first = rd_group[g][1];
+    num = (uint8_t)(rd_group[g][2] - first + 1U);
+    ret = ST1VAFE6AX_BUS_READ(ctx, first, &rc->data[idx][first], num);
+    if (ret != 0)
+    {
+      return ret;
+    }
+    rc->n_bus++;
+    for (i = 0U; i < num; i++)
+    {
+      shadow_bit_set(rc->valid[idx], (uint8_t)(first + i));
+    }
+    if (idx == 0U)
+    {
+      shadow_update(priv, first, &rc->data[idx][first], num);
+    }
   }
+
+  (void)memcpy(data, &rc->data[idx][reg], len);
+  rc->n_saved = (rc->n_read > rc->n_bus) ? (uint16_t)(rc->n_read - rc->n_bus) : 0U;
+  *done = 1U;
+
   return ret;
 }
 
-/**
-  * @brief  Gyroscope operating mode selection.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      GY_HIGH_PERFORMANCE_MD, GY_HIGH_ACCURANCY_ODR_MD, GY_SLEEP_MD, GY_LOW_POWER_MD,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_gy_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_gy_mode_t val)
+/* Keep the coalesced registers up to date with the writes */
+static void rd_coalesce_write(st1vafe6ax_priv_t *priv, uint8_t reg,
+                              const uint8_t *data, uint16_t len)
 {
-  st1vafe6ax_ctrl2_t ctrl2 = {0};
-  int32_t ret = 0;
+  st1vafe6ax_read_coalesce_t *rc = priv->rd_coalesce;
+  st1vafe6ax_reg_t reg_val;
+  uint8_t idx;
+  uint16_t i;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
-  if (ret == 0)
+  if (len == 0U)
   {
-    ctrl2.op_mode_g = (uint8_t)val & 0x07U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
+    return;
   }
 
-  return ret;
+  idx = rd_coalesce_bank(priv);
+  if ((idx == 0xFFU) || ((len > 1U) && (shadow_if_inc(priv) == 0U)))
+  {
+    rd_coalesce_drop(rc);
+    return;
+  }
+
+  for (i = 0U; (i < len) && (((uint16_t)reg + i) < ST1VAFE6AX_SHADOW_SIZE); i++)
+  {
+    reg_val.byte = data[i];
+    if ((idx == 0U) &&
+        ((((reg + i) == ST1VAFE6AX_FUNC_CFG_ACCESS) && (reg_val.func_cfg_access.sw_por != 0U)) ||
+         (((reg + i) == ST1VAFE6AX_CTRL3) &&
+          ((reg_val.ctrl3.boot != 0U) || (reg_val.ctrl3.sw_reset != 0U)))))
+    {
+      rd_coalesce_drop(rc);
+      return;
+    }
+    rc->data[idx][reg + i] = data[i];
+  }
 }
 
 /**
-  * @brief  Gyroscope operating mode selection.[get]
+  * @brief  Read generic device register
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      GY_HIGH_PERFORMANCE_MD, GY_HIGH_ACCURANCY_ODR_MD, GY_SLEEP_MD, GY_LOW_POWER_MD,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  ctx   communication interface handler.(ptr)
+  * @param  reg   first register address to read.
+  * @param  data  buffer for data read.(ptr)
+  * @param  len   number of consecutive register to read.
+  * @retval       interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_gy_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_gy_mode_t *val)
+int32_t __weak st1vafe6ax_read_reg(const stmdev_ctx_t *ctx, uint8_t reg,
+                                   uint8_t *data,
+                                   uint16_t len)
 {
-  st1vafe6ax_ctrl2_t ctrl2 = {0};
+  st1vafe6ax_priv_t *priv;
+  uint8_t func_cfg_access;
+  uint8_t done = 0U;
   int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
-  if (ret != 0)
+  if (ctx == NULL)
+  {
+    return -1;
+  }
+
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if (priv == NULL)
   {
+    ret = ST1VAFE6AX_BUS_READ(ctx, reg, data, len);
     return ret;
   }
 
-  switch (ctrl2.op_mode_g)
+  if (priv->cmd_list != NULL)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_GY_HIGH_PERFORMANCE_MD;
-      break;
+    ret = cmd_list_read(ctx, priv, reg, data, len);
+    return ret;
+  }
 
-    case 0x04:
-      *val = ST1VAFE6AX_GY_SLEEP_MD;
-      break;
+  if ((priv->bank_depth != 0U) && (reg == ST1VAFE6AX_FUNC_CFG_ACCESS) && (len == 1U))
+  {
+    /* bank selection pending inside a bank session */
+    *data = priv->bank_req;
+    return 0;
+  }
 
-    case 0x05:
-      *val = ST1VAFE6AX_GY_LOW_POWER_MD;
-      break;
+  if (shadow_lookup(priv, reg, data, len) == 1U)
+  {
+    return 0;
+  }
 
-    default:
-      *val = ST1VAFE6AX_GY_HIGH_PERFORMANCE_MD;
-      break;
+  if (priv->bank_depth != 0U)
+  {
+    ret = bank_sync(ctx, priv);
+    if (ret != 0)
+    {
+      return ret;
+    }
   }
-  return ret;
-}
 
-/**
-  * @brief  Register address automatically incremented during a multiple byte access with a serial interface (enable by default).[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Register address automatically incremented during a multiple byte access with a serial interface (enable by default).
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_auto_increment_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  st1vafe6ax_ctrl3_t ctrl3 = {0};
-  int32_t ret = 0;
+  if ((priv->shadow_en != PROPERTY_DISABLE) && (reg != ST1VAFE6AX_FUNC_CFG_ACCESS) &&
+      (shadow_bit(priv->shadow_valid, ST1VAFE6AX_FUNC_CFG_ACCESS) == 0U))
+  {
+    /* learn the selected bank once, so that the shadow can be filled */
+    ret = ST1VAFE6AX_BUS_READ(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &func_cfg_access, 1);
+    if (ret != 0)
+    {
+      return ret;
+    }
+    shadow_store(priv, ST1VAFE6AX_FUNC_CFG_ACCESS, func_cfg_access);
+  }
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+  if (priv->rd_coalesce != NULL)
+  {
+    ret = rd_coalesce_read(ctx, priv, reg, data, len, &done);
+    if ((ret != 0) || (done == 1U))
+    {
+      return ret;
+    }
+  }
+
+  ret = ST1VAFE6AX_BUS_READ(ctx, reg, data, len);
   if (ret == 0)
   {
-    ctrl3.if_inc = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+    shadow_update(priv, reg, data, len);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Register address automatically incremented during a multiple byte access with a serial interface (enable by default).[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Register address automatically incremented during a multiple byte access with a serial interface (enable by default).
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @brief  Write generic device register
   *
-  */
-int32_t st1vafe6ax_auto_increment_get(const stmdev_ctx_t *ctx, uint8_t *val)
+  * @param  ctx   communication interface handler.(ptr)
+  * @param  reg   first register address to write.
+  * @param  data  the buffer contains data to be written.(ptr)
+  * @param  len   number of consecutive register to write.
+  * @retval       interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t __weak st1vafe6ax_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
+                                    uint8_t *data,
+                                    uint16_t len)
 {
-  st1vafe6ax_ctrl3_t ctrl3 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv;
+  st1vafe6ax_reg_t reg_val;
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
-  if (ret != 0)
+  if (ctx == NULL)
   {
+    return -1;
+  }
+
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if (priv == NULL)
+  {
+    ret = ST1VAFE6AX_BUS_WRITE(ctx, reg, data, len);
     return ret;
   }
 
-  *val = ctrl3.if_inc;
+  if (priv->route_valid != 0U)
+  {
+    route_cache_write(priv, reg, len);
+  }
 
+  if (priv->cmd_list != NULL)
+  {
+    ret = cmd_list_write(ctx, priv, reg, data, len);
+    return ret;
+  }
 
-  return ret;
-}
+  if ((priv->bank_depth != 0U) && ((reg != ST1VAFE6AX_FUNC_CFG_ACCESS) || (len != 1U)))
+  {
+    ret = bank_sync(ctx, priv);
+    if (ret != 0)
+    {
+      return ret;
+    }
+  }
 
-/**
-  * @brief  Block Data Update (BDU): output registers are not updated until LSB and MSB have been read). [set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Block Data Update (BDU): output registers are not updated until LSB and MSB have been read).
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_block_data_update_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  st1vafe6ax_ctrl3_t ctrl3 = {0};
-  int32_t ret = {0};
+  ret = ST1VAFE6AX_BUS_WRITE(ctx, reg, data, len);
+  if (ret != 0)
+  {
+    return ret;
+  }
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+  shadow_update(priv, reg, data, len);
 
-  if (ret == 0)
+  if (priv->rd_coalesce != NULL)
   {
-    ctrl3.bdu = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+    rd_coalesce_write(priv, reg, data, len);
+  }
+
+  if ((priv->bank_depth != 0U) && (reg == ST1VAFE6AX_FUNC_CFG_ACCESS) && (len != 0U))
+  {
+    /* a software power-on reset brings back the main bank */
+    reg_val.byte = data[0];
+    priv->bank_req = (reg_val.func_cfg_access.sw_por == 0U) ? data[0] : 0x00U;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Block Data Update (BDU): output registers are not updated until LSB and MSB have been read). [get]
+  * @brief  Register shadow enable.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Block Data Update (BDU): output registers are not updated until LSB and MSB have been read).
+  * @param  val      PROPERTY_ENABLE / PROPERTY_DISABLE. The shadow always
+  *                  starts empty and is filled by the following accesses.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_block_data_update_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_shadow_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_ctrl3_t ctrl3 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
-  if (ret != 0)
+  if ((ctx == NULL) || (ctx->priv_data == NULL))
   {
-    return ret;
+    return -1;
   }
 
-  *val = ctrl3.bdu;
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  shadow_drop(priv);
+  priv->shadow_en = (val != PROPERTY_DISABLE) ? PROPERTY_ENABLE : PROPERTY_DISABLE;
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Enables pulsed data-ready mode (~75 us).[set]
+  * @brief  Register shadow enable.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      DRDY_LATCHED, DRDY_PULSED,
+  * @param  val      PROPERTY_ENABLE / PROPERTY_DISABLE
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_data_ready_mode_set(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_data_ready_mode_t val)
+int32_t st1vafe6ax_shadow_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_ctrl4_t ctrl4 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
+  const st1vafe6ax_priv_t *priv;
 
-  if (ret == 0)
+  if (ctx == NULL)
   {
-    ctrl4.drdy_pulsed = (uint8_t)val & 0x1U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
+    return -1;
   }
 
-  return ret;
+  priv = (const st1vafe6ax_priv_t *)ctx->priv_data;
+  *val = ((priv != NULL) && (priv->shadow_en != PROPERTY_DISABLE)) ?
+         PROPERTY_ENABLE : PROPERTY_DISABLE;
+
+  return 0;
 }
 
 /**
-  * @brief  Enables pulsed data-ready mode (~75 us).[get]
+  * @brief  Drop the content of the register shadow, the next accesses will
+  *         be served by the device (e.g. after st1vafe6ax_reset_set()).
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      DRDY_LATCHED, DRDY_PULSED,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_data_ready_mode_get(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_data_ready_mode_t *val)
+int32_t st1vafe6ax_shadow_invalidate(const stmdev_ctx_t *ctx)
 {
-  st1vafe6ax_ctrl4_t ctrl4 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
-  if (ret != 0)
+  if (ctx == NULL)
   {
-    return ret;
+    return -1;
   }
 
-  switch (ctrl4.drdy_pulsed)
+  if (ctx->priv_data != NULL)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_DRDY_LATCHED;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_DRDY_PULSED;
-      break;
-
-    default:
-      *val = ST1VAFE6AX_DRDY_LATCHED;
-      break;
+    shadow_drop((st1vafe6ax_priv_t *)ctx->priv_data);
+    if (((st1vafe6ax_priv_t *)ctx->priv_data)->rd_coalesce != NULL)
+    {
+      rd_coalesce_drop(((st1vafe6ax_priv_t *)ctx->priv_data)->rd_coalesce);
+    }
   }
-  return ret;
+
+  return 0;
 }
 
 /**
-  * @brief  Gyroscope full-scale selection[set]
+  * @brief  Reload the whole register shadow from the device with a few
+  *         burst reads. Main memory bank must be selected.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      125dps, 250dps, 500dps, 1000dps, 2000dps, 4000dps,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_gy_full_scale_set(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_gy_full_scale_t val)
+int32_t st1vafe6ax_shadow_sync(const stmdev_ctx_t *ctx)
 {
-  st1vafe6ax_ctrl6_t ctrl6 = {0};
-  int32_t ret = {0};
+  static const uint8_t range[][2] =
+  {
+    { ST1VAFE6AX_FUNC_CFG_ACCESS, 3U },
+    { ST1VAFE6AX_FIFO_CTRL1, 8U },
+    { ST1VAFE6AX_CTRL1, 10U },
+    { ST1VAFE6AX_FUNCTIONS_ENABLE, 1U },
+    { ST1VAFE6AX_INACTIVITY_DUR, 12U },
+    { ST1VAFE6AX_EMB_FUNC_CFG, 1U },
+    { ST1VAFE6AX_Z_OFS_USR, 3U },
+  };
+  uint8_t buff[12];
+  uint8_t i;
+  int32_t ret;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
+  ret = st1vafe6ax_shadow_invalidate(ctx);
 
-  if (ret == 0)
+  for (i = 0U; (ret == 0) && (i < (sizeof(range) / sizeof(range[0]))); i++)
   {
-    ctrl6.fs_g = (uint8_t)val & 0xFU;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
+    ret = st1vafe6ax_read_reg(ctx, range[i][0], buff, range[i][1]);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Gyroscope full-scale selection[get]
+  * @brief  Start a read coalescing scope.
+  *         Until st1vafe6ax_read_coalesce_end(), a read of a configuration
+  *         register (control, interrupt routing, embedded function enable
+  *         registers) fetches with one burst the whole group of contiguous
+  *         configuration registers it belongs to, and the following reads
+  *         of the group are served without bus access. Status and output
+  *         registers are never coalesced. The device registers must not be
+  *         changed by others during the scope.
+  *         Requires stmdev_ctx_t.priv_data to point to st1vafe6ax_priv_t.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      125dps, 250dps, 500dps, 1000dps, 2000dps, 4000dps,
+  * @param  rc       scope storage and statistics (n_read, n_bus, n_saved)
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_gy_full_scale_get(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_gy_full_scale_t *val)
+int32_t st1vafe6ax_read_coalesce_begin(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_read_coalesce_t *rc)
 {
-  st1vafe6ax_ctrl6_t ctrl6 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
-  if (ret != 0)
+  if ((ctx == NULL) || (ctx->priv_data == NULL) || (rc == NULL))
   {
-    return ret;
+    return -1;
   }
 
-  switch (ctrl6.fs_g)
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if (priv->rd_coalesce != NULL)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_125dps;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_250dps;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_500dps;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_1000dps;
-      break;
-
-    case 0x04:
-      *val = ST1VAFE6AX_2000dps;
-      break;
+    return -1;
+  }
 
-    case 0x0C:
-      *val = ST1VAFE6AX_4000dps;
-      break;
+  (void)memset(rc, 0x00, sizeof(st1vafe6ax_read_coalesce_t));
+  priv->rd_coalesce = rc;
 
-    default:
-      *val = ST1VAFE6AX_125dps;
-      break;
-  }
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Accelerometer full-scale selection.[set]
+  * @brief  End the read coalescing scope, the statistics remain available
+  *         in the scope storage.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      2g, 4g, 8g, 16g,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_xl_full_scale_set(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_xl_full_scale_t val)
+int32_t st1vafe6ax_read_coalesce_end(const stmdev_ctx_t *ctx)
 {
-  st1vafe6ax_ctrl8_t ctrl8 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+  if ((ctx == NULL) || (ctx->priv_data == NULL))
+  {
+    return -1;
+  }
 
-  if (ret == 0)
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if (priv->rd_coalesce == NULL)
   {
-    ctrl8.fs_xl = (uint8_t)val & 0x3U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+    return -1;
   }
 
-  return ret;
+  priv->rd_coalesce = NULL;
+
+  return 0;
 }
 
 /**
-  * @brief  Accelerometer full-scale selection.[get]
+  * @brief  Start recording a command list.
+  *         Until st1vafe6ax_cmd_list_end(), register writes done by the APIs
+  *         are recorded in buf instead of being executed, in the order
+  *         they are made: writes to contiguous registers are merged in
+  *         multi-byte writes, and a write superseded right away by another
+  *         one is dropped, unless the register has side effects
+  *         (FUNC_CFG_ACCESS, CTRL3, FIFO_CTRL4, FUNCTIONS_ENABLE, PAGE_*,
+  *         EMB_FUNC_INIT_*).
+  *         Reads are served from the list and from the register shadow;
+  *         main bank control registers not written by the list are read
+  *         from the device. Any other read (e.g. STATUS_REG polling,
+  *         embedded functions registers) and any driver delay first execute
+  *         the list recorded so far, so the device sees the writes when a
+  *         direct execution would.
+  *         Requires stmdev_ctx_t.priv_data to point to st1vafe6ax_priv_t.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      2g, 4g, 8g, 16g,
+  * @param  list     command list
+  * @param  buf      storage for the recorded writes
+  * @param  size     size of buf
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_xl_full_scale_get(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_xl_full_scale_t *val)
+int32_t st1vafe6ax_cmd_list_begin(const stmdev_ctx_t *ctx,
+                                  st1vafe6ax_cmd_list_t *list,
+                                  uint8_t *buf, uint16_t size)
 {
-  st1vafe6ax_ctrl8_t ctrl8 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv;
+  uint8_t func_cfg_access = 0;
+  int32_t ret;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
-  if (ret != 0)
+  if ((ctx == NULL) || (ctx->priv_data == NULL) || (list == NULL) || (buf == NULL))
   {
-    return ret;
+    return -1;
   }
 
-  switch (ctrl8.fs_xl)
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if ((priv->cmd_list != NULL) || (priv->bank_depth != 0U) || (priv->async.busy != 0U))
   {
-    case 0x00:
-      *val = ST1VAFE6AX_2g;
-      break;
+    return -1;
+  }
 
-    case 0x01:
-      *val = ST1VAFE6AX_4g;
-      break;
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &func_cfg_access, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
 
-    case 0x02:
-      *val = ST1VAFE6AX_8g;
-      break;
+  (void)memset(list, 0x00, sizeof(st1vafe6ax_cmd_list_t));
+  list->buf = buf;
+  list->size = size;
+  list->last = 0xFFFFU;
+  list->bank = func_cfg_access;
+  list->bus_bank = func_cfg_access;
+  priv->cmd_list = list;
 
-    default:
-      *val = ST1VAFE6AX_2g;
-      break;
-  }
   return ret;
 }
 
 /**
-  * @brief  It enables the accelerometer Dual channel mode: data with selected full scale and data with maximum full scale are sent simultaneously to two different set of output registers.[set]
+  * @brief  Stop recording the command list.
+  *         The register shadow is not updated until the list is submitted.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      It enables the accelerometer Dual channel mode: data with selected full scale and data with maximum full scale are sent simultaneously to two different set of output registers.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_xl_dual_channel_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_cmd_list_end(const stmdev_ctx_t *ctx)
 {
-  st1vafe6ax_ctrl8_t ctrl8 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+  if ((ctx == NULL) || (ctx->priv_data == NULL))
+  {
+    return -1;
+  }
 
-  if (ret == 0)
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if (priv->cmd_list == NULL)
   {
-    ctrl8.xl_dualc_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+    return -1;
   }
 
-  return ret;
+  priv->cmd_list = NULL;
+
+  return 0;
 }
 
 /**
-  * @brief  It enables the accelerometer Dual channel mode: data with selected full scale and data with maximum full scale are sent simultaneously to two different set of output registers.[get]
+  * @brief  Execute a command list, one bus write per entry. A list can be
+  *         submitted more than once (e.g. device configuration restore) as
+  *         long as it was not executed before its end (n_flush == 0).
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      It enables the accelerometer Dual channel mode: data with selected full scale and data with maximum full scale are sent simultaneously to two different set of output registers.
+  * @param  list     command list, recording ended
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_xl_dual_channel_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_cmd_list_submit(const stmdev_ctx_t *ctx,
+                                   const st1vafe6ax_cmd_list_t *list)
 {
-  st1vafe6ax_ctrl8_t ctrl8 = {0};
-  int32_t ret = {0};
+  const st1vafe6ax_priv_t *priv;
+  uint16_t i = 0U;
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
-  if (ret != 0)
+  if ((ctx == NULL) || (list == NULL))
   {
-    return ret;
+    return -1;
   }
 
-  *val = ctrl8.xl_dualc_en;
+  priv = (const st1vafe6ax_priv_t *)ctx->priv_data;
+  if ((priv != NULL) && (priv->cmd_list != NULL))
+  {
+    return -1;
+  }
+
+  while ((ret == 0) && (i < list->used))
+  {
+    ret = st1vafe6ax_write_reg(ctx, list->buf[i + 1U], &list->buf[i + 3U], list->buf[i + 2U]);
+    i += (uint16_t)(3U + list->buf[i + 2U]);
+  }
 
   return ret;
 }
 
 /**
-  * @brief  Accelerometer self-test selection.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      XL_ST_DISABLE, XL_ST_POSITIVE, XL_ST_NEGATIVE,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @}
   *
   */
-int32_t st1vafe6ax_xl_self_test_set(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_xl_self_test_t val)
-{
-  st1vafe6ax_ctrl10_t ctrl10 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
 
-  if (ret == 0)
+/**
+  * @defgroup  Private functions
+  * @brief     Section collect all the utility functions needed by APIs.
+  * @{
+  *
+  */
+
+static void bytecpy(uint8_t *target, const uint8_t *source)
+{
+  if ((target != NULL) && (source != NULL))
   {
-    ctrl10.st_xl = (uint8_t)val & 0x3U;
-    ctrl10.xl_st_offset = ((uint8_t)val & 0x04U) >> 2;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+    *target = *source;
   }
-
-  return ret;
 }
 
 /**
-  * @brief  Accelerometer self-test selection.[get]
+  * @}
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      XL_ST_DISABLE, XL_ST_POSITIVE, XL_ST_NEGATIVE,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  */
+
+/**
+  * @defgroup  Sensitivity
+  * @brief     These functions convert raw-data into engineering units.
+  * @{
   *
   */
-int32_t st1vafe6ax_xl_self_test_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_xl_self_test_t *val)
+float_t st1vafe6ax_from_sflp_to_mg(int16_t lsb)
 {
-  st1vafe6ax_ctrl10_t ctrl10 = {0};
-  int32_t ret = {0};
+  return ((float_t)lsb) * 0.061f;
+}
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
+float_t st1vafe6ax_from_fs2_to_mg(int16_t lsb)
+{
+  return ((float_t)lsb) * 0.061f;
+}
 
-  //switch (ctrl10.xl_st_offset)
-  switch (ctrl10.st_xl)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_XL_ST_DISABLE;
-      break;
+float_t st1vafe6ax_from_fs4_to_mg(int16_t lsb)
+{
+  return ((float_t)lsb) * 0.122f;
+}
 
-    case 0x01:
-      *val = ctrl10.xl_st_offset == 0u ? ST1VAFE6AX_XL_ST_POSITIVE : ST1VAFE6AX_XL_ST_OFFSET_POS;
-      break;
+float_t st1vafe6ax_from_fs8_to_mg(int16_t lsb)
+{
+  return ((float_t)lsb) * 0.244f;
+}
 
-    case 0x02:
-      *val = ctrl10.xl_st_offset == 0u ? ST1VAFE6AX_XL_ST_NEGATIVE : ST1VAFE6AX_XL_ST_OFFSET_NEG;
-      break;
+float_t st1vafe6ax_from_fs16_to_mg(int16_t lsb)
+{
+  return ((float_t)lsb) * 0.488f;
+}
 
-    default:
-      *val = ST1VAFE6AX_XL_ST_DISABLE;
-      break;
+float_t st1vafe6ax_from_fs125_to_mdps(int16_t lsb)
+{
+  return ((float_t)lsb) * 4.375f;
+}
+
+float_t st1vafe6ax_from_fs250_to_mdps(int16_t lsb)
+{
+  return ((float_t)lsb) * 8.750f;
+}
+
+float_t st1vafe6ax_from_fs500_to_mdps(int16_t lsb)
+{
+  return ((float_t)lsb) * 17.50f;
+}
+
+float_t st1vafe6ax_from_fs1000_to_mdps(int16_t lsb)
+{
+  return ((float_t)lsb) * 35.0f;
+}
+
+float_t st1vafe6ax_from_fs2000_to_mdps(int16_t lsb)
+{
+  return ((float_t)lsb) * 70.0f;
+}
+
+float_t st1vafe6ax_from_fs4000_to_mdps(int16_t lsb)
+{
+  return ((float_t)lsb) * 140.0f;
+}
+
+float_t st1vafe6ax_from_lsb_to_celsius(int16_t lsb)
+{
+  return (((float_t)lsb / 256.0f) + 25.0f);
+}
+
+uint64_t st1vafe6ax_from_lsb_to_nsec(uint32_t lsb)
+{
+  return ((uint64_t)lsb * 21750u);
+}
+
+float_t st1vafe6ax_from_lsb_to_mv(int16_t lsb)
+{
+  return ((float_t)lsb) / 78.0f;
+}
+
+/* out[i] = ((lsb[i] * mul) + add) / div, div is skipped if 1 */
+static void lsb_to_float_array(const int16_t *lsb, float_t *out, uint32_t num,
+                               float_t mul, float_t add, float_t div)
+{
+  uint32_t i = 0U;
+
+#if defined(ST1VAFE6AX_SIMD_AVX2)
+  const __m256 vmul = _mm256_set1_ps(mul);
+  const __m256 vadd = _mm256_set1_ps(add);
+  const __m256 vdiv = _mm256_set1_ps(div);
+  __m256 v;
+
+  for (; (i + 8U) <= num; i += 8U)
+  {
+    v = _mm256_cvtepi32_ps(_mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *)&lsb[i])));
+    v = _mm256_add_ps(_mm256_mul_ps(v, vmul), vadd);
+    if (div != 1.0f)
+    {
+      v = _mm256_div_ps(v, vdiv);
+    }
+    _mm256_storeu_ps(&out[i], v);
+  }
+#elif defined(ST1VAFE6AX_SIMD_SSE2)
+  const __m128 vmul = _mm_set1_ps(mul);
+  const __m128 vadd = _mm_set1_ps(add);
+  const __m128 vdiv = _mm_set1_ps(div);
+  __m128i raw;
+  __m128 lo;
+  __m128 hi;
+
+  for (; (i + 8U) <= num; i += 8U)
+  {
+    raw = _mm_loadu_si128((const __m128i *)&lsb[i]);
+    lo = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(raw, raw), 16));
+    hi = _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpackhi_epi16(raw, raw), 16));
+    lo = _mm_add_ps(_mm_mul_ps(lo, vmul), vadd);
+    hi = _mm_add_ps(_mm_mul_ps(hi, vmul), vadd);
+    if (div != 1.0f)
+    {
+      lo = _mm_div_ps(lo, vdiv);
+      hi = _mm_div_ps(hi, vdiv);
+    }
+    _mm_storeu_ps(&out[i], lo);
+    _mm_storeu_ps(&out[i + 4U], hi);
+  }
+#elif defined(ST1VAFE6AX_SIMD_NEON)
+  const float32x4_t vmul = vdupq_n_f32(mul);
+  const float32x4_t vadd = vdupq_n_f32(add);
+  const float32x4_t vdiv = vdupq_n_f32(div);
+  int16x8_t raw;
+  float32x4_t lo;
+  float32x4_t hi;
+
+  for (; (i + 8U) <= num; i += 8U)
+  {
+    raw = vld1q_s16(&lsb[i]);
+    lo = vcvtq_f32_s32(vmovl_s16(vget_low_s16(raw)));
+    hi = vcvtq_f32_s32(vmovl_s16(vget_high_s16(raw)));
+    /* separate multiply and add: no fused rounding */
+    lo = vaddq_f32(vmulq_f32(lo, vmul), vadd);
+    hi = vaddq_f32(vmulq_f32(hi, vmul), vadd);
+    if (div != 1.0f)
+    {
+      lo = vdivq_f32(lo, vdiv);
+      hi = vdivq_f32(hi, vdiv);
+    }
+    vst1q_f32(&out[i], lo);
+    vst1q_f32(&out[i + 4U], hi);
+  }
+#endif /* ST1VAFE6AX_SIMD_AVX2 */
+
+  for (; i < num; i++)
+  {
+    out[i] = ((float_t)lsb[i] * mul) + add;
+    if (div != 1.0f)
+    {
+      out[i] = out[i] / div;
+    }
   }
-  return ret;
 }
 
 /**
-  * @brief  Gyroscope self-test selection.[set]
+  * @brief  Convert an array of accelerometer samples in mg.
+  *         Same results as st1vafe6ax_from_fs2_to_mg() ... _fs8_to_mg().
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      XL_ST_DISABLE, XL_ST_POSITIVE, XL_ST_NEGATIVE,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  fs       accelerometer full scale
+  * @param  lsb      raw samples
+  * @param  mg       converted samples [mg]
+  * @param  num      number of samples
+  * @retval          0 -> no Error, -1 -> invalid full scale
   *
   */
-int32_t st1vafe6ax_gy_self_test_set(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_gy_self_test_t val)
+int32_t st1vafe6ax_from_xl_lsb_to_mg_array(st1vafe6ax_xl_full_scale_t fs,
+                                           const int16_t *lsb, float_t *mg,
+                                           uint32_t num)
 {
-  st1vafe6ax_ctrl10_t ctrl10 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+  float_t sens;
 
-  if (ret == 0)
+  switch (fs)
   {
-    ctrl10.st_g = (uint8_t)val & 0x3U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+    case ST1VAFE6AX_2g:
+      sens = 0.061f;
+      break;
+
+    case ST1VAFE6AX_4g:
+      sens = 0.122f;
+      break;
+
+    case ST1VAFE6AX_8g:
+      sens = 0.244f;
+      break;
+
+    default:
+      return -1;
   }
 
-  return ret;
+  lsb_to_float_array(lsb, mg, num, sens, 0.0f, 1.0f);
+
+  return 0;
 }
 
 /**
-  * @brief  Gyroscope self-test selection.[get]
+  * @brief  Convert an array of gyroscope samples in mdps.
+  *         Same results as st1vafe6ax_from_fs125_to_mdps() ...
+  *         _fs4000_to_mdps().
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      XL_ST_DISABLE, XL_ST_POSITIVE, XL_ST_NEGATIVE,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  fs       gyroscope full scale
+  * @param  lsb      raw samples
+  * @param  mdps     converted samples [mdps]
+  * @param  num      number of samples
+  * @retval          0 -> no Error, -1 -> invalid full scale
   *
   */
-int32_t st1vafe6ax_gy_self_test_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_gy_self_test_t *val)
+int32_t st1vafe6ax_from_gy_lsb_to_mdps_array(st1vafe6ax_gy_full_scale_t fs,
+                                             const int16_t *lsb, float_t *mdps,
+                                             uint32_t num)
 {
-  st1vafe6ax_ctrl10_t ctrl10 = {0};
-  int32_t ret = {0};
+  float_t sens;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
-  if (ret != 0)
+  switch (fs)
   {
-    return ret;
-  }
+    case ST1VAFE6AX_125dps:
+      sens = 4.375f;
+      break;
 
-  switch (ctrl10.st_g)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_GY_ST_DISABLE;
+    case ST1VAFE6AX_250dps:
+      sens = 8.750f;
       break;
 
-    case 0x01:
-      *val = ST1VAFE6AX_GY_ST_POSITIVE;
+    case ST1VAFE6AX_500dps:
+      sens = 17.50f;
       break;
 
-    case 0x02:
-      *val = ST1VAFE6AX_GY_ST_NEGATIVE;
+    case ST1VAFE6AX_1000dps:
+      sens = 35.0f;
       break;
 
-    default:
-      *val = ST1VAFE6AX_GY_ST_DISABLE;
+    case ST1VAFE6AX_2000dps:
+      sens = 70.0f;
       break;
+
+    case ST1VAFE6AX_4000dps:
+      sens = 140.0f;
+      break;
+
+    default:
+      return -1;
   }
-  return ret;
+
+  lsb_to_float_array(lsb, mdps, num, sens, 0.0f, 1.0f);
+
+  return 0;
 }
 
 /**
-  * @brief  Get the status of all the interrupt sources.[get]
+  * @brief  Convert an array of temperature samples in Celsius degrees.
+  *         Same results as st1vafe6ax_from_lsb_to_celsius().
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Get the status of all the interrupt sources.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  lsb      raw samples
+  * @param  celsius  converted samples [degC]
+  * @param  num      number of samples
   *
   */
-int32_t st1vafe6ax_all_sources_get(const stmdev_ctx_t *ctx,
-                                   st1vafe6ax_all_sources_t *val)
+void st1vafe6ax_from_lsb_to_celsius_array(const int16_t *lsb, float_t *celsius,
+                                          uint32_t num)
 {
-  st1vafe6ax_emb_func_status_mainpage_t emb_func_status_mainpage = {0};
-  st1vafe6ax_emb_func_exec_status_t emb_func_exec_status = {0};
-  st1vafe6ax_fsm_status_mainpage_t fsm_status_mainpage = {0};
-  st1vafe6ax_mlc_status_mainpage_t mlc_status_mainpage = {0};
-  st1vafe6ax_functions_enable_t functions_enable = {0};
-  st1vafe6ax_emb_func_src_t emb_func_src = {0};
-  st1vafe6ax_fifo_status2_t fifo_status2 = {0};
-  st1vafe6ax_all_int_src_t all_int_src = {0};
-  st1vafe6ax_wake_up_src_t wake_up_src = {0};
-  st1vafe6ax_status_reg_t status_reg = {0};
-  st1vafe6ax_d6d_src_t d6d_src = {0};
-  st1vafe6ax_tap_src_t tap_src = {0};
-  uint8_t buff[7] = {0};
-  int32_t ret = 0;
+  /* division by 256 is exact, as the multiplication by 1/256 */
+  lsb_to_float_array(lsb, celsius, num, 1.0f / 256.0f, 25.0f, 1.0f);
+}
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
-  if (ret == 0)
-  {
-    functions_enable.dis_rst_lir_all_int = PROPERTY_ENABLE;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
-  }
+/**
+  * @brief  Convert an array of AH / vAFE samples in mV.
+  *         Same results as st1vafe6ax_from_lsb_to_mv().
+  *
+  * @param  lsb      raw samples
+  * @param  mv       converted samples [mV]
+  * @param  num      number of samples
+  *
+  */
+void st1vafe6ax_from_lsb_to_mv_array(const int16_t *lsb, float_t *mv, uint32_t num)
+{
+  lsb_to_float_array(lsb, mv, num, 1.0f, 0.0f, 78.0f);
+}
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_STATUS1, (uint8_t *)&buff, 4);
-  }
+/*
+ * Integer conversions, for targets without FPU. Accelerometer and gyroscope
+ * results are exact (nominal sensitivity), temperature and AH / vAFE results
+ * are rounded to the nearest integer (ties away from zero).
+ */
 
-  if (ret != 0)
-  {
-    return ret;
-  }
+/* num / den rounded to nearest, ties away from zero, den > 0 */
+static int32_t div_round(int32_t num, int32_t den)
+{
+  return (num >= 0) ? ((num + (den / 2)) / den) : -(((-num) + (den / 2)) / den);
+}
 
-  bytecpy((uint8_t *)&fifo_status2, &buff[1]);
-  bytecpy((uint8_t *)&all_int_src, &buff[2]);
-  bytecpy((uint8_t *)&status_reg, &buff[3]);
+int32_t st1vafe6ax_from_sflp_to_ug(int16_t lsb)
+{
+  return (int32_t)lsb * 61;
+}
 
-  val->fifo_ovr = fifo_status2.fifo_ovr_ia;
-  val->fifo_bdr = fifo_status2.counter_bdr_ia;
-  val->fifo_full = fifo_status2.fifo_full_ia;
-  val->fifo_th = fifo_status2.fifo_wtm_ia;
+int32_t st1vafe6ax_from_fs2_to_ug(int16_t lsb)
+{
+  return (int32_t)lsb * 61;
+}
 
-  val->free_fall = all_int_src.ff_ia;
-  val->wake_up = all_int_src.wu_ia;
-  val->six_d = all_int_src.d6d_ia;
+int32_t st1vafe6ax_from_fs4_to_ug(int16_t lsb)
+{
+  return (int32_t)lsb * 122;
+}
 
-  val->drdy_xl = status_reg.xlda;
-  val->drdy_gy = status_reg.gda;
-  val->drdy_temp = status_reg.tda;
-  val->drdy_ah_bio = status_reg.ah_bioda;
-  val->timestamp = status_reg.timestamp_endcount;
+int32_t st1vafe6ax_from_fs8_to_ug(int16_t lsb)
+{
+  return (int32_t)lsb * 244;
+}
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-  functions_enable.dis_rst_lir_all_int = PROPERTY_DISABLE;
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
+int32_t st1vafe6ax_from_fs16_to_ug(int16_t lsb)
+{
+  return (int32_t)lsb * 488;
+}
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_SRC, (uint8_t *)&buff, 7);
-  if (ret != 0)
-  {
-    return ret;
-  }
+int64_t st1vafe6ax_from_fs125_to_udps(int16_t lsb)
+{
+  return (int64_t)lsb * 4375;
+}
 
-  bytecpy((uint8_t *)&wake_up_src, &buff[0]);
-  bytecpy((uint8_t *)&tap_src, &buff[1]);
-  bytecpy((uint8_t *)&d6d_src, &buff[2]);
-  bytecpy((uint8_t *)&emb_func_status_mainpage, &buff[4]);
-  bytecpy((uint8_t *)&fsm_status_mainpage, &buff[5]);
-  bytecpy((uint8_t *)&mlc_status_mainpage, &buff[6]);
+int64_t st1vafe6ax_from_fs250_to_udps(int16_t lsb)
+{
+  return (int64_t)lsb * 8750;
+}
 
-  val->sleep_change = wake_up_src.sleep_change_ia;
-  val->wake_up_x = wake_up_src.x_wu;
-  val->wake_up_y = wake_up_src.y_wu;
-  val->wake_up_z = wake_up_src.z_wu;
-  val->sleep_state = wake_up_src.sleep_state;
+int64_t st1vafe6ax_from_fs500_to_udps(int16_t lsb)
+{
+  return (int64_t)lsb * 17500;
+}
 
-  val->tap_x = tap_src.x_tap;
-  val->tap_y = tap_src.y_tap;
-  val->tap_z = tap_src.z_tap;
-  val->tap_sign = tap_src.tap_sign;
-  val->double_tap = tap_src.double_tap;
-  val->single_tap = tap_src.single_tap;
+int64_t st1vafe6ax_from_fs1000_to_udps(int16_t lsb)
+{
+  return (int64_t)lsb * 35000;
+}
 
-  val->six_d_zl = d6d_src.zl;
-  val->six_d_zh = d6d_src.zh;
-  val->six_d_yl = d6d_src.yl;
-  val->six_d_yh = d6d_src.yh;
-  val->six_d_xl = d6d_src.xl;
-  val->six_d_xh = d6d_src.xh;
+int64_t st1vafe6ax_from_fs2000_to_udps(int16_t lsb)
+{
+  return (int64_t)lsb * 70000;
+}
 
-  val->step_detector = emb_func_status_mainpage.is_step_det;
-  val->tilt = emb_func_status_mainpage.is_tilt;
-  val->sig_mot = emb_func_status_mainpage.is_sigmot;
-  val->fsm_lc = emb_func_status_mainpage.is_fsm_lc;
+int64_t st1vafe6ax_from_fs4000_to_udps(int16_t lsb)
+{
+  return (int64_t)lsb * 140000;
+}
 
-  val->fsm1 = fsm_status_mainpage.is_fsm1;
-  val->fsm2 = fsm_status_mainpage.is_fsm2;
-  val->fsm3 = fsm_status_mainpage.is_fsm3;
-  val->fsm4 = fsm_status_mainpage.is_fsm4;
-  val->fsm5 = fsm_status_mainpage.is_fsm5;
-  val->fsm6 = fsm_status_mainpage.is_fsm6;
-  val->fsm7 = fsm_status_mainpage.is_fsm7;
-  val->fsm8 = fsm_status_mainpage.is_fsm8;
+int32_t st1vafe6ax_from_lsb_to_mdegc(int16_t lsb)
+{
+  /* lsb * 1000 / 256 */
+  return div_round((int32_t)lsb * 125, 32) + 25000;
+}
 
-  val->mlc1 = mlc_status_mainpage.is_mlc1;
-  val->mlc2 = mlc_status_mainpage.is_mlc2;
-  val->mlc3 = mlc_status_mainpage.is_mlc3;
-  val->mlc4 = mlc_status_mainpage.is_mlc4;
+int32_t st1vafe6ax_from_lsb_to_uv(int16_t lsb)
+{
+  /* lsb * 1000 / 78 */
+  return div_round((int32_t)lsb * 500, 39);
+}
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+uint64_t st1vafe6ax_from_lsb_to_nsec_cal(uint64_t lsb, int8_t freq_fine)
+{
+  /* t_lsb = 21750 ns / (1 + 0.0013 * freq_fine) = 217500000 / den ns */
+  uint64_t den = (uint64_t)(10000 + (13 * (int32_t)freq_fine));
 
-  if (ret == 0)
+  return ((lsb / den) * 217500000U) + ((((lsb % den) * 217500000U) + (den / 2U)) / den);
+}
+
+/**
+  * @brief  Convert an array of accelerometer samples in ug (exact).
+  *
+  * @param  fs       accelerometer full scale
+  * @param  lsb      raw samples
+  * @param  ug       converted samples [ug]
+  * @param  num      number of samples
+  * @retval          0 -> no Error, -1 -> invalid full scale
+  *
+  */
+int32_t st1vafe6ax_from_xl_lsb_to_ug_array(st1vafe6ax_xl_full_scale_t fs,
+                                           const int16_t *lsb, int32_t *ug,
+                                           uint32_t num)
+{
+  int32_t sens;
+  uint32_t i;
+
+  switch (fs)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EXEC_STATUS, (uint8_t *)&emb_func_exec_status,
-                              1);
+    case ST1VAFE6AX_2g:
+      sens = 61;
+      break;
+
+    case ST1VAFE6AX_4g:
+      sens = 122;
+      break;
+
+    case ST1VAFE6AX_8g:
+      sens = 244;
+      break;
+
+    default:
+      return -1;
   }
-  if (ret == 0)
+
+  for (i = 0U; i < num; i++)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_SRC, (uint8_t *)&emb_func_src, 1);
+    ug[i] = (int32_t)lsb[i] * sens;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  return 0;
+}
 
-  if (ret != 0)
+/**
+  * @brief  Convert an array of gyroscope samples in udps (exact).
+  *
+  * @param  fs       gyroscope full scale
+  * @param  lsb      raw samples
+  * @param  udps     converted samples [udps]
+  * @param  num      number of samples
+  * @retval          0 -> no Error, -1 -> invalid full scale
+  *
+  */
+int32_t st1vafe6ax_from_gy_lsb_to_udps_array(st1vafe6ax_gy_full_scale_t fs,
+                                             const int16_t *lsb, int64_t *udps,
+                                             uint32_t num)
+{
+  int32_t sens;
+  uint32_t i;
+
+  switch (fs)
   {
-    return ret;
-  }
+    case ST1VAFE6AX_125dps:
+      sens = 4375;
+      break;
 
-  val->emb_func_stand_by = emb_func_exec_status.emb_func_endop;
-  val->emb_func_time_exceed = emb_func_exec_status.emb_func_exec_ovr;
-  val->step_count_inc = emb_func_src.stepcounter_bit_set;
-  val->step_count_overflow = emb_func_src.step_overflow;
-  val->step_on_delta_time = emb_func_src.step_count_delta_ia;
+    case ST1VAFE6AX_250dps:
+      sens = 8750;
+      break;
 
-  val->step_detector = emb_func_src.step_detected;
+    case ST1VAFE6AX_500dps:
+      sens = 17500;
+      break;
 
-  return ret;
-}
+    case ST1VAFE6AX_1000dps:
+      sens = 35000;
+      break;
 
-int32_t st1vafe6ax_flag_data_ready_get(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_data_ready_t *val)
-{
-  st1vafe6ax_status_reg_t status = {0};
-  int32_t ret = {0};
+    case ST1VAFE6AX_2000dps:
+      sens = 70000;
+      break;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_STATUS_REG, (uint8_t *)&status, 1);
-  if (ret != 0)
-  {
-    return ret;
+    case ST1VAFE6AX_4000dps:
+      sens = 140000;
+      break;
+
+    default:
+      return -1;
   }
 
-  val->drdy_xl = status.xlda;
-  val->drdy_gy = status.gda;
-  val->drdy_temp = status.tda;
-  val->drdy_ah_bio = status.ah_bioda;
+  for (i = 0U; i < num; i++)
+  {
+    udps[i] = (int64_t)lsb[i] * sens;
+  }
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Temperature data output register[get]
+  * @brief  Convert an array of temperature samples in milli Celsius degrees.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Temperature data output register
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  lsb      raw samples
+  * @param  mdegc    converted samples [mdegC]
+  * @param  num      number of samples
   *
   */
-int32_t st1vafe6ax_temperature_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
+void st1vafe6ax_from_lsb_to_mdegc_array(const int16_t *lsb, int32_t *mdegc,
+                                        uint32_t num)
 {
-  uint8_t buff[2] = {0};
-  int32_t ret = {0};
+  uint32_t i;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_OUT_TEMP_L, &buff[0], 2);
-  if (ret != 0)
+  for (i = 0U; i < num; i++)
   {
-    return ret;
+    mdegc[i] = st1vafe6ax_from_lsb_to_mdegc(lsb[i]);
   }
-
-  *val = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
-
-  return ret;
 }
 
 /**
-  * @brief  Angular rate sensor.[get]
+  * @brief  Convert an array of AH / vAFE samples in uV.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Angular rate sensor.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  lsb      raw samples
+  * @param  uv       converted samples [uV]
+  * @param  num      number of samples
   *
   */
-int32_t st1vafe6ax_angular_rate_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
+void st1vafe6ax_from_lsb_to_uv_array(const int16_t *lsb, int32_t *uv, uint32_t num)
 {
-  uint8_t buff[6] = {0};
-  int32_t ret = {0};
+  uint32_t i;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_OUTX_L_G, &buff[0], 6);
-  if (ret != 0)
+  for (i = 0U; i < num; i++)
   {
-    return ret;
+    uv[i] = st1vafe6ax_from_lsb_to_uv(lsb[i]);
   }
+}
 
-  val[0] = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
-  val[1] = (int16_t)(buff[2] | ((uint16_t)buff[3] << 8));
-  val[2] = (int16_t)(buff[4] | ((uint16_t)buff[5] << 8));
+/**
+  * @}
+  *
+  */
 
-  return ret;
-}
+/**
+  * @defgroup  Common
+  * @brief     This section groups common useful functions.
+  *
+  */
 
 /**
-  * @brief  Linear acceleration sensor.[get]
+  * @brief  Reset of the device.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Linear acceleration sensor.
+  * @param  val      Reset of the device.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_acceleration_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
+int32_t st1vafe6ax_reset_set(const stmdev_ctx_t *ctx, st1vafe6ax_reset_t val)
 {
-  uint8_t buff[6] = {0};
-  int32_t ret = {0};
+  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+  st1vafe6ax_ctrl3_t ctrl3 = {0};
+  int32_t ret = 0;
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_OUTZ_L_A, &buff[0], 6);
   if (ret != 0)
   {
     return ret;
   }
 
-  val[2] = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
-  val[1] = (int16_t)(buff[2] | ((uint16_t)buff[3] << 8));
-  val[0] = (int16_t)(buff[4] | ((uint16_t)buff[5] << 8));
+  ctrl3.boot = (val == ST1VAFE6AX_RESTORE_CAL_PARAM) ? 1u : 0u;
+  ctrl3.sw_reset = (val == ST1VAFE6AX_RESTORE_CTRL_REGS) ? 1u : 0u;
+  func_cfg_access.sw_por = (val == ST1VAFE6AX_GLOBAL_RST) ? 1u : 0u;
+
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
 
   return ret;
 }
 
 /**
-  * @brief  Linear acceleration sensor for Dual channel mode.[get]
+  * @brief  Global reset of the device.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Linear acceleration sensor or Dual channel mode.
+  * @param  val      Global reset of the device.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_dual_acceleration_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
+int32_t st1vafe6ax_reset_get(const stmdev_ctx_t *ctx, st1vafe6ax_reset_t *val)
 {
-  uint8_t buff[6] = {0};
-  int32_t ret = {0};
+  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+  st1vafe6ax_ctrl3_t ctrl3 = {0};
+  int32_t ret = 0;
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_UI_OUTZ_L_A_DUALC, &buff[0], 6);
   if (ret != 0)
   {
     return ret;
   }
 
-  val[2] = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
-  val[1] = (int16_t)(buff[2] | ((uint16_t)buff[3] << 8));
-  val[0] = (int16_t)(buff[4] | ((uint16_t)buff[5] << 8));
+  switch ((ctrl3.sw_reset << 2) + (ctrl3.boot << 1) + func_cfg_access.sw_por)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_READY;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_GLOBAL_RST;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_RESTORE_CAL_PARAM;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_RESTORE_CTRL_REGS;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_GLOBAL_RST;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Bio data output register.[get]
+  * @brief  Change memory bank.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Bio data output register.
+  * @param  val      MAIN_MEM_BANK, EMBED_FUNC_MEM_BANK,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ah_bio_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
+int32_t st1vafe6ax_mem_bank_set(const stmdev_ctx_t *ctx, st1vafe6ax_mem_bank_t val)
 {
-  uint8_t buff[2] = {0};
-  int32_t ret = {0};
+  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+  st1vafe6ax_priv_t *priv;
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_AH_BIO_OUT_L, &buff[0], 2);
-  if (ret != 0)
+  priv = (ctx != NULL) ? (st1vafe6ax_priv_t *)ctx->priv_data : NULL;
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+  if ((ret != 0) || (func_cfg_access.emb_func_reg_access == ((uint8_t)val & 0x01U)))
   {
     return ret;
   }
 
-  *val = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  func_cfg_access.emb_func_reg_access = (uint8_t)val & 0x01U;
+
+  if ((priv != NULL) && (priv->bank_depth != 0U))
+  {
+    /* bank session: the switch is done on the bus by the next access */
+    bytecpy(&priv->bank_req, (uint8_t *)&func_cfg_access);
+    return ret;
+  }
+
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
 
   return ret;
 }
 
 /**
-  * @brief  Difference in percentage of the effective ODR (and timestamp rate) with respect to the typical. Step: 0.13%. 8-bit format, 2's complement.[get]
+  * @brief  Change memory bank.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Difference in percentage of the effective ODR (and timestamp rate) with respect to the typical. Step: 0.13%. 8-bit format, 2's complement.
+  * @param  val      MAIN_MEM_BANK, SENSOR_HUB_MEM_BANK, EMBED_FUNC_MEM_BANK,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_odr_cal_reg_get(const stmdev_ctx_t *ctx, int8_t *val)
+int32_t st1vafe6ax_mem_bank_get(const stmdev_ctx_t *ctx, st1vafe6ax_mem_bank_t *val)
 {
-  st1vafe6ax_internal_freq_t internal_freq = {0};
-  int32_t ret = {0};
+  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INTERNAL_FREQ, (uint8_t *)&internal_freq, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = (int8_t)internal_freq.freq_fine;
+  switch (func_cfg_access.emb_func_reg_access)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_MAIN_MEM_BANK;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_EMBED_FUNC_MEM_BANK;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_MAIN_MEM_BANK;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Write buffer in a page.[set]
+  * @brief  Start a memory bank session.
+  *         Until the matching st1vafe6ax_mem_bank_session_exit(), memory
+  *         bank changes (also the ones done internally by the APIs) are only
+  *         recorded and FUNC_CFG_ACCESS is written just before the next
+  *         access to a different bank. Repeated embedded function bank
+  *         accesses (e.g. st1vafe6ax_fsm_out_get(), st1vafe6ax_mlc_out_get())
+  *         then cost one bus transaction each.
+  *         Requires stmdev_ctx_t.priv_data to point to st1vafe6ax_priv_t.
+  *         Sessions can be nested.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Write buffer in a page.
+  * @param  val      MAIN_MEM_BANK, EMBED_FUNC_MEM_BANK,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ln_pg_write(const stmdev_ctx_t *ctx, uint16_t address,
-                               uint8_t *buf, uint8_t len)
+int32_t st1vafe6ax_mem_bank_session_enter(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_mem_bank_t val)
 {
-  st1vafe6ax_page_address_t  page_address = {0};
-  st1vafe6ax_page_sel_t page_sel = {0};
-  st1vafe6ax_page_rw_t page_rw = {0};
-  uint8_t msb = {0};
-  uint8_t lsb = {0};
-  int32_t ret = {0};
-  uint8_t i = {0};
-
-  msb = ((uint8_t)(address >> 8) & 0x0FU);
-  lsb = (uint8_t)address & 0xFFU;
-
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret != 0)
-  {
-    return ret;
-  }
-
-  /* set page write */
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
-  if (ret != 0)
-  {
-    goto exit;
-  }
-  page_rw.page_read = PROPERTY_DISABLE;
-  page_rw.page_write = PROPERTY_ENABLE;
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
+  st1vafe6ax_priv_t *priv;
+  uint8_t func_cfg_access = 0;
+  int32_t ret = 0;
 
-  /* select page */
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel, 1);
-  if (ret != 0)
-  {
-    goto exit;
-  }
-  page_sel.page_sel = msb & 0x0FU;
-  page_sel.not_used0 = 1U; // Default value
-  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel,
-                              1);
-  if (ret != 0)
+  if ((ctx == NULL) || (ctx->priv_data == NULL))
   {
-    goto exit;
+    return -1;
   }
 
-  /* set page addr */
-  page_address.page_addr = lsb;
-  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_ADDRESS,
-                              (uint8_t *)&page_address, 1);
-  if (ret != 0)
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if ((priv->bank_depth == 0xFFU) || (priv->cmd_list != NULL))
   {
-    goto exit;
+    return -1;
   }
 
-  for (i = 0; i < len; i++)
+  if (priv->bank_depth == 0U)
   {
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_VALUE, &buf[i], 1);
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &func_cfg_access, 1);
     if (ret != 0)
     {
-      goto exit;
-    }
-    lsb++;
-
-    /* Check if page wrap */
-    if ((lsb & 0xFFU) == 0x00U)
-    {
-      msb++;
-      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel, 1);
-      if (ret != 0)
-      {
-        goto exit;
-      }
-
-      page_sel.page_sel = msb & 0x0FU;
-      page_sel.not_used0 = 1U; // Default value
-      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel,
-                                 1);
-      if (ret != 0)
-      {
-        goto exit;
-      }
+      return ret;
     }
+    priv->bank_req = func_cfg_access;
   }
 
-  page_sel.page_sel = 0U;
-  page_sel.not_used0 = 1U;// Default value
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel,
-                             1);
-  if (ret != 0)
-  {
-    goto exit;
-  }
-
-  /* unset page write */
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
-  if (ret != 0)
-  {
-    goto exit;
-  }
-  page_rw.page_read = PROPERTY_DISABLE;
-  page_rw.page_write = PROPERTY_DISABLE;
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
-
-exit:
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  priv->bank_depth++;
+  ret = st1vafe6ax_mem_bank_set(ctx, val);
 
   return ret;
 }
 
 /**
-  * @brief  Read buffer in a page.[set]
+  * @brief  Close a memory bank session. When the outermost session is
+  *         closed the main memory bank is selected again.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Write buffer in a page.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ln_pg_read(const stmdev_ctx_t *ctx, uint16_t address,
-                              uint8_t *buf, uint8_t len)
+int32_t st1vafe6ax_mem_bank_session_exit(const stmdev_ctx_t *ctx)
 {
-  st1vafe6ax_page_address_t  page_address = {0};
-  st1vafe6ax_page_sel_t page_sel = {0};
-  st1vafe6ax_page_rw_t page_rw = {0};
-  uint8_t msb = {0};
-  uint8_t lsb = {0};
-  int32_t ret = {0};
-  uint8_t i = {0};
-
-  msb = ((uint8_t)(address >> 8) & 0x0FU);
-  lsb = (uint8_t)address & 0xFFU;
-
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret != 0)
-  {
-    return ret;
-  }
-
-  /* set page write */
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
-  if (ret != 0)
-  {
-    goto exit;
-  }
-  page_rw.page_read = PROPERTY_ENABLE;
-  page_rw.page_write = PROPERTY_DISABLE;
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
+  st1vafe6ax_priv_t *priv;
+  int32_t ret = 0;
 
-  /* select page */
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel, 1);
-  if (ret != 0)
-  {
-    goto exit;
-  }
-  page_sel.page_sel = msb & 0x0FU;
-  page_sel.not_used0 = 1U; // Default value
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel,
-                             1);
-  if (ret != 0)
+  if ((ctx == NULL) || (ctx->priv_data == NULL))
   {
-    goto exit;
+    return -1;
   }
 
-  /* set page addr */
-  page_address.page_addr = lsb;
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_ADDRESS,
-                             (uint8_t *)&page_address, 1);
-  if (ret != 0)
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if (priv->bank_depth == 0U)
   {
-    goto exit;
+    return -1;
   }
 
-  for (i = 0; i < len; i++)
+  if (priv->bank_depth == 1U)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_VALUE, &buf[i], 1);
-    if (ret != 0)
-    {
-      goto exit;
-    }
-    lsb++;
-
-    /* Check if page wrap */
-    if ((lsb & 0xFFU) == 0x00U)
+    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+    if (ret == 0)
     {
-      msb++;
-      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel, 1);
-      if (ret != 0)
-      {
-        goto exit;
-      }
-
-      page_sel.page_sel = msb & 0x0FU;
-      page_sel.not_used0 = 1U; // Default value
-      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel,
-                                 1);
-      if (ret != 0)
-      {
-        goto exit;
-      }
+      ret = bank_sync(ctx, priv);
     }
   }
 
-  page_sel.page_sel = 0U;
-  page_sel.not_used0 = 1U;// Default value
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel,
-                             1);
-  if (ret != 0)
-  {
-    goto exit;
-  }
-
-  /* unset page write */
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
-  if (ret != 0)
-  {
-    goto exit;
-  }
-  page_rw.page_read = PROPERTY_DISABLE;
-  page_rw.page_write = PROPERTY_DISABLE;
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
-
-exit:
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  priv->bank_depth--;
 
   return ret;
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup  Timestamp
-  * @brief     This section groups all the functions that manage the
-  *            timestamp generation.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Enables timestamp counter.[set]
+  * @brief  Device ID.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables timestamp counter.
+  * @param  val      Device ID.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_timestamp_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_device_id_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_functions_enable_t functions_enable = {0};
-  int32_t ret = {0};
+  st1vafe6ax_who_am_i_t who_am_i = {0};
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WHO_AM_I, (uint8_t *)&who_am_i, 1);
+  if (ret != 0)
   {
-    functions_enable.timestamp_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+    return ret;
   }
 
+  *val = who_am_i.id;
+
   return ret;
 }
 
 /**
-  * @brief  Enables timestamp counter.[get]
+  * @brief  Accelerometer output data rate (ODR) selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables timestamp counter.
+  * @param  val      st1vafe6ax_xl_data_rate_t enum
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_timestamp_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_xl_data_rate_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_data_rate_t val)
 {
-  st1vafe6ax_functions_enable_t functions_enable = {0};
-  int32_t ret = {0};
+  st1vafe6ax_ctrl1_t ctrl1 = {0};
+  int32_t ret;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
-  if (ret != 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
+  if (ret == 0)
   {
-    return ret;
+    ctrl1.odr_xl = (uint8_t)val & 0xFU;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
   }
 
-  *val = functions_enable.timestamp_en;
-
   return ret;
 }
 
 /**
-  * @brief  Timestamp data output.[get]
+  * @brief  Accelerometer output data rate (ODR) selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Timestamp data output.
+  * @param  val      st1vafe6ax_xl_data_rate_t enum
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_timestamp_raw_get(const stmdev_ctx_t *ctx, uint32_t *val)
+int32_t st1vafe6ax_xl_data_rate_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_data_rate_t *val)
 {
-  uint8_t buff[4] = {0};
-  int32_t ret = {0};
+  st1vafe6ax_ctrl1_t ctrl1 = {0};
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TIMESTAMP0, &buff[0], 4);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = buff[3];
-  *val = (*val * 256U) + buff[2];
-  *val = (*val * 256U) + buff[1];
-  *val = (*val * 256U) + buff[0];
+  switch (ctrl1.odr_xl)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_XL_ODR_OFF;
+      break;
 
-  return ret;
-}
+    case 0x01:
+      *val = ST1VAFE6AX_XL_ODR_AT_1Hz875;
+      break;
 
-/**
-  * @}
-  *
-  */
+    case 0x02:
+      *val = ST1VAFE6AX_XL_ODR_AT_7Hz5;
+      break;
 
-/**
-  * @defgroup  Filters
-  * @brief     This section group all the functions concerning the
-  *            filters configuration
-  * @{
-  *
-  */
+    case 0x03:
+      *val = ST1VAFE6AX_XL_ODR_AT_15Hz;
+      break;
 
-/**
-  * @brief  Protocol anti-spike filters.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      AUTO, ALWAYS_ACTIVE,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_filt_anti_spike_set(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_filt_anti_spike_t val)
-{
-  st1vafe6ax_if_cfg_t if_cfg = {0};
-  int32_t ret = {0};
+    case 0x04:
+      *val = ST1VAFE6AX_XL_ODR_AT_30Hz;
+      break;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+    case 0x05:
+      *val = ST1VAFE6AX_XL_ODR_AT_60Hz;
+      break;
 
-  if (ret == 0)
-  {
-    if_cfg.asf_ctrl = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
-  }
+    case 0x06:
+      *val = ST1VAFE6AX_XL_ODR_AT_120Hz;
+      break;
 
-  return ret;
-}
+    case 0x07:
+      *val = ST1VAFE6AX_XL_ODR_AT_240Hz;
+      break;
 
-/**
-  * @brief  Protocol anti-spike filters.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      AUTO, ALWAYS_ACTIVE,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_filt_anti_spike_get(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_filt_anti_spike_t *val)
-{
-  st1vafe6ax_if_cfg_t if_cfg = {0};
-  int32_t ret = {0};
+    case 0x08:
+      *val = ST1VAFE6AX_XL_ODR_AT_480Hz;
+      break;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
+    case 0x09:
+      *val = ST1VAFE6AX_XL_ODR_AT_960Hz;
+      break;
 
-  switch (if_cfg.asf_ctrl)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_AUTO;
+    case 0x0A:
+      *val = ST1VAFE6AX_XL_ODR_AT_1920Hz;
       break;
 
-    case 0x01:
-      *val = ST1VAFE6AX_ALWAYS_ACTIVE;
+    case 0x0B:
+      *val = ST1VAFE6AX_XL_ODR_AT_3840Hz;
       break;
 
     default:
-      *val = ST1VAFE6AX_AUTO;
+      *val = ST1VAFE6AX_XL_ODR_OFF;
       break;
   }
   return ret;
 }
 
 /**
-  * @brief  It masks DRDY and Interrupts RQ until filter settling ends.[set]
+  * @brief  Accelerometer operating mode selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      It masks DRDY and Interrupts RQ until filter settling ends.
+  * @param  val      st1vafe6ax_xl_mode_t struct
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_settling_mask_set(const stmdev_ctx_t *ctx,
-                                          st1vafe6ax_filt_settling_mask_t val)
+int32_t st1vafe6ax_xl_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_xl_mode_t val)
 {
-  st1vafe6ax_emb_func_cfg_t emb_func_cfg = {0};
-  st1vafe6ax_ctrl4_t ctrl4 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
-
-  if (ret == 0)
-  {
-    ctrl4.drdy_mask = val.drdy;
-
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
-  }
+  st1vafe6ax_ctrl1_t ctrl1 = {0};
+  int32_t ret = 0;
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_CFG, (uint8_t *)&emb_func_cfg, 1);
-  }
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
 
   if (ret == 0)
   {
-    emb_func_cfg.emb_func_irq_mask_xl_settl = val.irq_xl;
-    emb_func_cfg.emb_func_irq_mask_g_settl = val.irq_g;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_CFG, (uint8_t *)&emb_func_cfg, 1);
+    ctrl1.op_mode_xl = (uint8_t)val & 0x07U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  It masks DRDY and Interrupts RQ until filter settling ends.[get]
+  * @brief  Accelerometer operating mode selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      It masks DRDY and Interrupts RQ until filter settling ends.
+  * @param  val      st1vafe6ax_xl_mode_t struct
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_settling_mask_get(const stmdev_ctx_t *ctx,
-                                          st1vafe6ax_filt_settling_mask_t *val)
+int32_t st1vafe6ax_xl_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_xl_mode_t *val)
 {
-  st1vafe6ax_emb_func_cfg_t emb_func_cfg = {0};
-  st1vafe6ax_ctrl4_t ctrl4 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_CFG, (uint8_t *)&emb_func_cfg, 1);
+  st1vafe6ax_ctrl1_t ctrl1 = {0};
+  int32_t ret = 0;
 
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, (uint8_t *)&ctrl1, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  val->drdy = ctrl4.drdy_mask;
-  val->irq_xl = emb_func_cfg.emb_func_irq_mask_xl_settl;
-  val->irq_g = emb_func_cfg.emb_func_irq_mask_g_settl;
+  switch (ctrl1.op_mode_xl)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_XL_HIGH_PERFORMANCE_MD;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_XL_HIGH_PERFORMANCE_2_MD;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_XL_LOW_POWER_2_AVG_MD;
+      break;
+
+    case 0x05:
+      *val = ST1VAFE6AX_XL_LOW_POWER_4_AVG_MD;
+      break;
+
+    case 0x06:
+      *val = ST1VAFE6AX_XL_LOW_POWER_8_AVG_MD;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_XL_HIGH_PERFORMANCE_MD;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Gyroscope low-pass filter (LPF1) bandwidth selection.[set]
+  * @brief  Gyroscope output data rate (ODR) selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ULTRA_LIGHT, VERY_LIGHT, LIGHT, MEDIUM, STRONG, VERY_STRONG, AGGRESSIVE, XTREME,
+  * @param  val      st1vafe6ax_gy_data_rate_t enum
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_gy_lp1_bandwidth_set(const stmdev_ctx_t *ctx,
-                                             st1vafe6ax_filt_gy_lp1_bandwidth_t val)
+int32_t st1vafe6ax_gy_data_rate_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_gy_data_rate_t val)
 {
-  st1vafe6ax_ctrl6_t ctrl6 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_ctrl2_t ctrl2 = {0};
+  int32_t ret = 0;
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
   if (ret == 0)
   {
-    ctrl6.lpf1_g_bw = (uint8_t)val & 0x7U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
+    ctrl2.odr_g = (uint8_t)val & 0xFU;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Gyroscope low-pass filter (LPF1) bandwidth selection.[get]
+  * @brief  Gyroscope output data rate (ODR) selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ULTRA_LIGHT, VERY_LIGHT, LIGHT, MEDIUM, STRONG, VERY_STRONG, AGGRESSIVE, XTREME,
+  * @param  val      st1vafe6ax_gy_data_rate_t enum
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_gy_lp1_bandwidth_get(const stmdev_ctx_t *ctx,
-                                             st1vafe6ax_filt_gy_lp1_bandwidth_t *val)
+int32_t st1vafe6ax_gy_data_rate_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_gy_data_rate_t *val)
 {
-  st1vafe6ax_ctrl6_t ctrl6 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_ctrl2_t ctrl2 = {0};
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (ctrl6.lpf1_g_bw)
+  switch (ctrl2.odr_g)
   {
     case 0x00:
-      *val = ST1VAFE6AX_GY_ULTRA_LIGHT;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_GY_VERY_LIGHT;
+      *val = ST1VAFE6AX_GY_ODR_OFF;
       break;
 
     case 0x02:
-      *val = ST1VAFE6AX_GY_LIGHT;
+      *val = ST1VAFE6AX_GY_ODR_AT_7Hz5;
       break;
 
     case 0x03:
-      *val = ST1VAFE6AX_GY_MEDIUM;
+      *val = ST1VAFE6AX_GY_ODR_AT_15Hz;
       break;
 
     case 0x04:
-      *val = ST1VAFE6AX_GY_STRONG;
+      *val = ST1VAFE6AX_GY_ODR_AT_30Hz;
       break;
 
     case 0x05:
-      *val = ST1VAFE6AX_GY_VERY_STRONG;
+      *val = ST1VAFE6AX_GY_ODR_AT_60Hz;
       break;
 
     case 0x06:
-      *val = ST1VAFE6AX_GY_AGGRESSIVE;
+      *val = ST1VAFE6AX_GY_ODR_AT_120Hz;
       break;
 
     case 0x07:
-      *val = ST1VAFE6AX_GY_XTREME;
+      *val = ST1VAFE6AX_GY_ODR_AT_240Hz;
+      break;
+
+    case 0x08:
+      *val = ST1VAFE6AX_GY_ODR_AT_480Hz;
+      break;
+
+    case 0x09:
+      *val = ST1VAFE6AX_GY_ODR_AT_960Hz;
+      break;
+
+    case 0x0A:
+      *val = ST1VAFE6AX_GY_ODR_AT_1920Hz;
+      break;
+
+    case 0x0B:
+      *val = ST1VAFE6AX_GY_ODR_AT_3840Hz;
       break;
 
     default:
-      *val = ST1VAFE6AX_GY_ULTRA_LIGHT;
+      *val = ST1VAFE6AX_GY_ODR_OFF;
       break;
   }
   return ret;
 }
 
 /**
-  * @brief  It enables gyroscope digital LPF1 filter.[set]
+  * @brief  Gyroscope operating mode selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      It enables gyroscope digital LPF1 filter.
+  * @param  val      GY_HIGH_PERFORMANCE_MD, GY_HIGH_ACCURANCY_ODR_MD, GY_SLEEP_MD, GY_LOW_POWER_MD,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_gy_lp1_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_gy_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_gy_mode_t val)
 {
-  st1vafe6ax_ctrl7_t ctrl7 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+  st1vafe6ax_ctrl2_t ctrl2 = {0};
+  int32_t ret = 0;
 
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
   if (ret == 0)
   {
-    ctrl7.lpf1_g_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+    ctrl2.op_mode_g = (uint8_t)val & 0x07U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  It enables gyroscope digital LPF1 filter.[get]
+  * @brief  Gyroscope operating mode selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      It enables gyroscope digital LPF1 filter.
+  * @param  val      GY_HIGH_PERFORMANCE_MD, GY_HIGH_ACCURANCY_ODR_MD, GY_SLEEP_MD, GY_LOW_POWER_MD,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_gy_lp1_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_gy_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_gy_mode_t *val)
 {
-  st1vafe6ax_ctrl7_t ctrl7 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_ctrl2_t ctrl2 = {0};
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL2, (uint8_t *)&ctrl2, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = ctrl7.lpf1_g_en;
+  switch (ctrl2.op_mode_g)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_GY_HIGH_PERFORMANCE_MD;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_GY_SLEEP_MD;
+      break;
+
+    case 0x05:
+      *val = ST1VAFE6AX_GY_LOW_POWER_MD;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_GY_HIGH_PERFORMANCE_MD;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Bio filter configuration.[set]
+  * @brief  Register address automatically incremented during a multiple byte access with a serial interface (enable by default).[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Bio filter configuration.
+  * @param  val      Register address automatically incremented during a multiple byte access with a serial interface (enable by default).
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_ah_bio_conf_set(const stmdev_ctx_t *ctx,
-                                        st1vafe6ax_filt_ah_bio_conf_t val)
+int32_t st1vafe6ax_auto_increment_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
-  st1vafe6ax_ctrl8_t ctrl8 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
-
-  ctrl8.ah_bio_hpf = val.hpf;
-  ctrl9.ah_bio_lpf = val.lpf;
+  st1vafe6ax_ctrl3_t ctrl3 = {0};
+  int32_t ret = 0;
 
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
   if (ret == 0)
   {
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
-  }
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+    ctrl3.if_inc = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Bio filter configuration.[get]
+  * @brief  Register address automatically incremented during a multiple byte access with a serial interface (enable by default).[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Bio filter configuration.
+  * @param  val      Register address automatically incremented during a multiple byte access with a serial interface (enable by default).
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_ah_bio_conf_get(const stmdev_ctx_t *ctx,
-                                        st1vafe6ax_filt_ah_bio_conf_t *val)
+int32_t st1vafe6ax_auto_increment_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_ctrl8_t ctrl8 = {0};
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl3_t ctrl3 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  val->lpf = ctrl9.ah_bio_lpf;
-  val->hpf = ctrl8.ah_bio_hpf;
+  *val = ctrl3.if_inc;
+
 
   return ret;
 }
 
 /**
-  * @brief  Accelerometer LPF2 and high pass filter configuration and cutoff setting.[set]
+  * @brief  Block Data Update (BDU): output registers are not updated until LSB and MSB have been read). [set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ULTRA_LIGHT, VERY_LIGHT, LIGHT, MEDIUM, STRONG, VERY_STRONG, AGGRESSIVE, XTREME,
+  * @param  val      Block Data Update (BDU): output registers are not updated until LSB and MSB have been read).
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_lp2_bandwidth_set(const stmdev_ctx_t *ctx,
-                                             st1vafe6ax_filt_xl_lp2_bandwidth_t val)
+int32_t st1vafe6ax_block_data_update_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_ctrl8_t ctrl8 = {0};
+  st1vafe6ax_ctrl3_t ctrl3 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+
   if (ret == 0)
   {
-    ctrl8.hp_lpf2_xl_bw = (uint8_t)val & 0x7U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+    ctrl3.bdu = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Accelerometer LPF2 and high pass filter configuration and cutoff setting.[get]
+  * @brief  Block Data Update (BDU): output registers are not updated until LSB and MSB have been read). [get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ULTRA_LIGHT, VERY_LIGHT, LIGHT, MEDIUM, STRONG, VERY_STRONG, AGGRESSIVE, XTREME,
+  * @param  val      Block Data Update (BDU): output registers are not updated until LSB and MSB have been read).
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_lp2_bandwidth_get(const stmdev_ctx_t *ctx,
-                                             st1vafe6ax_filt_xl_lp2_bandwidth_t *val)
+int32_t st1vafe6ax_block_data_update_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_ctrl8_t ctrl8 = {0};
+  st1vafe6ax_ctrl3_t ctrl3 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (ctrl8.hp_lpf2_xl_bw)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_XL_ULTRA_LIGHT;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_XL_VERY_LIGHT;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_XL_LIGHT;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_XL_MEDIUM;
-      break;
-
-    case 0x04:
-      *val = ST1VAFE6AX_XL_STRONG;
-      break;
-
-    case 0x05:
-      *val = ST1VAFE6AX_XL_VERY_STRONG;
-      break;
-
-    case 0x06:
-      *val = ST1VAFE6AX_XL_AGGRESSIVE;
-      break;
-
-    case 0x07:
-      *val = ST1VAFE6AX_XL_XTREME;
-      break;
+  *val = ctrl3.bdu;
 
-    default:
-      *val = ST1VAFE6AX_XL_ULTRA_LIGHT;
-      break;
-  }
   return ret;
 }
 
 /**
-  * @brief  Enable accelerometer LPS2 (Low Pass Filter 2) filtering stage.[set]
+  * @brief  Enables pulsed data-ready mode (~75 us).[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enable accelerometer LPS2 (Low Pass Filter 2) filtering stage.
+  * @param  val      DRDY_LATCHED, DRDY_PULSED,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_lp2_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_data_ready_mode_set(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_data_ready_mode_t val)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl4_t ctrl4 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
+
   if (ret == 0)
   {
-    ctrl9.lpf2_xl_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+    ctrl4.drdy_pulsed = (uint8_t)val & 0x1U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enable accelerometer LPS2 (Low Pass Filter 2) filtering stage.[get]
+  * @brief  Enables pulsed data-ready mode (~75 us).[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enable accelerometer LPS2 (Low Pass Filter 2) filtering stage.
+  * @param  val      DRDY_LATCHED, DRDY_PULSED,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_lp2_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_data_ready_mode_get(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_data_ready_mode_t *val)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl4_t ctrl4 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = ctrl9.lpf2_xl_en;
+  switch (ctrl4.drdy_pulsed)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_DRDY_LATCHED;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_DRDY_PULSED;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_DRDY_LATCHED;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Accelerometer slope filter / high-pass filter selection.[set]
+  * @brief  Gyroscope full-scale selection[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Accelerometer slope filter / high-pass filter selection.
+  * @param  val      125dps, 250dps, 500dps, 1000dps, 2000dps, 4000dps,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_hp_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_gy_full_scale_set(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_gy_full_scale_t val)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl6_t ctrl6 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
+
   if (ret == 0)
   {
-    ctrl9.hp_slope_xl_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+    ctrl6.fs_g = (uint8_t)val & 0xFU;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Accelerometer slope filter / high-pass filter selection.[get]
+  * @brief  Gyroscope full-scale selection[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Accelerometer slope filter / high-pass filter selection.
+  * @param  val      125dps, 250dps, 500dps, 1000dps, 2000dps, 4000dps,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_hp_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_gy_full_scale_get(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_gy_full_scale_t *val)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl6_t ctrl6 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = ctrl9.hp_slope_xl_en;
+  switch (ctrl6.fs_g)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_125dps;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_250dps;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_500dps;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_1000dps;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_2000dps;
+      break;
+
+    case 0x0C:
+      *val = ST1VAFE6AX_4000dps;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_125dps;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Enables accelerometer LPF2 and HPF fast-settling mode. The filter sets the first sample.[set]
+  * @brief  Accelerometer full-scale selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables accelerometer LPF2 and HPF fast-settling mode. The filter sets the first sample.
+  * @param  val      2g, 4g, 8g, 16g,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_fast_settling_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_xl_full_scale_set(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_xl_full_scale_t val)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl8_t ctrl8 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+
   if (ret == 0)
   {
-    ctrl9.xl_fastsettl_mode = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+    ctrl8.fs_xl = (uint8_t)val & 0x3U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enables accelerometer LPF2 and HPF fast-settling mode. The filter sets the first sample.[get]
+  * @brief  Accelerometer full-scale selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables accelerometer LPF2 and HPF fast-settling mode. The filter sets the first sample.
+  * @param  val      2g, 4g, 8g, 16g,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_fast_settling_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_xl_full_scale_get(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_xl_full_scale_t *val)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl8_t ctrl8 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = ctrl9.xl_fastsettl_mode;
+  switch (ctrl8.fs_xl)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_2g;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_4g;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_8g;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_2g;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Accelerometer high-pass filter mode.[set]
+  * @brief  It enables the accelerometer Dual channel mode: data with selected full scale and data with maximum full scale are sent simultaneously to two different set of output registers.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      HP_MD_NORMAL, HP_MD_REFERENCE,
+  * @param  val      It enables the accelerometer Dual channel mode: data with selected full scale and data with maximum full scale are sent simultaneously to two different set of output registers.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_hp_mode_set(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_filt_xl_hp_mode_t val)
+int32_t st1vafe6ax_xl_dual_channel_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl8_t ctrl8 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+
   if (ret == 0)
   {
-    ctrl9.hp_ref_mode_xl = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+    ctrl8.xl_dualc_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Accelerometer high-pass filter mode.[get]
+  * @brief  It enables the accelerometer Dual channel mode: data with selected full scale and data with maximum full scale are sent simultaneously to two different set of output registers.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      HP_MD_NORMAL, HP_MD_REFERENCE,
+  * @param  val      It enables the accelerometer Dual channel mode: data with selected full scale and data with maximum full scale are sent simultaneously to two different set of output registers.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_xl_hp_mode_get(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_filt_xl_hp_mode_t *val)
+int32_t st1vafe6ax_xl_dual_channel_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl8_t ctrl8 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (ctrl9.hp_ref_mode_xl)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_HP_MD_NORMAL;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_HP_MD_REFERENCE;
-      break;
+  *val = ctrl8.xl_dualc_en;
 
-    default:
-      *val = ST1VAFE6AX_HP_MD_NORMAL;
-      break;
-  }
   return ret;
 }
 
 /**
-  * @brief  HPF or SLOPE filter selection on wake-up and Activity/Inactivity functions.[set]
+  * @brief  Accelerometer self-test selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      WK_FEED_SLOPE, WK_FEED_HIGH_PASS,
+  * @param  val      XL_ST_DISABLE, XL_ST_POSITIVE, XL_ST_NEGATIVE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_wkup_act_feed_set(const stmdev_ctx_t *ctx,
-                                          st1vafe6ax_filt_wkup_act_feed_t val)
+int32_t st1vafe6ax_xl_self_test_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_self_test_t val)
 {
-  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
+  st1vafe6ax_ctrl10_t ctrl10 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
-
-  if (ret != 0)
-  {
-    return ret;
-  }
-
-  tap_cfg0.slope_fds = (uint8_t)val & 0x01U;
-  wake_up_ths.usr_off_on_wu = ((uint8_t)val & 0x02U) >> 1;
-
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
 
-  if (ret != 0)
+  if (ret == 0)
   {
-    return ret;
+    ctrl10.st_xl = (uint8_t)val & 0x3U;
+    ctrl10.xl_st_offset = ((uint8_t)val & 0x04U) >> 2;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
   }
 
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
-
   return ret;
 }
 
 /**
-  * @brief  HPF or SLOPE filter selection on wake-up and Activity/Inactivity functions.[get]
+  * @brief  Accelerometer self-test selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      WK_FEED_SLOPE, WK_FEED_HIGH_PASS,
+  * @param  val      XL_ST_DISABLE, XL_ST_POSITIVE, XL_ST_NEGATIVE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_wkup_act_feed_get(const stmdev_ctx_t *ctx,
-                                          st1vafe6ax_filt_wkup_act_feed_t *val)
+int32_t st1vafe6ax_xl_self_test_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_self_test_t *val)
 {
-  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
+  st1vafe6ax_ctrl10_t ctrl10 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch ((wake_up_ths.usr_off_on_wu << 1) + tap_cfg0.slope_fds)
+  //switch (ctrl10.xl_st_offset)
+  switch (ctrl10.st_xl)
   {
     case 0x00:
-      *val = ST1VAFE6AX_WK_FEED_SLOPE;
+      *val = ST1VAFE6AX_XL_ST_DISABLE;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_WK_FEED_HIGH_PASS;
+      *val = ctrl10.xl_st_offset == 0u ? ST1VAFE6AX_XL_ST_POSITIVE : ST1VAFE6AX_XL_ST_OFFSET_POS;
       break;
 
     case 0x02:
-      *val = ST1VAFE6AX_WK_FEED_LP_WITH_OFFSET;
+      *val = ctrl10.xl_st_offset == 0u ? ST1VAFE6AX_XL_ST_NEGATIVE : ST1VAFE6AX_XL_ST_OFFSET_NEG;
       break;
 
     default:
-      *val = ST1VAFE6AX_WK_FEED_SLOPE;
+      *val = ST1VAFE6AX_XL_ST_DISABLE;
       break;
   }
   return ret;
 }
 
 /**
-  * @brief  Mask hw function triggers when xl is settling.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      0 or 1,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_mask_trigger_xl_settl_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
-
-  if (ret == 0)
-  {
-    tap_cfg0.hw_func_mask_xl_settl = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Mask hw function triggers when xl is settling.[get]
+  * @brief  Gyroscope self-test selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      0 or 1,
+  * @param  val      XL_ST_DISABLE, XL_ST_POSITIVE, XL_ST_NEGATIVE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_mask_trigger_xl_settl_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_gy_self_test_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_gy_self_test_t val)
 {
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
+  st1vafe6ax_ctrl10_t ctrl10 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-
-  *val = tap_cfg0.hw_func_mask_xl_settl;
-
-  return ret;
-}
-
-
-/**
-  * @brief  LPF2 filter on 6D (sixd) function selection.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      SIXD_FEED_ODR_DIV_2, SIXD_FEED_LOW_PASS,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_filt_sixd_feed_set(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_filt_sixd_feed_t val)
-{
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
-  int32_t ret = {0};
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
   if (ret == 0)
   {
-    tap_cfg0.low_pass_on_6d = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+    ctrl10.st_g = (uint8_t)val & 0x3U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  LPF2 filter on 6D (sixd) function selection.[get]
+  * @brief  Gyroscope self-test selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      SIXD_FEED_ODR_DIV_2, SIXD_FEED_LOW_PASS,
+  * @param  val      XL_ST_DISABLE, XL_ST_POSITIVE, XL_ST_NEGATIVE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_filt_sixd_feed_get(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_filt_sixd_feed_t *val)
+int32_t st1vafe6ax_gy_self_test_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_gy_self_test_t *val)
 {
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
+  st1vafe6ax_ctrl10_t ctrl10 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (tap_cfg0.low_pass_on_6d)
+  switch (ctrl10.st_g)
   {
     case 0x00:
-      *val = ST1VAFE6AX_SIXD_FEED_ODR_DIV_2;
+      *val = ST1VAFE6AX_GY_ST_DISABLE;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_SIXD_FEED_LOW_PASS;
+      *val = ST1VAFE6AX_GY_ST_POSITIVE;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_GY_ST_NEGATIVE;
       break;
 
     default:
-      *val = ST1VAFE6AX_SIXD_FEED_ODR_DIV_2;
+      *val = ST1VAFE6AX_GY_ST_DISABLE;
       break;
   }
   return ret;
 }
 
-/**
-  * @}
-  *
-  */
+/* all_sources: FIFO_STATUS1, FIFO_STATUS2, ALL_INT_SRC, STATUS_REG */
+static void all_sources_status_decode(const uint8_t *buff,
+                                      st1vafe6ax_all_sources_t *val)
+{
+  st1vafe6ax_fifo_status2_t fifo_status2 = {0};
+  st1vafe6ax_all_int_src_t all_int_src = {0};
+  st1vafe6ax_status_reg_t status_reg = {0};
 
-/**
-  * @defgroup  Serial interfaces
-  * @brief     This section groups all the functions concerning
-  *            serial interfaces management (not auxiliary)
-  * @{
-  *
-  */
+  bytecpy((uint8_t *)&fifo_status2, &buff[1]);
+  bytecpy((uint8_t *)&all_int_src, &buff[2]);
+  bytecpy((uint8_t *)&status_reg, &buff[3]);
 
-/**
-  * @brief  Enables pull-up on SDO pin of UI (User Interface).[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Enables pull-up on SDO pin of UI (User Interface).
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_ui_sdo_pull_up_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  st1vafe6ax_pin_ctrl_t pin_ctrl = {0};
-  int32_t ret = {0};
+  val->fifo_ovr = fifo_status2.fifo_ovr_ia;
+  val->fifo_bdr = fifo_status2.counter_bdr_ia;
+  val->fifo_full = fifo_status2.fifo_full_ia;
+  val->fifo_th = fifo_status2.fifo_wtm_ia;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
-  if (ret == 0)
-  {
-    pin_ctrl.sdo_pu_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
-  }
+  val->free_fall = all_int_src.ff_ia;
+  val->wake_up = all_int_src.wu_ia;
+  val->six_d = all_int_src.d6d_ia;
 
-  return ret;
+  val->drdy_xl = status_reg.xlda;
+  val->drdy_gy = status_reg.gda;
+  val->drdy_temp = status_reg.tda;
+  val->drdy_ah_bio = status_reg.ah_bioda;
+  val->timestamp = status_reg.timestamp_endcount;
 }
 
-/**
-  * @brief  Enables pull-up on SDO pin of UI (User Interface).[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Enables pull-up on SDO pin of UI (User Interface).
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_ui_sdo_pull_up_get(const stmdev_ctx_t *ctx, uint8_t *val)
+/* all_sources: WAKE_UP_SRC ... MLC_STATUS_MAINPAGE */
+static void all_sources_src_decode(const uint8_t *buff,
+                                   st1vafe6ax_all_sources_t *val)
 {
-  st1vafe6ax_pin_ctrl_t pin_ctrl = {0};
-  int32_t ret = {0};
+  st1vafe6ax_emb_func_status_mainpage_t emb_func_status_mainpage = {0};
+  st1vafe6ax_fsm_status_mainpage_t fsm_status_mainpage = {0};
+  st1vafe6ax_mlc_status_mainpage_t mlc_status_mainpage = {0};
+  st1vafe6ax_wake_up_src_t wake_up_src = {0};
+  st1vafe6ax_d6d_src_t d6d_src = {0};
+  st1vafe6ax_tap_src_t tap_src = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
+  bytecpy((uint8_t *)&wake_up_src, &buff[0]);
+  bytecpy((uint8_t *)&tap_src, &buff[1]);
+  bytecpy((uint8_t *)&d6d_src, &buff[2]);
+  bytecpy((uint8_t *)&emb_func_status_mainpage, &buff[4]);
+  bytecpy((uint8_t *)&fsm_status_mainpage, &buff[5]);
+  bytecpy((uint8_t *)&mlc_status_mainpage, &buff[6]);
 
-  *val = pin_ctrl.sdo_pu_en;
+  val->sleep_change = wake_up_src.sleep_change_ia;
+  val->wake_up_x = wake_up_src.x_wu;
+  val->wake_up_y = wake_up_src.y_wu;
+  val->wake_up_z = wake_up_src.z_wu;
+  val->sleep_state = wake_up_src.sleep_state;
 
-  return ret;
-}
+  val->tap_x = tap_src.x_tap;
+  val->tap_y = tap_src.y_tap;
+  val->tap_z = tap_src.z_tap;
+  val->tap_sign = tap_src.tap_sign;
+  val->double_tap = tap_src.double_tap;
+  val->single_tap = tap_src.single_tap;
 
-/**
-  * @brief  Disables I2C and I3C on UI (User Interface).[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      I2C_I3C_ENABLE, I2C_I3C_DISABLE,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_ui_i2c_i3c_mode_set(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_ui_i2c_i3c_mode_t val)
-{
-  st1vafe6ax_if_cfg_t if_cfg = {0};
-  int32_t ret = {0};
+  val->six_d_zl = d6d_src.zl;
+  val->six_d_zh = d6d_src.zh;
+  val->six_d_yl = d6d_src.yl;
+  val->six_d_yh = d6d_src.yh;
+  val->six_d_xl = d6d_src.xl;
+  val->six_d_xh = d6d_src.xh;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
-  if (ret == 0)
-  {
-    if_cfg.i2c_i3c_disable = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
-  }
+  val->step_detector = emb_func_status_mainpage.is_step_det;
+  val->tilt = emb_func_status_mainpage.is_tilt;
+  val->sig_mot = emb_func_status_mainpage.is_sigmot;
+  val->fsm_lc = emb_func_status_mainpage.is_fsm_lc;
 
-  return ret;
+  val->fsm1 = fsm_status_mainpage.is_fsm1;
+  val->fsm2 = fsm_status_mainpage.is_fsm2;
+  val->fsm3 = fsm_status_mainpage.is_fsm3;
+  val->fsm4 = fsm_status_mainpage.is_fsm4;
+  val->fsm5 = fsm_status_mainpage.is_fsm5;
+  val->fsm6 = fsm_status_mainpage.is_fsm6;
+  val->fsm7 = fsm_status_mainpage.is_fsm7;
+  val->fsm8 = fsm_status_mainpage.is_fsm8;
+
+  val->mlc1 = mlc_status_mainpage.is_mlc1;
+  val->mlc2 = mlc_status_mainpage.is_mlc2;
+  val->mlc3 = mlc_status_mainpage.is_mlc3;
+  val->mlc4 = mlc_status_mainpage.is_mlc4;
 }
 
-/**
-  * @brief  Disables I2C and I3C on UI (User Interface).[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      I2C_I3C_ENABLE, I2C_I3C_DISABLE,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_ui_i2c_i3c_mode_get(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_ui_i2c_i3c_mode_t *val)
+/* all_sources: EMB_FUNC_EXEC_STATUS, EMB_FUNC_SRC (embedded functions bank) */
+static void all_sources_emb_decode(const uint8_t *exec_status, const uint8_t *src,
+                                   st1vafe6ax_all_sources_t *val)
 {
-  st1vafe6ax_if_cfg_t if_cfg = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
+  st1vafe6ax_emb_func_exec_status_t emb_func_exec_status = {0};
+  st1vafe6ax_emb_func_src_t emb_func_src = {0};
 
-  switch (if_cfg.i2c_i3c_disable)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_I2C_I3C_ENABLE;
-      break;
+  bytecpy((uint8_t *)&emb_func_exec_status, exec_status);
+  bytecpy((uint8_t *)&emb_func_src, src);
 
-    case 0x01:
-      *val = ST1VAFE6AX_I2C_I3C_DISABLE;
-      break;
+  val->emb_func_stand_by = emb_func_exec_status.emb_func_endop;
+  val->emb_func_time_exceed = emb_func_exec_status.emb_func_exec_ovr;
+  val->step_count_inc = emb_func_src.stepcounter_bit_set;
+  val->step_count_overflow = emb_func_src.step_overflow;
+  val->step_on_delta_time = emb_func_src.step_count_delta_ia;
 
-    default:
-      *val = ST1VAFE6AX_I2C_I3C_ENABLE;
-      break;
-  }
-  return ret;
+  val->step_detector = emb_func_src.step_detected;
 }
 
 /**
-  * @brief  SPI Serial Interface Mode selection.[set]
+  * @brief  Get the status of all the interrupt sources.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      SPI_4_WIRE, SPI_3_WIRE,
+  * @param  val      Get the status of all the interrupt sources.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_spi_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_spi_mode_t val)
+int32_t st1vafe6ax_all_sources_get(const stmdev_ctx_t *ctx,
+                                   st1vafe6ax_all_sources_t *val)
 {
-  st1vafe6ax_if_cfg_t if_cfg = {0};
-  int32_t ret = {0};
+  st1vafe6ax_functions_enable_t functions_enable = {0};
+  uint8_t emb_func_exec_status = 0;
+  uint8_t emb_func_src = 0;
+  uint8_t buff[7] = {0};
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
   if (ret == 0)
   {
-    if_cfg.sim = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+    functions_enable.dis_rst_lir_all_int = PROPERTY_ENABLE;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
   }
 
-  return ret;
-}
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_STATUS1, (uint8_t *)&buff, 4);
+  }
 
-/**
-  * @brief  SPI Serial Interface Mode selection.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      SPI_4_WIRE, SPI_3_WIRE,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_spi_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_spi_mode_t *val)
-{
-  st1vafe6ax_if_cfg_t if_cfg = {0};
-  int32_t ret = {0};
+  if (ret != 0)
+  {
+    return ret;
+  }
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+  all_sources_status_decode(buff, val);
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+  functions_enable.dis_rst_lir_all_int = PROPERTY_DISABLE;
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (if_cfg.sim)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_SRC, (uint8_t *)&buff, 7);
+  if (ret != 0)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_SPI_4_WIRE;
-      break;
+    return ret;
+  }
 
-    case 0x01:
-      *val = ST1VAFE6AX_SPI_3_WIRE;
-      break;
+  all_sources_src_decode(buff, val);
 
-    default:
-      *val = ST1VAFE6AX_SPI_4_WIRE;
-      break;
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EXEC_STATUS, &emb_func_exec_status, 1);
+  }
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_SRC, &emb_func_src, 1);
   }
-  return ret;
-}
 
-/**
-  * @brief  Enables pull-up on SDA pin.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Enables pull-up on SDA pin.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_ui_sda_pull_up_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  st1vafe6ax_if_cfg_t if_cfg = {0};
-  int32_t ret = {0};
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
-  if (ret == 0)
+  if (ret != 0)
   {
-    if_cfg.sda_pu_en = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+    return ret;
   }
 
+  all_sources_emb_decode(&emb_func_exec_status, &emb_func_src, val);
+
   return ret;
 }
 
 /**
-  * @brief  Enables pull-up on SDA pin.[get]
+  * @brief  Fast event polling: WAKE_UP_SRC ... MLC_STATUS_MAINPAGE and
+  *         FIFO_STATUS1 ... STATUS_REG are read with two bursts, the
+  *         embedded functions status being taken from the main page mirrors
+  *         (FUNC_CFG_ACCESS is never accessed, the main bank must be
+  *         selected). Latched interrupts are acknowledged by the read.
+  *         The source registers are read first and the wake-up, free-fall,
+  *         sleep change, 6D and tap events are taken from them: with
+  *         latched interrupts, reading ALL_INT_SRC before them would reset
+  *         TAP_SRC, WAKE_UP_SRC and D6D_SRC.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables pull-up on SDA pin.
+  * @param  val      bitmask of ST1VAFE6AX_EVENT_* pending events
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ui_sda_pull_up_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_event_poll_get(const stmdev_ctx_t *ctx, uint32_t *val)
 {
-  st1vafe6ax_if_cfg_t if_cfg = {0};
-  int32_t ret = {0};
+  st1vafe6ax_emb_func_status_mainpage_t emb_func_status_mainpage = {0};
+  st1vafe6ax_fifo_status2_t fifo_status2 = {0};
+  st1vafe6ax_wake_up_src_t wake_up_src = {0};
+  st1vafe6ax_status_reg_t status_reg = {0};
+  st1vafe6ax_tap_src_t tap_src = {0};
+  st1vafe6ax_d6d_src_t d6d_src = {0};
+  uint8_t status[4] = {0};
+  uint8_t src[7] = {0};
+  uint32_t ev = 0U;
+  int32_t ret;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+  /* sources first: the ALL_INT_SRC read resets them if latched */
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_SRC, src, 7);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_STATUS1, status, 4);
+  }
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = if_cfg.sda_pu_en;
+  bytecpy((uint8_t *)&fifo_status2, &status[1]);
+  bytecpy((uint8_t *)&status_reg, &status[3]);
+  bytecpy((uint8_t *)&wake_up_src, &src[0]);
+  bytecpy((uint8_t *)&tap_src, &src[1]);
+  bytecpy((uint8_t *)&d6d_src, &src[2]);
+  bytecpy((uint8_t *)&emb_func_status_mainpage, &src[4]);
+
+  ev |= (status_reg.xlda != 0U) ? ST1VAFE6AX_EVENT_DRDY_XL : 0U;
+  ev |= (status_reg.gda != 0U) ? ST1VAFE6AX_EVENT_DRDY_GY : 0U;
+  ev |= (status_reg.tda != 0U) ? ST1VAFE6AX_EVENT_DRDY_TEMP : 0U;
+  ev |= (status_reg.ah_bioda != 0U) ? ST1VAFE6AX_EVENT_DRDY_AH_BIO : 0U;
+  ev |= (status_reg.timestamp_endcount != 0U) ? ST1VAFE6AX_EVENT_TIMESTAMP : 0U;
+
+  ev |= (fifo_status2.fifo_wtm_ia != 0U) ? ST1VAFE6AX_EVENT_FIFO_TH : 0U;
+  ev |= (fifo_status2.fifo_ovr_ia != 0U) ? ST1VAFE6AX_EVENT_FIFO_OVR : 0U;
+  ev |= (fifo_status2.fifo_full_ia != 0U) ? ST1VAFE6AX_EVENT_FIFO_FULL : 0U;
+  ev |= (fifo_status2.counter_bdr_ia != 0U) ? ST1VAFE6AX_EVENT_FIFO_BDR : 0U;
+
+  ev |= (wake_up_src.ff_ia != 0U) ? ST1VAFE6AX_EVENT_FREE_FALL : 0U;
+  ev |= (wake_up_src.wu_ia != 0U) ? ST1VAFE6AX_EVENT_WAKE_UP : 0U;
+  ev |= (d6d_src.d6d_ia != 0U) ? ST1VAFE6AX_EVENT_SIX_D : 0U;
+  ev |= (wake_up_src.sleep_change_ia != 0U) ? ST1VAFE6AX_EVENT_SLEEP_CHANGE : 0U;
+  ev |= (tap_src.single_tap != 0U) ? ST1VAFE6AX_EVENT_SINGLE_TAP : 0U;
+  ev |= (tap_src.double_tap != 0U) ? ST1VAFE6AX_EVENT_DOUBLE_TAP : 0U;
+
+  ev |= (emb_func_status_mainpage.is_step_det != 0U) ? ST1VAFE6AX_EVENT_STEP_DET : 0U;
+  ev |= (emb_func_status_mainpage.is_tilt != 0U) ? ST1VAFE6AX_EVENT_TILT : 0U;
+  ev |= (emb_func_status_mainpage.is_sigmot != 0U) ? ST1VAFE6AX_EVENT_SIG_MOT : 0U;
+  ev |= (emb_func_status_mainpage.is_fsm_lc != 0U) ? ST1VAFE6AX_EVENT_FSM_LC : 0U;
+
+  /* FSM_STATUS_MAINPAGE, MLC_STATUS_MAINPAGE: one bit per program */
+  ev |= (uint32_t)src[5] << 16;
+  ev |= ((uint32_t)src[6] & 0x0FU) << 24;
+
+  *val = ev;
 
   return ret;
 }
 
-/**
-  * @brief  Select the us activity time for IBI (In-Band Interrupt) with I3C[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      IBI_2us, IBI_50us, IBI_1ms, IBI_25ms,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_i3c_ibi_time_set(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_i3c_ibi_time_t val)
+/*
+ * all_sources: read the registers of a window flagged in req, contiguous
+ * ones with a single burst. Registers flagged in fill have no side effect
+ * on read and may be read to join two bursts.
+ */
+static int32_t all_sources_read_runs(const stmdev_ctx_t *ctx, uint8_t first,
+                                     uint8_t req, uint8_t fill, uint8_t *buff,
+                                     uint8_t len)
 {
-  st1vafe6ax_ctrl5_t ctrl5 = {0};
-  int32_t ret = {0};
+  uint8_t start;
+  uint8_t end;
+  uint8_t i = 0U;
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
-  if (ret == 0)
+  while ((ret == 0) && (i < len))
   {
-    ctrl5.bus_act_sel = (uint8_t)val & 0x03U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
+    if ((req & (1U << i)) == 0U)
+    {
+      i++;
+      continue;
+    }
+
+    start = i;
+    end = i;
+    for (i++; (i < len) && (((req | fill) & (1U << i)) != 0U); i++)
+    {
+      end = ((req & (1U << i)) != 0U) ? i : end;
+    }
+
+    ret = st1vafe6ax_read_reg(ctx, first + start, &buff[start], (uint16_t)(end - start + 1U));
+    i = end + 1U;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Select the us activity time for IBI (In-Band Interrupt) with I3C[get]
+  * @brief  Get the status of the requested groups of interrupt sources,
+  *         with only the register reads and bank switches they need.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      IBI_2us, IBI_50us, IBI_1ms, IBI_25ms,
+  * @param  groups   bitmask of ST1VAFE6AX_SRC_* groups
+  * @param  val      status of the interrupt sources, the fields of the
+  *                  groups not requested are cleared
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_i3c_ibi_time_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_i3c_ibi_time_t *val)
+int32_t st1vafe6ax_all_sources_sel_get(const stmdev_ctx_t *ctx, uint8_t groups,
+                                       st1vafe6ax_all_sources_t *val)
 {
-  st1vafe6ax_ctrl5_t ctrl5 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_functions_enable_t functions_enable = {0};
+  uint8_t emb_func_exec_status = 0;
+  uint8_t emb_func_src = 0;
+  uint8_t status[4] = {0};
+  uint8_t src[7] = {0};
+  uint8_t req_status = 0U;
+  uint8_t req_src = 0U;
+  uint8_t lir = 0U;
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
-  if (ret != 0)
+  (void)memset(val, 0, sizeof(st1vafe6ax_all_sources_t));
+
+  /* FIFO_STATUS1, FIFO_STATUS2, ALL_INT_SRC, STATUS_REG */
+  req_status |= ((groups & ST1VAFE6AX_SRC_FIFO) != 0U) ? 0x03U : 0x00U;
+  req_status |= ((groups & ST1VAFE6AX_SRC_INT) != 0U) ? 0x04U : 0x00U;
+  req_status |= ((groups & ST1VAFE6AX_SRC_DRDY) != 0U) ? 0x08U : 0x00U;
+
+  /* WAKE_UP_SRC, TAP_SRC, D6D_SRC, -, EMB_FUNC/FSM/MLC_STATUS_MAINPAGE */
+  req_src |= ((groups & ST1VAFE6AX_SRC_WAKE_UP) != 0U) ? 0x01U : 0x00U;
+  req_src |= ((groups & ST1VAFE6AX_SRC_TAP) != 0U) ? 0x02U : 0x00U;
+  req_src |= ((groups & ST1VAFE6AX_SRC_SIX_D) != 0U) ? 0x04U : 0x00U;
+  req_src |= ((groups & ST1VAFE6AX_SRC_EMB) != 0U) ? 0x70U : 0x00U;
+
+  /* reading ALL_INT_SRC must not reset the latched sources read next */
+  lir = (((req_status & 0x04U) != 0U) && ((req_src & 0x07U) != 0U)) ? 1U : 0U;
+
+  if (lir == 1U)
   {
-    return ret;
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+    if (ret == 0)
+    {
+      functions_enable.dis_rst_lir_all_int = PROPERTY_ENABLE;
+      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+    }
   }
 
-  switch (ctrl5.bus_act_sel)
+  if (ret == 0)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_IBI_2us;
-      break;
+    ret = all_sources_read_runs(ctx, ST1VAFE6AX_FIFO_STATUS1, req_status, 0x00U, status, 4);
+  }
 
-    case 0x01:
-      *val = ST1VAFE6AX_IBI_50us;
-      break;
+  if ((ret == 0) && (lir == 1U))
+  {
+    functions_enable.dis_rst_lir_all_int = PROPERTY_DISABLE;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+  }
 
-    case 0x02:
-      *val = ST1VAFE6AX_IBI_1ms;
-      break;
+  if (ret == 0)
+  {
+    ret = all_sources_read_runs(ctx, ST1VAFE6AX_WAKE_UP_SRC, req_src, 0x08U, src, 7);
+  }
 
-    case 0x03:
-      *val = ST1VAFE6AX_IBI_25ms;
-      break;
+  if (ret != 0)
+  {
+    return ret;
+  }
 
-    default:
-      *val = ST1VAFE6AX_IBI_2us;
-      break;
+  all_sources_status_decode(status, val);
+  all_sources_src_decode(src, val);
+
+  if ((groups & ST1VAFE6AX_SRC_EMB_EXT) != 0U)
+  {
+    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+
+    if (ret == 0)
+    {
+      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EXEC_STATUS, &emb_func_exec_status, 1);
+    }
+    if (ret == 0)
+    {
+      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_SRC, &emb_func_src, 1);
+    }
+
+    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+    if (ret != 0)
+    {
+      return ret;
+    }
+
+    all_sources_emb_decode(&emb_func_exec_status, &emb_func_src, val);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Interrupt sources status to ST1VAFE6AX_EVENT_* bitmask.
+  *
+  * @param  val      status of all the interrupt sources
+  * @retval          bitmask of ST1VAFE6AX_EVENT_* flags
+  *
+  */
+uint64_t st1vafe6ax_all_sources_to_mask(const st1vafe6ax_all_sources_t *val)
+{
+  uint64_t mask = 0U;
+
+  mask |= (val->drdy_xl != 0U) ? ST1VAFE6AX_EVENT_DRDY_XL : 0U;
+  mask |= (val->drdy_gy != 0U) ? ST1VAFE6AX_EVENT_DRDY_GY : 0U;
+  mask |= (val->drdy_temp != 0U) ? ST1VAFE6AX_EVENT_DRDY_TEMP : 0U;
+  mask |= (val->drdy_ah_bio != 0U) ? ST1VAFE6AX_EVENT_DRDY_AH_BIO : 0U;
+  mask |= (val->fifo_th != 0U) ? ST1VAFE6AX_EVENT_FIFO_TH : 0U;
+  mask |= (val->fifo_ovr != 0U) ? ST1VAFE6AX_EVENT_FIFO_OVR : 0U;
+  mask |= (val->fifo_full != 0U) ? ST1VAFE6AX_EVENT_FIFO_FULL : 0U;
+  mask |= (val->fifo_bdr != 0U) ? ST1VAFE6AX_EVENT_FIFO_BDR : 0U;
+  mask |= (val->free_fall != 0U) ? ST1VAFE6AX_EVENT_FREE_FALL : 0U;
+  mask |= (val->wake_up != 0U) ? ST1VAFE6AX_EVENT_WAKE_UP : 0U;
+  mask |= (val->single_tap != 0U) ? ST1VAFE6AX_EVENT_SINGLE_TAP : 0U;
+  mask |= (val->double_tap != 0U) ? ST1VAFE6AX_EVENT_DOUBLE_TAP : 0U;
+  mask |= (val->six_d != 0U) ? ST1VAFE6AX_EVENT_SIX_D : 0U;
+  mask |= (val->sleep_change != 0U) ? ST1VAFE6AX_EVENT_SLEEP_CHANGE : 0U;
+  mask |= (val->step_detector != 0U) ? ST1VAFE6AX_EVENT_STEP_DET : 0U;
+  mask |= (val->tilt != 0U) ? ST1VAFE6AX_EVENT_TILT : 0U;
+  mask |= (val->fsm1 != 0U) ? ST1VAFE6AX_EVENT_FSM(1U) : 0U;
+  mask |= (val->fsm2 != 0U) ? ST1VAFE6AX_EVENT_FSM(2U) : 0U;
+  mask |= (val->fsm3 != 0U) ? ST1VAFE6AX_EVENT_FSM(3U) : 0U;
+  mask |= (val->fsm4 != 0U) ? ST1VAFE6AX_EVENT_FSM(4U) : 0U;
+  mask |= (val->fsm5 != 0U) ? ST1VAFE6AX_EVENT_FSM(5U) : 0U;
+  mask |= (val->fsm6 != 0U) ? ST1VAFE6AX_EVENT_FSM(6U) : 0U;
+  mask |= (val->fsm7 != 0U) ? ST1VAFE6AX_EVENT_FSM(7U) : 0U;
+  mask |= (val->fsm8 != 0U) ? ST1VAFE6AX_EVENT_FSM(8U) : 0U;
+  mask |= (val->mlc1 != 0U) ? ST1VAFE6AX_EVENT_MLC(1U) : 0U;
+  mask |= (val->mlc2 != 0U) ? ST1VAFE6AX_EVENT_MLC(2U) : 0U;
+  mask |= (val->mlc3 != 0U) ? ST1VAFE6AX_EVENT_MLC(3U) : 0U;
+  mask |= (val->mlc4 != 0U) ? ST1VAFE6AX_EVENT_MLC(4U) : 0U;
+  mask |= (val->sig_mot != 0U) ? ST1VAFE6AX_EVENT_SIG_MOT : 0U;
+  mask |= (val->fsm_lc != 0U) ? ST1VAFE6AX_EVENT_FSM_LC : 0U;
+  mask |= (val->timestamp != 0U) ? ST1VAFE6AX_EVENT_TIMESTAMP : 0U;
+  mask |= (val->sleep_state != 0U) ? ST1VAFE6AX_EVENT_SLEEP_STATE : 0U;
+  mask |= (val->step_count_inc != 0U) ? ST1VAFE6AX_EVENT_STEP_COUNT_INC : 0U;
+  mask |= (val->step_count_overflow != 0U) ? ST1VAFE6AX_EVENT_STEP_COUNT_OVERFLOW : 0U;
+  mask |= (val->step_on_delta_time != 0U) ? ST1VAFE6AX_EVENT_STEP_ON_DELTA_TIME : 0U;
+  mask |= (val->emb_func_stand_by != 0U) ? ST1VAFE6AX_EVENT_EMB_FUNC_STAND_BY : 0U;
+  mask |= (val->emb_func_time_exceed != 0U) ? ST1VAFE6AX_EVENT_EMB_FUNC_TIME_EXCEED : 0U;
+  mask |= (val->gy_settling != 0U) ? ST1VAFE6AX_EVENT_GY_SETTLING : 0U;
+  mask |= (val->den_flag != 0U) ? ST1VAFE6AX_EVENT_DEN_FLAG : 0U;
+  mask |= (val->wake_up_x != 0U) ? ST1VAFE6AX_EVENT_WAKE_UP_X : 0U;
+  mask |= (val->wake_up_y != 0U) ? ST1VAFE6AX_EVENT_WAKE_UP_Y : 0U;
+  mask |= (val->wake_up_z != 0U) ? ST1VAFE6AX_EVENT_WAKE_UP_Z : 0U;
+  mask |= (val->tap_x != 0U) ? ST1VAFE6AX_EVENT_TAP_X : 0U;
+  mask |= (val->tap_y != 0U) ? ST1VAFE6AX_EVENT_TAP_Y : 0U;
+  mask |= (val->tap_z != 0U) ? ST1VAFE6AX_EVENT_TAP_Z : 0U;
+  mask |= (val->tap_sign != 0U) ? ST1VAFE6AX_EVENT_TAP_SIGN : 0U;
+  mask |= (val->six_d_xl != 0U) ? ST1VAFE6AX_EVENT_SIX_D_XL : 0U;
+  mask |= (val->six_d_xh != 0U) ? ST1VAFE6AX_EVENT_SIX_D_XH : 0U;
+  mask |= (val->six_d_yl != 0U) ? ST1VAFE6AX_EVENT_SIX_D_YL : 0U;
+  mask |= (val->six_d_yh != 0U) ? ST1VAFE6AX_EVENT_SIX_D_YH : 0U;
+  mask |= (val->six_d_zl != 0U) ? ST1VAFE6AX_EVENT_SIX_D_ZL : 0U;
+  mask |= (val->six_d_zh != 0U) ? ST1VAFE6AX_EVENT_SIX_D_ZH : 0U;
+
+  return mask;
+}
+
+/**
+  * @brief  ST1VAFE6AX_EVENT_* bitmask to interrupt sources status.
+  *
+  * @param  mask     bitmask of ST1VAFE6AX_EVENT_* flags
+  * @param  val      status of all the interrupt sources
+  *
+  */
+void st1vafe6ax_all_sources_from_mask(uint64_t mask, st1vafe6ax_all_sources_t *val)
+{
+  val->drdy_xl = ((mask & ST1VAFE6AX_EVENT_DRDY_XL) != 0U) ? 1U : 0U;
+  val->drdy_gy = ((mask & ST1VAFE6AX_EVENT_DRDY_GY) != 0U) ? 1U : 0U;
+  val->drdy_temp = ((mask & ST1VAFE6AX_EVENT_DRDY_TEMP) != 0U) ? 1U : 0U;
+  val->drdy_ah_bio = ((mask & ST1VAFE6AX_EVENT_DRDY_AH_BIO) != 0U) ? 1U : 0U;
+  val->fifo_th = ((mask & ST1VAFE6AX_EVENT_FIFO_TH) != 0U) ? 1U : 0U;
+  val->fifo_ovr = ((mask & ST1VAFE6AX_EVENT_FIFO_OVR) != 0U) ? 1U : 0U;
+  val->fifo_full = ((mask & ST1VAFE6AX_EVENT_FIFO_FULL) != 0U) ? 1U : 0U;
+  val->fifo_bdr = ((mask & ST1VAFE6AX_EVENT_FIFO_BDR) != 0U) ? 1U : 0U;
+  val->free_fall = ((mask & ST1VAFE6AX_EVENT_FREE_FALL) != 0U) ? 1U : 0U;
+  val->wake_up = ((mask & ST1VAFE6AX_EVENT_WAKE_UP) != 0U) ? 1U : 0U;
+  val->single_tap = ((mask & ST1VAFE6AX_EVENT_SINGLE_TAP) != 0U) ? 1U : 0U;
+  val->double_tap = ((mask & ST1VAFE6AX_EVENT_DOUBLE_TAP) != 0U) ? 1U : 0U;
+  val->six_d = ((mask & ST1VAFE6AX_EVENT_SIX_D) != 0U) ? 1U : 0U;
+  val->sleep_change = ((mask & ST1VAFE6AX_EVENT_SLEEP_CHANGE) != 0U) ? 1U : 0U;
+  val->step_detector = ((mask & ST1VAFE6AX_EVENT_STEP_DET) != 0U) ? 1U : 0U;
+  val->tilt = ((mask & ST1VAFE6AX_EVENT_TILT) != 0U) ? 1U : 0U;
+  val->fsm1 = ((mask & ST1VAFE6AX_EVENT_FSM(1U)) != 0U) ? 1U : 0U;
+  val->fsm2 = ((mask & ST1VAFE6AX_EVENT_FSM(2U)) != 0U) ? 1U : 0U;
+  val->fsm3 = ((mask & ST1VAFE6AX_EVENT_FSM(3U)) != 0U) ? 1U : 0U;
+  val->fsm4 = ((mask & ST1VAFE6AX_EVENT_FSM(4U)) != 0U) ? 1U : 0U;
+  val->fsm5 = ((mask & ST1VAFE6AX_EVENT_FSM(5U)) != 0U) ? 1U : 0U;
+  val->fsm6 = ((mask & ST1VAFE6AX_EVENT_FSM(6U)) != 0U) ? 1U : 0U;
+  val->fsm7 = ((mask & ST1VAFE6AX_EVENT_FSM(7U)) != 0U) ? 1U : 0U;
+  val->fsm8 = ((mask & ST1VAFE6AX_EVENT_FSM(8U)) != 0U) ? 1U : 0U;
+  val->mlc1 = ((mask & ST1VAFE6AX_EVENT_MLC(1U)) != 0U) ? 1U : 0U;
+  val->mlc2 = ((mask & ST1VAFE6AX_EVENT_MLC(2U)) != 0U) ? 1U : 0U;
+  val->mlc3 = ((mask & ST1VAFE6AX_EVENT_MLC(3U)) != 0U) ? 1U : 0U;
+  val->mlc4 = ((mask & ST1VAFE6AX_EVENT_MLC(4U)) != 0U) ? 1U : 0U;
+  val->sig_mot = ((mask & ST1VAFE6AX_EVENT_SIG_MOT) != 0U) ? 1U : 0U;
+  val->fsm_lc = ((mask & ST1VAFE6AX_EVENT_FSM_LC) != 0U) ? 1U : 0U;
+  val->timestamp = ((mask & ST1VAFE6AX_EVENT_TIMESTAMP) != 0U) ? 1U : 0U;
+  val->sleep_state = ((mask & ST1VAFE6AX_EVENT_SLEEP_STATE) != 0U) ? 1U : 0U;
+  val->step_count_inc = ((mask & ST1VAFE6AX_EVENT_STEP_COUNT_INC) != 0U) ? 1U : 0U;
+  val->step_count_overflow = ((mask & ST1VAFE6AX_EVENT_STEP_COUNT_OVERFLOW) != 0U) ? 1U : 0U;
+  val->step_on_delta_time = ((mask & ST1VAFE6AX_EVENT_STEP_ON_DELTA_TIME) != 0U) ? 1U : 0U;
+  val->emb_func_stand_by = ((mask & ST1VAFE6AX_EVENT_EMB_FUNC_STAND_BY) != 0U) ? 1U : 0U;
+  val->emb_func_time_exceed = ((mask & ST1VAFE6AX_EVENT_EMB_FUNC_TIME_EXCEED) != 0U) ? 1U : 0U;
+  val->gy_settling = ((mask & ST1VAFE6AX_EVENT_GY_SETTLING) != 0U) ? 1U : 0U;
+  val->den_flag = ((mask & ST1VAFE6AX_EVENT_DEN_FLAG) != 0U) ? 1U : 0U;
+  val->wake_up_x = ((mask & ST1VAFE6AX_EVENT_WAKE_UP_X) != 0U) ? 1U : 0U;
+  val->wake_up_y = ((mask & ST1VAFE6AX_EVENT_WAKE_UP_Y) != 0U) ? 1U : 0U;
+  val->wake_up_z = ((mask & ST1VAFE6AX_EVENT_WAKE_UP_Z) != 0U) ? 1U : 0U;
+  val->tap_x = ((mask & ST1VAFE6AX_EVENT_TAP_X) != 0U) ? 1U : 0U;
+  val->tap_y = ((mask & ST1VAFE6AX_EVENT_TAP_Y) != 0U) ? 1U : 0U;
+  val->tap_z = ((mask & ST1VAFE6AX_EVENT_TAP_Z) != 0U) ? 1U : 0U;
+  val->tap_sign = ((mask & ST1VAFE6AX_EVENT_TAP_SIGN) != 0U) ? 1U : 0U;
+  val->six_d_xl = ((mask & ST1VAFE6AX_EVENT_SIX_D_XL) != 0U) ? 1U : 0U;
+  val->six_d_xh = ((mask & ST1VAFE6AX_EVENT_SIX_D_XH) != 0U) ? 1U : 0U;
+  val->six_d_yl = ((mask & ST1VAFE6AX_EVENT_SIX_D_YL) != 0U) ? 1U : 0U;
+  val->six_d_yh = ((mask & ST1VAFE6AX_EVENT_SIX_D_YH) != 0U) ? 1U : 0U;
+  val->six_d_zl = ((mask & ST1VAFE6AX_EVENT_SIX_D_ZL) != 0U) ? 1U : 0U;
+  val->six_d_zh = ((mask & ST1VAFE6AX_EVENT_SIX_D_ZH) != 0U) ? 1U : 0U;
+}
+
+/**
+  * @brief  Get the status of all the interrupt sources, as
+  *         ST1VAFE6AX_EVENT_* bitmask.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      bitmask of the active interrupt sources
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_all_sources_mask_get(const stmdev_ctx_t *ctx, uint64_t *val)
+{
+  st1vafe6ax_all_sources_t all_sources = {0};
+  int32_t ret;
+
+  ret = st1vafe6ax_all_sources_get(ctx, &all_sources);
+  if (ret == 0)
+  {
+    *val = st1vafe6ax_all_sources_to_mask(&all_sources);
   }
+
   return ret;
 }
 
-/**
-  * @}
-  *
-  */
+int32_t st1vafe6ax_flag_data_ready_get(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_data_ready_t *val)
+{
+  st1vafe6ax_status_reg_t status = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_STATUS_REG, (uint8_t *)&status, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  val->drdy_xl = status.xlda;
+  val->drdy_gy = status.gda;
+  val->drdy_temp = status.tda;
+  val->drdy_ah_bio = status.ah_bioda;
+
+  return ret;
+}
 
 /**
-  * @defgroup  Interrupt pins
-  * @brief     This section groups all the functions that manage interrupt pins
-  * @{
+  * @brief  Temperature data output register[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Temperature data output register
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
+int32_t st1vafe6ax_temperature_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_OUT_TEMP_L, &buff[0], 2);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+
+  return ret;
+}
 
 /**
-  * @brief  Push-pull/open-drain selection on INT1 and INT2 pins.[set]
+  * @brief  Angular rate sensor.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      PUSH_PULL, OPEN_DRAIN,
+  * @param  val      Angular rate sensor.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_int_pin_mode_set(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_int_pin_mode_t val)
+int32_t st1vafe6ax_angular_rate_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
 {
-  st1vafe6ax_if_cfg_t if_cfg = {0};
+  uint8_t buff[6] = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_OUTX_L_G, &buff[0], 6);
+  if (ret != 0)
   {
-    if_cfg.pp_od = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+    return ret;
   }
 
+  val[0] = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  val[1] = (int16_t)(buff[2] | ((uint16_t)buff[3] << 8));
+  val[2] = (int16_t)(buff[4] | ((uint16_t)buff[5] << 8));
+
   return ret;
 }
 
 /**
-  * @brief  Push-pull/open-drain selection on INT1 and INT2 pins.[get]
+  * @brief  Linear acceleration sensor.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      PUSH_PULL, OPEN_DRAIN,
+  * @param  val      Linear acceleration sensor.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_int_pin_mode_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_int_pin_mode_t *val)
+int32_t st1vafe6ax_acceleration_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
 {
-  st1vafe6ax_if_cfg_t if_cfg = {0};
+  uint8_t buff[6] = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_OUTZ_L_A, &buff[0], 6);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (if_cfg.pp_od)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_PUSH_PULL;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_OPEN_DRAIN;
-      break;
+  val[2] = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  val[1] = (int16_t)(buff[2] | ((uint16_t)buff[3] << 8));
+  val[0] = (int16_t)(buff[4] | ((uint16_t)buff[5] << 8));
 
-    default:
-      *val = ST1VAFE6AX_PUSH_PULL;
-      break;
-  }
   return ret;
 }
 
 /**
-  * @brief  Interrupt activation level.[set]
+  * @brief  Linear acceleration sensor for Dual channel mode.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ACTIVE_HIGH, ACTIVE_LOW,
+  * @param  val      Linear acceleration sensor or Dual channel mode.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_pin_polarity_set(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_pin_polarity_t val)
+int32_t st1vafe6ax_dual_acceleration_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
 {
-  st1vafe6ax_if_cfg_t if_cfg = {0};
+  uint8_t buff[6] = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_UI_OUTZ_L_A_DUALC, &buff[0], 6);
+  if (ret != 0)
   {
-    if_cfg.h_lactive = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+    return ret;
   }
 
+  val[2] = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  val[1] = (int16_t)(buff[2] | ((uint16_t)buff[3] << 8));
+  val[0] = (int16_t)(buff[4] | ((uint16_t)buff[5] << 8));
+
   return ret;
 }
 
 /**
-  * @brief  Interrupt activation level.[get]
+  * @brief  Bio data output register.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ACTIVE_HIGH, ACTIVE_LOW,
+  * @param  val      Bio data output register.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_pin_polarity_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_pin_polarity_t *val)
+int32_t st1vafe6ax_ah_bio_raw_get(const stmdev_ctx_t *ctx, int16_t *val)
 {
-  st1vafe6ax_if_cfg_t if_cfg = {0};
+  uint8_t buff[2] = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_AH_BIO_OUT_L, &buff[0], 2);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (if_cfg.h_lactive)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_ACTIVE_HIGH;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_ACTIVE_LOW;
-      break;
+  *val = (int16_t)(buff[0] | ((uint16_t)buff[1] << 8));
 
-    default:
-      *val = ST1VAFE6AX_ACTIVE_HIGH;
-      break;
-  }
   return ret;
 }
 
 /**
-  * @brief  It routes interrupt signals on INT 1 pin.[set]
+  * @brief  Difference in percentage of the effective ODR (and timestamp rate) with respect to the typical. Step: 0.13%. 8-bit format, 2's complement.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      It routes interrupt signals on INT 1 pin.
+  * @param  val      Difference in percentage of the effective ODR (and timestamp rate) with respect to the typical. Step: 0.13%. 8-bit format, 2's complement.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_pin_int1_route_set(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_pin_int_route_t val)
+int32_t st1vafe6ax_odr_cal_reg_get(const stmdev_ctx_t *ctx, int8_t *val)
 {
-  st1vafe6ax_functions_enable_t functions_enable = {0};
-  st1vafe6ax_pin_int_route_t  pin_int2_route = {0};
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
-  st1vafe6ax_emb_func_int1_t emb_func_int1 = {0};
-  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
-  st1vafe6ax_int2_ctrl_t int2_ctrl = {0};
-  st1vafe6ax_int1_ctrl_t int1_ctrl = {0};
-  st1vafe6ax_fsm_int1_t fsm_int1 = {0};
-  st1vafe6ax_mlc_int1_t mlc_int1 = {0};
-  st1vafe6ax_md1_cfg_t md1_cfg = {0};
-  st1vafe6ax_md2_cfg_t md2_cfg = {0};
-  st1vafe6ax_ctrl4_t ctrl4 = {0};
+  st1vafe6ax_internal_freq_t internal_freq = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INTERNAL_FREQ, (uint8_t *)&internal_freq, 1);
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1);
+    return ret;
   }
-  if (ret == 0)
+
+  *val = (int8_t)internal_freq.freq_fine;
+
+  return ret;
+}
+
+/* Embedded page access: back to the main bank, restore CTRL3.IF_INC */
+static int32_t ln_pg_main(const stmdev_ctx_t *ctx, const uint8_t *save)
+{
+  st1vafe6ax_ctrl3_t ctrl3 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  bytecpy((uint8_t *)&ctrl3, &save[1]);
+  if (ctrl3.if_inc == PROPERTY_ENABLE)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_INT1, (uint8_t *)&fsm_int1, 1);
+    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
   }
-  if (ret == 0)
+
+  return ret;
+}
+
+/*
+ * Embedded page access: clear CTRL3.IF_INC if multi-byte transfers are
+ * needed (all the bytes then go to PAGE_VALUE), select the embedded bank
+ * and enable page read or write. save[0] / save[1] keep PAGE_RW / CTRL3.
+ */
+static int32_t ln_pg_begin(const stmdev_ctx_t *ctx, uint8_t write,
+                           uint8_t multi, uint8_t *save)
+{
+  st1vafe6ax_page_rw_t page_rw = {0};
+  st1vafe6ax_ctrl3_t ctrl3 = {0};
+  int32_t ret = {0};
+
+  save[1] = 0U;
+  if (multi == 1U)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_INT1, (uint8_t *)&mlc_int1, 1);
+    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+    if (ret != 0)
+    {
+      return ret;
+    }
+    if (ctrl3.if_inc == PROPERTY_ENABLE)
+    {
+      ctrl3.if_inc = PROPERTY_DISABLE;
+      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+      if (ret != 0)
+      {
+        return ret;
+      }
+      ctrl3.if_inc = PROPERTY_ENABLE;
+    }
+    bytecpy(&save[1], (uint8_t *)&ctrl3);
   }
 
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
   if (ret == 0)
   {
-    emb_func_int1.int1_step_detector = val.step_detector;
-    emb_func_int1.int1_tilt = val.tilt;
-    emb_func_int1.int1_sig_mot = val.sig_mot;
-    emb_func_int1.int1_fsm_lc = val.fsm_lc;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1);
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
   }
   if (ret == 0)
   {
-    fsm_int1.int1_fsm1 = val.fsm1;
-    fsm_int1.int1_fsm2 = val.fsm2;
-    fsm_int1.int1_fsm3 = val.fsm3;
-    fsm_int1.int1_fsm4 = val.fsm4;
-    fsm_int1.int1_fsm5 = val.fsm5;
-    fsm_int1.int1_fsm6 = val.fsm6;
-    fsm_int1.int1_fsm7 = val.fsm7;
-    fsm_int1.int1_fsm8 = val.fsm8;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FSM_INT1, (uint8_t *)&fsm_int1, 1);
+    bytecpy(&save[0], (uint8_t *)&page_rw);
+    if (write == 0U)
+    {
+      page_rw.page_read = PROPERTY_ENABLE;
+      page_rw.page_write = PROPERTY_DISABLE;
+    }
+    else
+    {
+      page_rw.page_read = PROPERTY_DISABLE;
+      page_rw.page_write = PROPERTY_ENABLE;
+    }
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
   }
-  if (ret == 0)
+
+  if (ret != 0)
   {
-    mlc_int1.int1_mlc1 = val.mlc1;
-    mlc_int1.int1_mlc2 = val.mlc2;
-    mlc_int1.int1_mlc3 = val.mlc3;
-    mlc_int1.int1_mlc4 = val.mlc4;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_MLC_INT1, (uint8_t *)&mlc_int1, 1);
+    ret += ln_pg_main(ctx, save);
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  return ret;
+}
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
-  }
-  if (ret == 0)
-  {
-    if ((val.emb_func_stand_by | val.timestamp) != PROPERTY_DISABLE)
-    {
-      ctrl4.int2_on_int1 = PROPERTY_ENABLE;
-    }
-    else
-    {
-      ctrl4.int2_on_int1 = PROPERTY_DISABLE;
-    }
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
-  }
+/* Loaders: max number of bytes written / read back with one transaction */
+#define ST1VAFE6AX_PG_CHUNK                      64U
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-  }
+/* Embedded page access: select the page and the address in it */
+static int32_t ln_pg_seek(const stmdev_ctx_t *ctx, uint16_t address)
+{
+  st1vafe6ax_page_address_t  page_address = {0};
+  st1vafe6ax_page_sel_t page_sel = {0};
+  int32_t ret = {0};
 
-  if (ret == 0)
-  {
-    int2_ctrl.int2_emb_func_endop = val.emb_func_stand_by;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-  }
+  /* select page */
+  page_sel.page_sel = (uint8_t)(address >> 8) & 0x0FU;
+  page_sel.not_used0 = 1U; // Default value
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel, 1);
 
+  /* set page addr */
+  page_address.page_addr = (uint8_t)address & 0xFFU;
+  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_ADDRESS,
+                              (uint8_t *)&page_address, 1);
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
-  }
+  return ret;
+}
 
-  if (ret == 0)
-  {
-    md2_cfg.int2_timestamp = val.timestamp;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
-  }
+/* Embedded page access: next page, where the address wraps to 0 */
+static int32_t ln_pg_next(const stmdev_ctx_t *ctx, uint8_t msb)
+{
+  st1vafe6ax_page_sel_t page_sel = {0};
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
-  }
+  page_sel.page_sel = msb & 0x0FU;
+  page_sel.not_used0 = 1U; // Default value
 
-  if (ret == 0)
-  {
-    inactivity_dur.sleep_status_on_int = val.sleep_status;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
-  }
+  return st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel, 1);
+}
 
+/* Embedded page access: one PAGE_VALUE transfer per page */
+static int32_t ln_pg_xfer(const stmdev_ctx_t *ctx, uint16_t address,
+                          uint8_t *buf, uint16_t len, uint8_t write)
+{
+  uint16_t done = {0};
+  uint16_t num = {0};
+  uint8_t msb = {0};
+  uint8_t lsb = {0};
+  int32_t ret = {0};
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  }
+  msb = ((uint8_t)(address >> 8) & 0x0FU);
+  lsb = (uint8_t)address & 0xFFU;
 
-  if (ret == 0)
-  {
-    int1_ctrl.int1_drdy_xl = val.drdy_xl;
-    int1_ctrl.int1_drdy_g = val.drdy_gy;
-    int1_ctrl.int1_fifo_th = val.fifo_th;
-    int1_ctrl.int1_fifo_ovr = val.fifo_ovr;
-    int1_ctrl.int1_fifo_full = val.fifo_full;
-    int1_ctrl.int1_cnt_bdr = val.fifo_bdr;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-  }
+  ret = ln_pg_seek(ctx, address);
 
-  if (ret == 0)
+  while ((ret == 0) && (done < len))
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD1_CFG, (uint8_t *)&md1_cfg, 1);
-  }
+    /* up to the page boundary, where the address wraps to 0 */
+    num = 0x100U - (uint16_t)lsb;
+    num = ((len - done) < num) ? (uint16_t)(len - done) : num;
 
-  if (ret == 0)
-  {
-    if ((emb_func_int1.int1_fsm_lc
-         | emb_func_int1.int1_sig_mot
-         | emb_func_int1.int1_step_detector
-         | emb_func_int1.int1_tilt
-         | fsm_int1.int1_fsm1
-         | fsm_int1.int1_fsm2
-         | fsm_int1.int1_fsm3
-         | fsm_int1.int1_fsm4
-         | fsm_int1.int1_fsm5
-         | fsm_int1.int1_fsm6
-         | fsm_int1.int1_fsm7
-         | fsm_int1.int1_fsm8
-         | mlc_int1.int1_mlc1
-         | mlc_int1.int1_mlc2
-         | mlc_int1.int1_mlc3
-         | mlc_int1.int1_mlc4) != PROPERTY_DISABLE)
+    if (write == 0U)
     {
-      md1_cfg.int1_emb_func = PROPERTY_ENABLE;
+      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_VALUE, &buf[done], num);
     }
     else
     {
-      md1_cfg.int1_emb_func = PROPERTY_DISABLE;
+      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_VALUE, &buf[done], num);
     }
-    md1_cfg.int1_6d = val.six_d;
-    md1_cfg.int1_double_tap = val.double_tap;
-    md1_cfg.int1_ff = val.free_fall;
-    md1_cfg.int1_wu = val.wake_up;
-    md1_cfg.int1_single_tap = val.single_tap;
-    if ((val.sleep_status | val.sleep_change) != PROPERTY_DISABLE)
-    {
-      md1_cfg.int1_sleep_change = PROPERTY_ENABLE;
-    }
-    else
+    done += num;
+    lsb = 0U;
+
+    /* next page */
+    if ((ret == 0) && (done < len))
     {
-      md1_cfg.int1_sleep_change = PROPERTY_DISABLE;
+      msb++;
+      ret = ln_pg_next(ctx, msb);
     }
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_MD1_CFG, (uint8_t *)&md1_cfg, 1);
   }
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
-  }
+  return ret;
+}
 
-  if (ret == 0)
-  {
-    pedo_cmd_reg.carry_count_en = val.step_count_overflow;
-    ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
-  }
+/*
+ * Embedded page access: write of a read-only buffer, copied to the stack
+ * by transfers of up to ST1VAFE6AX_PG_CHUNK bytes.
+ */
+static int32_t ln_pg_xfer_const(const stmdev_ctx_t *ctx, uint16_t address,
+                                const uint8_t *buf, uint16_t len)
+{
+  uint8_t copy[ST1VAFE6AX_PG_CHUNK];
+  uint16_t done = {0};
+  uint16_t num = {0};
+  uint8_t msb = {0};
+  uint8_t lsb = {0};
+  int32_t ret = {0};
 
+  msb = ((uint8_t)(address >> 8) & 0x0FU);
+  lsb = (uint8_t)address & 0xFFU;
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_pin_int2_route_get(ctx, &pin_int2_route);
-  }
+  ret = ln_pg_seek(ctx, address);
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
-  }
-  if (ret == 0)
+  while ((ret == 0) && (done < len))
   {
-    if ((pin_int2_route.six_d
-         | pin_int2_route.double_tap
-         | pin_int2_route.free_fall
-         | pin_int2_route.wake_up
-         | pin_int2_route.single_tap
-         | pin_int2_route.sleep_status
-         | pin_int2_route.sleep_change
-         | val.six_d
-         | val.double_tap
-         | val.free_fall
-         | val.wake_up
-         | val.single_tap
-         | val.sleep_status
-         | val.sleep_change) != PROPERTY_DISABLE)
-    {
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
-    }
+    /* up to the page boundary, where the address wraps to 0 */
+    num = 0x100U - (uint16_t)lsb;
+    num = ((len - done) < num) ? (uint16_t)(len - done) : num;
+    num = (num > ST1VAFE6AX_PG_CHUNK) ? ST1VAFE6AX_PG_CHUNK : num;
 
-    else
+    (void)memcpy(copy, &buf[done], num);
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_VALUE, copy, num);
+    done += num;
+    lsb = (uint8_t)(lsb + num);
+
+    /* next page */
+    if ((ret == 0) && (done < len) && (lsb == 0U))
     {
-      functions_enable.interrupts_enable = PROPERTY_DISABLE;
+      msb++;
+      ret = ln_pg_next(ctx, msb);
     }
+  }
 
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+  return ret;
+}
+
+/* Embedded page access: reset PAGE_SEL and PAGE_RW, back to the main bank */
+static int32_t ln_pg_end(const stmdev_ctx_t *ctx, const uint8_t *save)
+{
+  st1vafe6ax_page_sel_t page_sel = {0};
+  st1vafe6ax_page_rw_t page_rw = {0};
+  int32_t ret = {0};
+
+  page_sel.page_sel = 0U;
+  page_sel.not_used0 = 1U;// Default value
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_SEL, (uint8_t *)&page_sel, 1);
+
+  /* unset page read / write */
+  bytecpy((uint8_t *)&page_rw, &save[0]);
+  page_rw.page_read = PROPERTY_DISABLE;
+  page_rw.page_write = PROPERTY_DISABLE;
+  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
+
+  ret += ln_pg_main(ctx, save);
+
+  return ret;
+}
+
+/* Embedded page access with a single run per page, CTRL3.IF_INC cleared */
+static int32_t ln_pg_access(const stmdev_ctx_t *ctx, uint16_t address,
+                            uint8_t *buf, uint16_t len, uint8_t write)
+{
+  uint8_t save[2];
+  int32_t ret;
+
+  ret = ln_pg_begin(ctx, write, (len > 1U) ? 1U : 0U, save);
+  if (ret != 0)
+  {
+    return ret;
   }
 
+  ret = ln_pg_xfer(ctx, address, buf, len, write);
+  ret += ln_pg_end(ctx, save);
+
   return ret;
 }
 
 /**
-  * @brief  It routes interrupt signals on INT 1 pin.[get]
+  * @brief  Write buffer in a page.[set]
+  *         Each run up to the page boundary is written with a single
+  *         PAGE_VALUE transfer (CTRL3.IF_INC is cleared meanwhile).
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      It routes interrupt signals on INT 1 pin.
+  * @param  address  page (bits 11:8) and page address (bits 7:0)
+  * @param  buf      data to write
+  * @param  len      number of bytes, the page is advanced on wrap
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_pin_int1_route_get(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_pin_int_route_t *val)
+int32_t st1vafe6ax_ln_pg_write(const stmdev_ctx_t *ctx, uint16_t address,
+                               uint8_t *buf, uint16_t len)
 {
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
-  st1vafe6ax_emb_func_int1_t emb_func_int1 = {0};
-  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
-  st1vafe6ax_int1_ctrl_t int1_ctrl = {0};
-  st1vafe6ax_int2_ctrl_t int2_ctrl = {0};
-  st1vafe6ax_fsm_int1_t fsm_int1 = {0};
-  st1vafe6ax_mlc_int1_t mlc_int1 = {0};
-  st1vafe6ax_md1_cfg_t md1_cfg = {0};
-  st1vafe6ax_md2_cfg_t md2_cfg = {0};
-  st1vafe6ax_ctrl4_t ctrl4 = {0};
-  int32_t ret = {0};
+  return ln_pg_access(ctx, address, buf, len, 1U);
+}
 
+/**
+  * @brief  Read buffer in a page.[get]
+  *         Each run up to the page boundary is read with a single
+  *         PAGE_VALUE transfer (CTRL3.IF_INC is cleared meanwhile).
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  address  page (bits 11:8) and page address (bits 7:0)
+  * @param  buf      buffer that stores the data read
+  * @param  len      number of bytes, the page is advanced on wrap
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_ln_pg_read(const stmdev_ctx_t *ctx, uint16_t address,
+                              uint8_t *buf, uint16_t len)
+{
+  return ln_pg_access(ctx, address, buf, len, 0U);
+}
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
-  if (ctrl4.int2_on_int1 == PROPERTY_ENABLE)
+/* UCF loader: the embedded bank segment starting at line i writes PAGE_VALUE more than once */
+static uint8_t ucf_page_stream(const ucf_line_t *lines, uint32_t num, uint32_t i)
+{
+  uint8_t cnt = 0U;
+
+  while ((i < num) && (lines[i].address != ST1VAFE6AX_FUNC_CFG_ACCESS))
   {
-    if (ret == 0)
+    if (lines[i].address == ST1VAFE6AX_PAGE_VALUE)
     {
-      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
+      cnt++;
+      if (cnt > 1U)
+      {
+        return 1U;
+      }
     }
+    i++;
+  }
 
-    if (ret == 0)
+  return 0U;
+}
+
+/* UCF verify: line i is the last write of its register in its memory bank */
+static uint8_t ucf_last_write(const ucf_line_t *lines, uint32_t num, uint32_t i,
+                              uint8_t bank)
+{
+  uint8_t reg = lines[i].address;
+  uint8_t cur = bank;
+
+  for (i++; i < num; i++)
+  {
+    if (lines[i].address == ST1VAFE6AX_FUNC_CFG_ACCESS)
     {
-      val->emb_func_stand_by = int2_ctrl.int2_emb_func_endop;
-      val->timestamp = md2_cfg.int2_timestamp;
+      cur = ((lines[i].data & 0x04U) != 0U) ? 0x00U : lines[i].data;
+    }
+    else if ((lines[i].address == reg) && ((cur & 0xF0U) == (bank & 0xF0U)))
+    {
+      return 0U;
+    }
+    else
+    {
+      /* other register */
     }
   }
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD1_CFG, (uint8_t *)&md1_cfg, 1);
-  }
+  return 1U;
+}
 
+/* UCF verify: configuration register whose value can be read back */
+static uint8_t ucf_verifiable(uint8_t bank, uint8_t reg)
+{
+  uint8_t g;
 
-  if (ret == 0)
+  if ((bank & 0xF0U) == 0x00U)
   {
-    val->sleep_status = inactivity_dur.sleep_status_on_int;
-
-    val->drdy_xl   = int1_ctrl.int1_drdy_xl;
-    val->drdy_gy   = int1_ctrl.int1_drdy_g;
-    val->fifo_th   = int1_ctrl.int1_fifo_th;
-    val->fifo_ovr  = int1_ctrl.int1_fifo_ovr;
-    val->fifo_full = int1_ctrl.int1_fifo_full;
-    val->fifo_bdr  = int1_ctrl.int1_cnt_bdr;
-
-    val->six_d        = md1_cfg.int1_6d;
-    val->double_tap   = md1_cfg.int1_double_tap;
-    val->free_fall    = md1_cfg.int1_ff;
-    val->wake_up      = md1_cfg.int1_wu;
-    val->single_tap   = md1_cfg.int1_single_tap;
-    val->sleep_change = md1_cfg.int1_sleep_change;
+    return ((reg < ST1VAFE6AX_SHADOW_SIZE) && (reg != ST1VAFE6AX_FUNC_CFG_ACCESS) &&
+            (reg != ST1VAFE6AX_CTRL3)) ? shadow_bit(shadow_map, reg) : 0U;
   }
 
-  if (ret == 0)
+  for (g = 0U; ((bank & 0xF0U) == 0x80U) && (g < (sizeof(rd_group) / sizeof(rd_group[0]))); g++)
   {
-    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-
-    if (ret == 0)
+    if ((rd_group[g][0] == 0x80U) && (reg >= rd_group[g][1]) && (reg <= rd_group[g][2]))
     {
-      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1);
-      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_INT1, (uint8_t *)&fsm_int1, 1);
-      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_INT1, (uint8_t *)&mlc_int1, 1);
+      return 1U;
     }
+  }
 
-    if (ret == 0)
-    {
-      val->step_detector = emb_func_int1.int1_step_detector;
-      val->tilt          = emb_func_int1.int1_tilt;
-      val->sig_mot       = emb_func_int1.int1_sig_mot;
-      val->fsm_lc        = emb_func_int1.int1_fsm_lc;
+  return 0U;
+}
 
-      val->fsm1 = fsm_int1.int1_fsm1;
-      val->fsm2 = fsm_int1.int1_fsm2;
-      val->fsm3 = fsm_int1.int1_fsm3;
-      val->fsm4 = fsm_int1.int1_fsm4;
-      val->fsm5 = fsm_int1.int1_fsm5;
-      val->fsm6 = fsm_int1.int1_fsm6;
-      val->fsm7 = fsm_int1.int1_fsm7;
-      val->fsm8 = fsm_int1.int1_fsm8;
+/*
+ * UCF verify: follow the bank / page selection of the lines. Returns the
+ * embedded page address written by line i (PAGE_VALUE at a known location),
+ * 0xFFFF otherwise.
+ */
+static uint16_t ucf_page_track(const ucf_line_t *line, uint8_t *bank,
+                               uint16_t *page_sel, uint16_t *page_addr)
+{
+  uint16_t address = 0xFFFFU;
 
-      val->mlc1 = mlc_int1.int1_mlc1;
-      val->mlc2 = mlc_int1.int1_mlc2;
-      val->mlc3 = mlc_int1.int1_mlc3;
-      val->mlc4 = mlc_int1.int1_mlc4;
+  if (line->address == ST1VAFE6AX_FUNC_CFG_ACCESS)
+  {
+    *bank = ((line->data & 0x04U) != 0U) ? 0x00U : line->data;
+    *page_sel = 0x100U;
+    *page_addr = 0x100U;
+  }
+  else if ((*bank & 0xF0U) != 0x80U)
+  {
+    /* main bank */
+  }
+  else if (line->address == ST1VAFE6AX_PAGE_SEL)
+  {
+    if (line->data != *page_sel)
+    {
+      *page_sel = line->data;
+      *page_addr = 0x100U;
     }
-
-    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
   }
-
-  if (ret == 0)
+  else if (line->address == ST1VAFE6AX_PAGE_ADDRESS)
   {
-    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
+    *page_addr = line->data;
   }
-
-  if (ret == 0)
+  else if ((line->address == ST1VAFE6AX_PAGE_VALUE) && (*page_sel <= 0xFFU) &&
+           (*page_addr <= 0xFFU))
   {
-    val->step_count_overflow = pedo_cmd_reg.carry_count_en;
+    address = (uint16_t)(((*page_sel & 0xF0U) << 4) + *page_addr);
+    *page_addr += 1U;
+  }
+  else
+  {
+    /* other embedded functions register */
   }
 
-  return ret;
+  return address;
 }
 
+/* UCF verify: last value written by the lines at an embedded page address */
+static uint8_t ucf_page_byte(const ucf_line_t *lines, uint32_t num, uint8_t bank,
+                             uint16_t address, uint8_t *val)
+{
+  uint16_t page_sel = 0x100U;
+  uint16_t page_addr = 0x100U;
+  uint8_t found = 0U;
+  uint32_t i;
 
-/**
-  * @brief  It routes interrupt signals on INT 2 pin.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      It routes interrupt signals on INT 2 pin.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_pin_int2_route_set(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_pin_int_route_t val)
-{
-  st1vafe6ax_functions_enable_t functions_enable = {0};
-  st1vafe6ax_pin_int_route_t  pin_int1_route = {0};
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
-  st1vafe6ax_emb_func_int2_t emb_func_int2 = {0};
-  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
-  st1vafe6ax_int2_ctrl_t int2_ctrl = {0};
-  st1vafe6ax_fsm_int2_t fsm_int2 = {0};
-  st1vafe6ax_mlc_int2_t mlc_int2 = {0};
-  st1vafe6ax_ctrl7_t ctrl7 = {0};
-  st1vafe6ax_md2_cfg_t md2_cfg = {0};
-  st1vafe6ax_ctrl4_t ctrl4 = {0};
-  int32_t ret = {0};
-
-
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  for (i = 0U; i < num; i++)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_INT2, (uint8_t *)&fsm_int2, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_INT2, (uint8_t *)&mlc_int2, 1);
+    if (ucf_page_track(&lines[i], &bank, &page_sel, &page_addr) == address)
+    {
+      *val = lines[i].data;
+      found = 1U;
+    }
   }
 
-  if (ret == 0)
-  {
-    emb_func_int2.int2_step_detector = val.step_detector;
-    emb_func_int2.int2_tilt = val.tilt;
-    emb_func_int2.int2_sig_mot = val.sig_mot;
-    emb_func_int2.int2_fsm_lc = val.fsm_lc;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1);
-  }
-  if (ret == 0)
+  return found;
+}
+
+/*
+ * FSM program: byte k of a program (header hdr) is updated by the device
+ * while the program runs. The variable data section follows the 6 header
+ * bytes, as described by CONFIG_A (NR_THRESH, NR_MASK, NR_LTIMER,
+ * NR_STIMER) and CONFIG_B (DES, PAS):
+ *   THRESHx (2 bytes each), MASKx / TMASKx pairs, TC (2 bytes with long
+ *   timers, 1 with short timers only), TIMER1/2 (2 bytes each),
+ *   TIMER3/4 (1 byte each), DEC / DEST, PAS.
+ * Runtime bytes: PP (header byte 5), TMASKx, TC, DEST and PAS. If this
+ * layout does not end at the reset pointer RP (start of the instructions),
+ * the whole variable data section is taken as runtime.
+ */
+static uint8_t fsm_prg_runtime(const uint8_t *hdr, uint16_t k)
+{
+  uint16_t off = 6U;
+  uint16_t tc;
+  uint16_t n;
+  uint8_t rt = 0U;
+
+  if (k == 5U)
   {
-    fsm_int2.int2_fsm1 = val.fsm1;
-    fsm_int2.int2_fsm2 = val.fsm2;
-    fsm_int2.int2_fsm3 = val.fsm3;
-    fsm_int2.int2_fsm4 = val.fsm4;
-    fsm_int2.int2_fsm5 = val.fsm5;
-    fsm_int2.int2_fsm6 = val.fsm6;
-    fsm_int2.int2_fsm7 = val.fsm7;
-    fsm_int2.int2_fsm8 = val.fsm8;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FSM_INT2, (uint8_t *)&fsm_int2, 1);
+    return 1U;
   }
-  if (ret == 0)
+
+  /* THRESHx */
+  off = (uint16_t)(off + (2U * (uint16_t)(hdr[0] >> 6)));
+
+  /* MASKx, TMASKx */
+  n = (uint16_t)((hdr[0] >> 4) & 0x03U);
+  if ((k >= off) && (k < (off + (2U * n))) && (((k - off) & 0x01U) == 1U))
   {
-    mlc_int2.int2_mlc1 = val.mlc1;
-    mlc_int2.int2_mlc2 = val.mlc2;
-    mlc_int2.int2_mlc3 = val.mlc3;
-    mlc_int2.int2_mlc4 = val.mlc4;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_MLC_INT2, (uint8_t *)&mlc_int2, 1);
+    rt = 1U;
   }
+  off = (uint16_t)(off + (2U * n));
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
-  if (ret == 0)
+  /* TC, TIMER1/2, TIMER3/4 */
+  if (((hdr[0] >> 2) & 0x03U) != 0U)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
+    tc = 2U;
   }
-  if (ret == 0)
+  else
   {
-    if ((val.emb_func_stand_by | val.timestamp) != PROPERTY_DISABLE)
-    {
-      ctrl4.int2_on_int1 = PROPERTY_DISABLE;
-    }
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
+    tc = ((hdr[0] & 0x03U) != 0U) ? 1U : 0U;
   }
-
-  if (ret == 0)
+  if ((k >= off) && (k < (off + tc)))
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+    rt = 1U;
   }
+  off = (uint16_t)(off + tc + (2U * ((hdr[0] >> 2) & 0x03U)) + (hdr[0] & 0x03U));
 
-  if (ret == 0)
+  /* DEC, DEST */
+  if ((hdr[1] & 0x80U) != 0U)
   {
-    inactivity_dur.sleep_status_on_int = val.sleep_status;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+    rt = (k == (off + 1U)) ? 1U : rt;
+    off = (uint16_t)(off + 2U);
   }
 
-  if (ret == 0)
+  /* PAS */
+  if ((hdr[1] & 0x08U) != 0U)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+    rt = (k == off) ? 1U : rt;
+    off = (uint16_t)(off + 1U);
   }
 
-  if (ret == 0)
+  if (off != hdr[4])
   {
-    int2_ctrl.int2_drdy_xl = val.drdy_xl;
-    int2_ctrl.int2_drdy_g = val.drdy_gy;
-    int2_ctrl.int2_fifo_th = val.fifo_th;
-    int2_ctrl.int2_fifo_ovr = val.fifo_ovr;
-    int2_ctrl.int2_fifo_full = val.fifo_full;
-    int2_ctrl.int2_cnt_bdr = val.fifo_bdr;
-    int2_ctrl.int2_emb_func_endop = val.emb_func_stand_by;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+    /* unknown layout */
+    rt = ((k >= 6U) && (k < hdr[4])) ? 1U : rt;
   }
 
-  if (ret == 0)
+  return rt;
+}
+
+/*
+ * UCF verify: FSM programs configured by the lines, located from
+ * FSM_PROGRAMS, FSM_START_ADD_L/H and the program sizes (header byte 2).
+ * Their header is taken from the lines too. Returns the number of programs
+ * found.
+ */
+static uint8_t ucf_fsm_prg(const ucf_line_t *lines, uint32_t num, uint8_t bank,
+                           uint16_t *prg, uint8_t *hdr)
+{
+  uint16_t address;
+  uint8_t programs = 0U;
+  uint8_t start[2];
+  uint8_t k;
+  uint8_t n;
+
+  if ((ucf_page_byte(lines, num, bank, ST1VAFE6AX_FSM_PROGRAMS, &programs) == 0U) ||
+      (ucf_page_byte(lines, num, bank, ST1VAFE6AX_FSM_START_ADD_L, &start[0]) == 0U) ||
+      (ucf_page_byte(lines, num, bank, ST1VAFE6AX_FSM_START_ADD_H, &start[1]) == 0U))
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
-    ctrl7.int2_drdy_ah_bio = val.drdy_ah_bio;
+    return 0U;
   }
 
-  if (ret == 0)
+  address = (uint16_t)start[0] | ((uint16_t)start[1] << 8);
+  for (n = 0U; (n < programs) && (n < 8U) && (address < 0x1000U); n++)
   {
-    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+    for (k = 0U; k < 6U; k++)
+    {
+      hdr[(6U * n) + k] = 0U;
+      (void)ucf_page_byte(lines, num, bank, address + k, &hdr[(6U * n) + k]);
+    }
+    if (hdr[(6U * n) + 2U] == 0U)
+    {
+      break;
+    }
+    prg[n] = address;
+    address += hdr[(6U * n) + 2U];
   }
 
-  if (ret == 0)
+  return n;
+}
+
+/* UCF verify: compare a run of embedded page bytes with the device */
+static int32_t ucf_verify_run(const stmdev_ctx_t *ctx, uint16_t address,
+                              const uint8_t *exp, uint8_t len,
+                              const uint16_t *prg, const uint8_t *hdr,
+                              uint8_t n_prg)
+{
+  uint8_t got[ST1VAFE6AX_PG_CHUNK];
+  uint16_t k;
+  uint8_t i;
+  uint8_t n;
+  int32_t ret = 0;
+
+  if (len != 0U)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
+    ret = st1vafe6ax_ln_pg_read(ctx, address, got, len);
+    for (i = 0U; i < len; i++)
+    {
+      for (n = 0U; n < n_prg; n++)
+      {
+        k = (uint16_t)(address + i - prg[n]);
+        if (((address + i) >= prg[n]) && (k < hdr[(6U * n) + 2U]) &&
+            (fsm_prg_runtime(&hdr[6U * n], k) == 1U))
+        {
+          got[i] = exp[i];
+        }
+      }
+    }
+    if ((ret == 0) && (memcmp(got, exp, len) != 0))
+    {
+      ret = -1;
+    }
   }
 
-  if (ret == 0)
+  return ret;
+}
+
+/*
+ * UCF verify: read back the embedded pages and the configuration registers.
+ * The FSM runtime bytes are not compared, as the FSMs enabled by the
+ * configuration may already be running.
+ */
+static int32_t ucf_verify(const stmdev_ctx_t *ctx, const ucf_line_t *lines,
+                          uint32_t num, uint8_t bank)
+{
+  uint8_t exp[ST1VAFE6AX_PG_CHUNK];
+  uint16_t page_sel = 0x100U;
+  uint16_t page_addr = 0x100U;
+  uint16_t address;
+  uint16_t prg[8];
+  uint8_t hdr[8U * 6U];
+  uint16_t run = 0U;
+  uint8_t run_len = 0U;
+  uint8_t n_prg;
+  uint8_t bank_end;
+  uint8_t val;
+  uint8_t reg;
+  uint32_t i;
+  int32_t ret;
+
+  n_prg = ucf_fsm_prg(lines, num, bank, prg, hdr);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &bank_end, 1);
+
+  for (i = 0U; (ret == 0) && (i < num); i++)
   {
-    if ((emb_func_int2.int2_fsm_lc
-         | emb_func_int2.int2_sig_mot
-         | emb_func_int2.int2_step_detector
-         | emb_func_int2.int2_tilt
-         | fsm_int2.int2_fsm1
-         | fsm_int2.int2_fsm2
-         | fsm_int2.int2_fsm3
-         | fsm_int2.int2_fsm4
-         | fsm_int2.int2_fsm5
-         | fsm_int2.int2_fsm6
-         | fsm_int2.int2_fsm7
-         | fsm_int2.int2_fsm8
-         | mlc_int2.int2_mlc1
-         | mlc_int2.int2_mlc2
-         | mlc_int2.int2_mlc3
-         | mlc_int2.int2_mlc4) != PROPERTY_DISABLE)
+    reg = lines[i].address;
+    address = ucf_page_track(&lines[i], &bank, &page_sel, &page_addr);
+
+    if (address != 0xFFFFU)
     {
-      md2_cfg.int2_emb_func = PROPERTY_ENABLE;
+      if ((run_len == ST1VAFE6AX_PG_CHUNK) || (address != (run + run_len)))
+      {
+        ret = ucf_verify_run(ctx, run, exp, run_len, prg, hdr, n_prg);
+        run = address;
+        run_len = 0U;
+      }
+      exp[run_len] = lines[i].data;
+      run_len++;
     }
-    else
+    else if ((reg == ST1VAFE6AX_FUNC_CFG_ACCESS) || (((bank & 0xF0U) == 0x80U) &&
+                                                      ((reg == ST1VAFE6AX_PAGE_SEL) ||
+                                                       (reg == ST1VAFE6AX_PAGE_ADDRESS) ||
+                                                       (reg == ST1VAFE6AX_PAGE_VALUE))))
     {
-      md2_cfg.int2_emb_func = PROPERTY_DISABLE;
+      /* bank / page selection, or page data at an unknown location */
     }
-    md2_cfg.int2_6d = val.six_d;
-    md2_cfg.int2_double_tap = val.double_tap;
-    md2_cfg.int2_ff = val.free_fall;
-    md2_cfg.int2_wu = val.wake_up;
-    md2_cfg.int2_single_tap = val.single_tap;
-    md2_cfg.int2_timestamp = val.timestamp;
-    if ((val.sleep_status | val.sleep_change) != PROPERTY_DISABLE)
+    else if ((ucf_verifiable(bank, reg) == 1U) && (ucf_last_write(lines, num, i, bank) == 1U))
     {
-      md2_cfg.int2_sleep_change = PROPERTY_ENABLE;
+      ret = st1vafe6ax_mem_bank_set(ctx, ((bank & 0xF0U) == 0x80U) ?
+                                    ST1VAFE6AX_EMBED_FUNC_MEM_BANK : ST1VAFE6AX_MAIN_MEM_BANK);
+      if (ret == 0)
+      {
+        ret = st1vafe6ax_read_reg(ctx, reg, &val, 1);
+      }
+      if ((ret == 0) && (val != lines[i].data))
+      {
+        ret = -1;
+      }
     }
     else
     {
-      md2_cfg.int2_sleep_change = PROPERTY_DISABLE;
+      /* not verified */
     }
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
-  }
-
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
-  }
-
-  if (ret == 0)
-  {
-    pedo_cmd_reg.carry_count_en = val.step_count_overflow;
-    ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
   }
 
-
   if (ret == 0)
   {
-    ret = st1vafe6ax_pin_int1_route_get(ctx, &pin_int1_route);
+    ret = ucf_verify_run(ctx, run, exp, run_len, prg, hdr, n_prg);
   }
 
+  /* leave the memory bank selected by the configuration */
   if (ret == 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &val, 1);
   }
-  if (ret == 0)
+  if ((ret == 0) && (val != bank_end))
   {
-    if ((pin_int1_route.six_d
-         | pin_int1_route.double_tap
-         | pin_int1_route.free_fall
-         | pin_int1_route.wake_up
-         | pin_int1_route.single_tap
-         | pin_int1_route.sleep_status
-         | pin_int1_route.sleep_change
-         | val.six_d
-         | val.double_tap
-         | val.free_fall
-         | val.wake_up
-         | val.single_tap
-         | val.sleep_status
-         | val.sleep_change) != PROPERTY_DISABLE)
-    {
-      functions_enable.interrupts_enable = PROPERTY_ENABLE;
-    }
-
-    else
-    {
-      functions_enable.interrupts_enable = PROPERTY_DISABLE;
-    }
-
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &bank_end, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  It routes interrupt signals on INT 2 pin.[get]
+  * @brief  Load a configuration (e.g. MLC / FSM program) made of
+  *         address / data lines, as exported by ST tools.
+  *         Lines are written in order, with fewer bus transactions than one
+  *         st1vafe6ax_write_reg() per line:
+  *         - FUNC_CFG_ACCESS lines that select the bank already selected, or
+  *           that are immediately overwritten, are skipped;
+  *         - PAGE_SEL lines that do not change the page and PAGE_ADDRESS
+  *           lines equal to the auto-incremented page address are skipped;
+  *         - consecutive PAGE_VALUE lines are streamed with multi-byte
+  *           writes, CTRL3.IF_INC being cleared while in the embedded bank;
+  *         - lines addressing consecutive registers are merged.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      It routes interrupt signals on INT 2 pin.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  lines    configuration lines
+  * @param  num      number of lines
+  * @param  flags    ST1VAFE6AX_UCF_VERIFY: read back and compare the
+  *                  embedded page data and the configuration registers
+  *                  (except the FSM runtime bytes: program pointer,
+  *                  temporary masks, timer and decimation counters,
+  *                  previous axis sign)
+  * @retval          interface status (MANDATORY: return 0 -> no Error),
+  *                  -1 also if the verification fails
   *
   */
-int32_t st1vafe6ax_pin_int2_route_get(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_pin_int_route_t *val)
+int32_t st1vafe6ax_ucf_load(const stmdev_ctx_t *ctx, const ucf_line_t *lines,
+                            uint32_t num, uint8_t flags)
 {
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
-  st1vafe6ax_emb_func_int2_t emb_func_int2 = {0};
-  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
-  st1vafe6ax_int2_ctrl_t int2_ctrl = {0};
-  st1vafe6ax_fsm_int2_t fsm_int2 = {0};
-  st1vafe6ax_mlc_int2_t mlc_int2 = {0};
-  st1vafe6ax_ctrl7_t ctrl7 = {0};
-  st1vafe6ax_md2_cfg_t md2_cfg = {0};
-  st1vafe6ax_ctrl4_t ctrl4 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+  st1vafe6ax_ctrl3_t ctrl3 = {0};
+  uint8_t buff[ST1VAFE6AX_PG_CHUNK];
+  uint16_t page_sel = 0x100U;
+  uint16_t page_addr = 0x100U;
+  uint8_t ctrl3_saved = 0U;
+  uint8_t bank_start = 0U;
+  uint8_t bank = 0U;
+  uint8_t if_inc = 1U;
+  uint8_t no_inc = 0U;
+  uint8_t emb;
+  uint8_t reg;
+  uint32_t i = 0U;
+  uint16_t n;
+  int32_t ret;
 
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &bank, 1);
+  bank_start = bank;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
-  if (ret != 0)
+  while ((ret == 0) && (i < num))
   {
-    return ret;
-  }
+    reg = lines[i].address;
+    emb = ((bank & 0xF0U) == 0x80U) ? 1U : 0U;
 
-  if (ctrl4.int2_on_int1 == PROPERTY_DISABLE)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
-    if (ret != 0)
+    if (reg == ST1VAFE6AX_FUNC_CFG_ACCESS)
     {
-      return ret;
-    }
-
-    val->timestamp = md2_cfg.int2_timestamp;
-    val->emb_func_stand_by = int2_ctrl.int2_emb_func_endop;
-  }
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
+      bytecpy((uint8_t *)&func_cfg_access, &lines[i].data);
+      if ((func_cfg_access.sw_por == 0U) &&
+          ((lines[i].data == bank) ||
+           (((i + 1U) < num) && (lines[i + 1U].address == ST1VAFE6AX_FUNC_CFG_ACCESS))))
+      {
+        i++;
+        continue;
+      }
 
-  val->sleep_status = inactivity_dur.sleep_status_on_int;
+      if (((bank & 0xF0U) == 0x00U) && (func_cfg_access.emb_func_reg_access == 1U) &&
+          (func_cfg_access.sw_por == 0U) && (if_inc == 1U) &&
+          (ucf_page_stream(lines, num, i + 1U) == 1U))
+      {
+        /* PAGE_VALUE streaming: all the bytes of a write to the same register */
+        ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+        if (ret == 0)
+        {
+          bytecpy(&ctrl3_saved, (uint8_t *)&ctrl3);
+          ctrl3.if_inc = PROPERTY_DISABLE;
+          ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, (uint8_t *)&ctrl3, 1);
+        }
+        no_inc = 1U;
+        if_inc = 0U;
+      }
 
-  val->drdy_xl = int2_ctrl.int2_drdy_xl;
-  val->drdy_gy = int2_ctrl.int2_drdy_g;
-  val->fifo_th = int2_ctrl.int2_fifo_th;
-  val->fifo_ovr = int2_ctrl.int2_fifo_ovr;
-  val->fifo_full = int2_ctrl.int2_fifo_full;
-  val->fifo_bdr = int2_ctrl.int2_cnt_bdr;
+      if (ret == 0)
+      {
+        ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+      }
+      bank = (func_cfg_access.sw_por != 0U) ? 0x00U : lines[i].data;
+      page_sel = 0x100U;
+      page_addr = 0x100U;
 
-  val->six_d = md2_cfg.int2_6d;
-  val->double_tap = md2_cfg.int2_double_tap;
-  val->free_fall = md2_cfg.int2_ff;
-  val->wake_up = md2_cfg.int2_wu;
-  val->single_tap = md2_cfg.int2_single_tap;
-  val->sleep_change = md2_cfg.int2_sleep_change;
+      if (func_cfg_access.sw_por != 0U)
+      {
+        /* device restarts with default registers */
+        no_inc = 0U;
+        if_inc = 1U;
+      }
+      else if ((ret == 0) && (no_inc == 1U) && ((bank & 0xF0U) == 0x00U))
+      {
+        ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, &ctrl3_saved, 1);
+        no_inc = 0U;
+        if_inc = 1U;
+      }
+      else
+      {
+        /* no IF_INC change */
+      }
+      i++;
+      continue;
+    }
 
-  val->drdy_ah_bio = ctrl7.int2_drdy_ah_bio;
+    if ((emb == 1U) && (reg == ST1VAFE6AX_PAGE_SEL))
+    {
+      if (lines[i].data == page_sel)
+      {
+        i++;
+        continue;
+      }
+      page_sel = lines[i].data;
+      page_addr = 0x100U;
+    }
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+    if ((emb == 1U) && (reg == ST1VAFE6AX_PAGE_ADDRESS) && (lines[i].data == page_addr))
+    {
+      i++;
+      continue;
+    }
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_INT2, (uint8_t *)&fsm_int2, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_INT2, (uint8_t *)&mlc_int2, 1);
-  }
+    buff[0] = lines[i].data;
+    n = 1U;
+    if ((emb == 1U) && (reg == ST1VAFE6AX_PAGE_VALUE))
+    {
+      while ((if_inc == 0U) && ((i + n) < num) && (n < ST1VAFE6AX_PG_CHUNK) &&
+             (lines[i + n].address == ST1VAFE6AX_PAGE_VALUE))
+      {
+        buff[n] = lines[i + n].data;
+        n++;
+      }
+    }
+    else
+    {
+      while ((if_inc == 1U) && ((i + n) < num) && (n < ST1VAFE6AX_PG_CHUNK) &&
+             (lines[i + n].address == ((uint16_t)reg + n)) &&
+             ((emb == 0U) || ((lines[i + n].address != ST1VAFE6AX_PAGE_SEL) &&
+                              (lines[i + n].address != ST1VAFE6AX_PAGE_ADDRESS) &&
+                              (lines[i + n].address != ST1VAFE6AX_PAGE_VALUE))))
+      {
+        buff[n] = lines[i + n].data;
+        n++;
+      }
+    }
 
-  if (ret == 0)
-  {
-    val->step_detector = emb_func_int2.int2_step_detector;
-    val->tilt = emb_func_int2.int2_tilt;
-    val->sig_mot = emb_func_int2.int2_sig_mot;
-    val->fsm_lc = emb_func_int2.int2_fsm_lc;
+    ret = st1vafe6ax_write_reg(ctx, reg, buff, n);
 
-    val->fsm1 = fsm_int2.int2_fsm1;
-    val->fsm2 = fsm_int2.int2_fsm2;
-    val->fsm3 = fsm_int2.int2_fsm3;
-    val->fsm4 = fsm_int2.int2_fsm4;
-    val->fsm5 = fsm_int2.int2_fsm5;
-    val->fsm6 = fsm_int2.int2_fsm6;
-    val->fsm7 = fsm_int2.int2_fsm7;
-    val->fsm8 = fsm_int2.int2_fsm8;
+    if ((emb == 1U) && (reg == ST1VAFE6AX_PAGE_ADDRESS))
+    {
+      page_addr = buff[0];
+    }
+    else if ((emb == 1U) && (reg == ST1VAFE6AX_PAGE_VALUE) && (page_addr <= 0xFFU))
+    {
+      page_addr += n;
+      page_addr = (page_addr > 0xFFU) ? 0x100U : page_addr;
+    }
+    else if ((emb == 0U) && (reg <= ST1VAFE6AX_CTRL3) && (((uint16_t)reg + n) > ST1VAFE6AX_CTRL3))
+    {
+      bytecpy((uint8_t *)&ctrl3, &buff[ST1VAFE6AX_CTRL3 - reg]);
+      if_inc = ctrl3.if_inc;
+    }
+    else
+    {
+      /* no tracking needed */
+    }
 
-    val->mlc1 = mlc_int2.int2_mlc1;
-    val->mlc2 = mlc_int2.int2_mlc2;
-    val->mlc3 = mlc_int2.int2_mlc3;
-    val->mlc4 = mlc_int2.int2_mlc4;
+    i += n;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
-  if (ret == 0)
+  if ((ret == 0) && (no_inc == 1U))
   {
-    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
+    /* configuration ends in the embedded bank: restore IF_INC */
+    bytecpy((uint8_t *)&func_cfg_access, &bank);
+    func_cfg_access.emb_func_reg_access = 0U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, &ctrl3_saved, 1);
+    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &bank, 1);
   }
 
-  if (ret == 0)
+  if ((ret == 0) && ((flags & ST1VAFE6AX_UCF_VERIFY) != 0U))
   {
-    val->step_count_overflow = pedo_cmd_reg.carry_count_en;
+    ret = ucf_verify(ctx, lines, num, bank_start);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enables INT pin when I3C is enabled.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Enables INT pin when I3C is enabled.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @}
   *
   */
-int32_t st1vafe6ax_pin_int_en_when_i2c_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  st1vafe6ax_ctrl5_t ctrl5 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
-  if (ret == 0)
-  {
-    ctrl5.int_en_i3c = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
-  }
 
-  return ret;
-}
+/**
+  * @defgroup  Timestamp
+  * @brief     This section groups all the functions that manage the
+  *            timestamp generation.
+  * @{
+  *
+  */
 
 /**
-  * @brief  Enables INT pin when I3C is enabled.[get]
+  * @brief  Enables timestamp counter.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables INT pin when I3C is enabled.
+  * @param  val      Enables timestamp counter.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_pin_int_en_when_i2c_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_timestamp_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_ctrl5_t ctrl5 = {0};
+  st1vafe6ax_functions_enable_t functions_enable = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
-  if (ret != 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+  if (ret == 0)
   {
-    return ret;
+    functions_enable.timestamp_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
   }
 
-  *val = ctrl5.int_en_i3c;
-
   return ret;
 }
 
 /**
-  * @brief  Interrupt notification mode.[set]
+  * @brief  Enables timestamp counter.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ALL_INT_PULSED, BASE_LATCHED_EMB_PULSED, BASE_PULSED_EMB_LATCHED, ALL_INT_LATCHED,
+  * @param  val      Enables timestamp counter.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_int_notification_set(const stmdev_ctx_t *ctx,
-                                        st1vafe6ax_int_notification_t val)
+int32_t st1vafe6ax_timestamp_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
-  st1vafe6ax_page_rw_t page_rw = {0};
+  st1vafe6ax_functions_enable_t functions_enable = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+  if (ret != 0)
   {
-    tap_cfg0.lir = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+    return ret;
   }
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-
-    if (ret == 0)
-    {
-      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
-    }
-
-    if (ret == 0)
-    {
-      page_rw.emb_func_lir = ((uint8_t)val & 0x02U) >> 1;
-      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
-    }
-
-    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-  }
+  *val = functions_enable.timestamp_en;
 
   return ret;
 }
 
 /**
-  * @brief  Interrupt notification mode.[get]
+  * @brief  Timestamp data output.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ALL_INT_PULSED, BASE_LATCHED_EMB_PULSED, BASE_PULSED_EMB_LATCHED, ALL_INT_LATCHED,
+  * @param  val      Timestamp data output.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_int_notification_get(const stmdev_ctx_t *ctx,
-                                        st1vafe6ax_int_notification_t *val)
+int32_t st1vafe6ax_timestamp_raw_get(const stmdev_ctx_t *ctx, uint32_t *val)
 {
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
-  st1vafe6ax_page_rw_t page_rw = {0};
+  uint8_t buff[4] = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-
-    if (ret == 0)
-    {
-      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
-    }
-
-    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-  }
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TIMESTAMP0, &buff[0], 4);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch ((page_rw.emb_func_lir << 1) + tap_cfg0.lir)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_ALL_INT_PULSED;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_BASE_LATCHED_EMB_PULSED;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_BASE_PULSED_EMB_LATCHED;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_ALL_INT_LATCHED;
-      break;
+  *val = buff[3];
+  *val = (*val * 256U) + buff[2];
+  *val = (*val * 256U) + buff[1];
+  *val = (*val * 256U) + buff[0];
 
-    default:
-      *val = ST1VAFE6AX_ALL_INT_PULSED;
-      break;
-  }
   return ret;
 }
 
@@ -3911,881 +4779,813 @@ int32_t st1vafe6ax_int_notification_get(const stmdev_ctx_t *ctx,
   */
 
 /**
-  * @defgroup  Wake Up event and Activity / Inactivity detection
-  * @brief     This section groups all the functions that manage the Wake Up
-  *            event generation.
+  * @defgroup  Filters
+  * @brief     This section group all the functions concerning the
+  *            filters configuration
   * @{
   *
   */
 
 /**
-  * @brief  Enable activity/inactivity (sleep) function.[set]
+  * @brief  Protocol anti-spike filters.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      XL_AND_GY_NOT_AFFECTED, XL_LOW_POWER_GY_NOT_AFFECTED, XL_LOW_POWER_GY_SLEEP, XL_LOW_POWER_GY_POWER_DOWN,
+  * @param  val      AUTO, ALWAYS_ACTIVE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_act_mode_t val)
+int32_t st1vafe6ax_filt_anti_spike_set(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_filt_anti_spike_t val)
 {
-  st1vafe6ax_functions_enable_t functions_enable = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
+
   if (ret == 0)
   {
-    functions_enable.inact_en = (uint8_t)val & 0x03U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+    if_cfg.asf_ctrl = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enable activity/inactivity (sleep) function.[get]
+  * @brief  Protocol anti-spike filters.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      XL_AND_GY_NOT_AFFECTED, XL_LOW_POWER_GY_NOT_AFFECTED, XL_LOW_POWER_GY_SLEEP, XL_LOW_POWER_GY_POWER_DOWN,
+  * @param  val      AUTO, ALWAYS_ACTIVE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_act_mode_t *val)
+int32_t st1vafe6ax_filt_anti_spike_get(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_filt_anti_spike_t *val)
 {
-  st1vafe6ax_functions_enable_t functions_enable = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (functions_enable.inact_en)
+  switch (if_cfg.asf_ctrl)
   {
     case 0x00:
-      *val = ST1VAFE6AX_XL_AND_GY_NOT_AFFECTED;
+      *val = ST1VAFE6AX_AUTO;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_XL_LOW_POWER_GY_NOT_AFFECTED;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_XL_LOW_POWER_GY_SLEEP;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_XL_LOW_POWER_GY_POWER_DOWN;
+      *val = ST1VAFE6AX_ALWAYS_ACTIVE;
       break;
 
     default:
-      *val = ST1VAFE6AX_XL_AND_GY_NOT_AFFECTED;
+      *val = ST1VAFE6AX_AUTO;
       break;
   }
   return ret;
 }
 
 /**
-  * @brief  Duration in the transition from Stationary to Motion (from Inactivity to Activity).[set]
+  * @brief  It masks DRDY and Interrupts RQ until filter settling ends.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      SLEEP_TO_ACT_AT_1ST_SAMPLE, SLEEP_TO_ACT_AT_2ND_SAMPLE, SLEEP_TO_ACT_AT_3RD_SAMPLE, SLEEP_TO_ACT_AT_4th_SAMPLE,
+  * @param  val      It masks DRDY and Interrupts RQ until filter settling ends.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_from_sleep_to_act_dur_set(const stmdev_ctx_t *ctx,
-                                                 st1vafe6ax_act_from_sleep_to_act_dur_t val)
+int32_t st1vafe6ax_filt_settling_mask_set(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_filt_settling_mask_t val)
 {
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
+  st1vafe6ax_emb_func_cfg_t emb_func_cfg = {0};
+  st1vafe6ax_ctrl4_t ctrl4 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
+
   if (ret == 0)
   {
-    inactivity_dur.inact_dur = (uint8_t)val & 0x3U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+    ctrl4.drdy_mask = val.drdy;
+
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_CFG, (uint8_t *)&emb_func_cfg, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_cfg.emb_func_irq_mask_xl_settl = val.irq_xl;
+    emb_func_cfg.emb_func_irq_mask_g_settl = val.irq_g;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_CFG, (uint8_t *)&emb_func_cfg, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Duration in the transition from Stationary to Motion (from Inactivity to Activity).[get]
+  * @brief  It masks DRDY and Interrupts RQ until filter settling ends.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      SLEEP_TO_ACT_AT_1ST_SAMPLE, SLEEP_TO_ACT_AT_2ND_SAMPLE, SLEEP_TO_ACT_AT_3RD_SAMPLE, SLEEP_TO_ACT_AT_4th_SAMPLE,
+  * @param  val      It masks DRDY and Interrupts RQ until filter settling ends.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_from_sleep_to_act_dur_get(const stmdev_ctx_t *ctx,
-                                                 st1vafe6ax_act_from_sleep_to_act_dur_t *val)
+int32_t st1vafe6ax_filt_settling_mask_get(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_filt_settling_mask_t *val)
 {
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
+  st1vafe6ax_emb_func_cfg_t emb_func_cfg = {0};
+  st1vafe6ax_ctrl4_t ctrl4 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_CFG, (uint8_t *)&emb_func_cfg, 1);
+
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (inactivity_dur.inact_dur)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_1ST_SAMPLE;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_2ND_SAMPLE;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_3RD_SAMPLE;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_4th_SAMPLE;
-      break;
+  val->drdy = ctrl4.drdy_mask;
+  val->irq_xl = emb_func_cfg.emb_func_irq_mask_xl_settl;
+  val->irq_g = emb_func_cfg.emb_func_irq_mask_g_settl;
 
-    default:
-      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_1ST_SAMPLE;
-      break;
-  }
   return ret;
 }
 
 /**
-  * @brief  Selects the accelerometer data rate during Inactivity.[set]
+  * @brief  Gyroscope low-pass filter (LPF1) bandwidth selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      1Hz875, 15Hz, 30Hz, 60Hz,
+  * @param  val      ULTRA_LIGHT, VERY_LIGHT, LIGHT, MEDIUM, STRONG, VERY_STRONG, AGGRESSIVE, XTREME,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_sleep_xl_odr_set(const stmdev_ctx_t *ctx,
-                                        st1vafe6ax_act_sleep_xl_odr_t val)
+int32_t st1vafe6ax_filt_gy_lp1_bandwidth_set(const stmdev_ctx_t *ctx,
+                                             st1vafe6ax_filt_gy_lp1_bandwidth_t val)
 {
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
+  st1vafe6ax_ctrl6_t ctrl6 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
   if (ret == 0)
   {
-    inactivity_dur.xl_inact_odr = (uint8_t)val & 0x03U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+    ctrl6.lpf1_g_bw = (uint8_t)val & 0x7U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Selects the accelerometer data rate during Inactivity.[get]
+  * @brief  Gyroscope low-pass filter (LPF1) bandwidth selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      1Hz875, 15Hz, 30Hz, 60Hz,
+  * @param  val      ULTRA_LIGHT, VERY_LIGHT, LIGHT, MEDIUM, STRONG, VERY_STRONG, AGGRESSIVE, XTREME,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_sleep_xl_odr_get(const stmdev_ctx_t *ctx,
-                                        st1vafe6ax_act_sleep_xl_odr_t *val)
+int32_t st1vafe6ax_filt_gy_lp1_bandwidth_get(const stmdev_ctx_t *ctx,
+                                             st1vafe6ax_filt_gy_lp1_bandwidth_t *val)
 {
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
+  st1vafe6ax_ctrl6_t ctrl6 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL6, (uint8_t *)&ctrl6, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (inactivity_dur.xl_inact_odr)
+  switch (ctrl6.lpf1_g_bw)
   {
     case 0x00:
-      *val = ST1VAFE6AX_1Hz875;
+      *val = ST1VAFE6AX_GY_ULTRA_LIGHT;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_15Hz;
+      *val = ST1VAFE6AX_GY_VERY_LIGHT;
       break;
 
     case 0x02:
-      *val = ST1VAFE6AX_30Hz;
+      *val = ST1VAFE6AX_GY_LIGHT;
       break;
 
     case 0x03:
-      *val = ST1VAFE6AX_60Hz;
+      *val = ST1VAFE6AX_GY_MEDIUM;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_GY_STRONG;
+      break;
+
+    case 0x05:
+      *val = ST1VAFE6AX_GY_VERY_STRONG;
+      break;
+
+    case 0x06:
+      *val = ST1VAFE6AX_GY_AGGRESSIVE;
+      break;
+
+    case 0x07:
+      *val = ST1VAFE6AX_GY_XTREME;
       break;
 
     default:
-      *val = ST1VAFE6AX_1Hz875;
+      *val = ST1VAFE6AX_GY_ULTRA_LIGHT;
       break;
   }
   return ret;
 }
 
 /**
-  * @brief  Wakeup and activity/inactivity threshold.[set]
+  * @brief  It enables gyroscope digital LPF1 filter.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Wakeup and activity/inactivity threshold.
+  * @param  val      It enables gyroscope digital LPF1 filter.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_thresholds_set(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_act_thresholds_t val)
+int32_t st1vafe6ax_filt_gy_lp1_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_inactivity_ths_t inactivity_ths = {0};
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
-  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
+  st1vafe6ax_ctrl7_t ctrl7 = {0};
   int32_t ret = {0};
-  float_t tmp = 0.0f;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_THS, (uint8_t *)&inactivity_ths, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
 
-  if (ret != 0)
+  if (ret == 0)
   {
-    return ret;
+    ctrl7.lpf1_g_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
   }
 
-  if ((val.wk_ths_mg < 492u) // 7.8125 * 63.0
-      && (val.inact_ths_mg < 492u)) // 7.8125 * 63.0
-  {
-    inactivity_dur.wu_inact_ths_w = 0;
+  return ret;
+}
 
-    tmp = (float_t)val.inact_ths_mg / 7.8125f;
-    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
+/**
+  * @brief  It enables gyroscope digital LPF1 filter.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      It enables gyroscope digital LPF1 filter.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_filt_gy_lp1_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_ctrl7_t ctrl7 = {0};
+  int32_t ret = {0};
 
-    tmp = (float_t)val.wk_ths_mg / 7.8125f;
-    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
-  }
-  else if ((val.wk_ths_mg < 984u) // 15.625 * 63.0
-           && (val.inact_ths_mg < 984u)) // 15.625 * 63.0
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+  if (ret != 0)
   {
-    inactivity_dur.wu_inact_ths_w = 1;
-
-    tmp = (float_t)val.inact_ths_mg / 15.625f;
-    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
-
-    tmp = (float_t)val.wk_ths_mg / 15.625f;
-    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
+    return ret;
   }
-  else if ((val.wk_ths_mg < 1968u)  // 31.25 * 63.0
-           && (val.inact_ths_mg < 1968u)) // 31.25 * 63.0
-  {
-    inactivity_dur.wu_inact_ths_w = 2;
 
-    tmp = (float_t)val.inact_ths_mg / 31.25f;
-    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
+  *val = ctrl7.lpf1_g_en;
 
-    tmp = (float_t)val.wk_ths_mg / 31.25f;
-    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
-  }
-  else if ((val.wk_ths_mg < 3937u) // 62.5 * 63.0
-           && (val.inact_ths_mg < 3937u)) // 62.5 * 63.0
-  {
-    inactivity_dur.wu_inact_ths_w = 3;
+  return ret;
+}
 
-    tmp = (float_t)val.inact_ths_mg / 62.5f;
-    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
+/**
+  * @brief  Bio filter configuration.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Bio filter configuration.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_filt_ah_bio_conf_set(const stmdev_ctx_t *ctx,
+                                        st1vafe6ax_filt_ah_bio_conf_t val)
+{
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  st1vafe6ax_ctrl8_t ctrl8 = {0};
+  int32_t ret = {0};
 
-    tmp = (float_t)val.wk_ths_mg / 62.5f;
-    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
-  }
-  else if ((val.wk_ths_mg < 7875u) // 125.0 * 63.0
-           && (val.inact_ths_mg < 7875u)) // 125.0 * 63.0
-  {
-    inactivity_dur.wu_inact_ths_w = 4;
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
 
-    tmp = (float_t)val.inact_ths_mg / 125.0f;
-    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
+  ctrl8.ah_bio_hpf = val.hpf;
+  ctrl9.ah_bio_lpf = val.lpf;
 
-    tmp = (float_t)val.wk_ths_mg / 125.0f;
-    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
-  }
-  else if ((val.wk_ths_mg < 15750u) // 250.0 * 63.0
-           && (val.inact_ths_mg < 15750u)) // 250.0 * 63.0
+  if (ret == 0)
   {
-    inactivity_dur.wu_inact_ths_w = 5;
-
-    tmp = (float_t)val.inact_ths_mg / 250.0f;
-    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
-
-    tmp = (float_t)val.wk_ths_mg / 250.0f;
-    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
   }
-  else // out of limit
+  if (ret == 0)
   {
-    inactivity_dur.wu_inact_ths_w = 5;
-    inactivity_ths.inact_ths = 0x3FU;
-    wake_up_ths.wk_ths = 0x3FU;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   }
 
+  return ret;
+}
 
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+/**
+  * @brief  Bio filter configuration.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Bio filter configuration.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_filt_ah_bio_conf_get(const stmdev_ctx_t *ctx,
+                                        st1vafe6ax_filt_ah_bio_conf_t *val)
+{
+  st1vafe6ax_ctrl8_t ctrl8 = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
 
   if (ret != 0)
   {
     return ret;
   }
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_THS, (uint8_t *)&inactivity_ths, 1);
 
-  if (ret != 0)
+  val->lpf = ctrl9.ah_bio_lpf;
+  val->hpf = ctrl8.ah_bio_hpf;
+
+  return ret;
+}
+
+/**
+  * @brief  Accelerometer LPF2 and high pass filter configuration and cutoff setting.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      ULTRA_LIGHT, VERY_LIGHT, LIGHT, MEDIUM, STRONG, VERY_STRONG, AGGRESSIVE, XTREME,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_filt_xl_lp2_bandwidth_set(const stmdev_ctx_t *ctx,
+                                             st1vafe6ax_filt_xl_lp2_bandwidth_t val)
+{
+  st1vafe6ax_ctrl8_t ctrl8 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
+  if (ret == 0)
   {
-    return ret;
+    ctrl8.hp_lpf2_xl_bw = (uint8_t)val & 0x7U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
   }
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
 
   return ret;
 }
 
 /**
-  * @brief  Wakeup and activity/inactivity threshold.[get]
+  * @brief  Accelerometer LPF2 and high pass filter configuration and cutoff setting.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Wakeup and activity/inactivity threshold.
+  * @param  val      ULTRA_LIGHT, VERY_LIGHT, LIGHT, MEDIUM, STRONG, VERY_STRONG, AGGRESSIVE, XTREME,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_thresholds_get(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_act_thresholds_t *val)
+int32_t st1vafe6ax_filt_xl_lp2_bandwidth_get(const stmdev_ctx_t *ctx,
+                                             st1vafe6ax_filt_xl_lp2_bandwidth_t *val)
 {
-  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
-  st1vafe6ax_inactivity_ths_t inactivity_ths = {0};
-  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
+  st1vafe6ax_ctrl8_t ctrl8 = {0};
   int32_t ret = {0};
-  float_t tmp = 0.0f;
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_THS, (uint8_t *)&inactivity_ths, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
 
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL8, (uint8_t *)&ctrl8, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (inactivity_dur.wu_inact_ths_w)
+  switch (ctrl8.hp_lpf2_xl_bw)
   {
-    case 0:
-      tmp = (float_t)wake_up_ths.wk_ths * 7.8125f;
-      val->wk_ths_mg = (uint32_t)tmp;
-
-      tmp = (float_t)inactivity_ths.inact_ths * 7.8125f;
-      val->inact_ths_mg = (uint32_t)tmp;
+    case 0x00:
+      *val = ST1VAFE6AX_XL_ULTRA_LIGHT;
       break;
 
-    case 1:
-      tmp = (float_t)wake_up_ths.wk_ths * 15.625f;
-      val->wk_ths_mg = (uint32_t)tmp;
-
-      tmp = (float_t)inactivity_ths.inact_ths * 15.625f;
-      val->inact_ths_mg = (uint32_t)tmp;
+    case 0x01:
+      *val = ST1VAFE6AX_XL_VERY_LIGHT;
       break;
 
-    case 2:
-      tmp = (float_t)wake_up_ths.wk_ths * 31.25f;
-      val->wk_ths_mg = (uint32_t)tmp;
-
-      tmp = (float_t)inactivity_ths.inact_ths * 31.25f;
-      val->inact_ths_mg = (uint32_t)tmp;
+    case 0x02:
+      *val = ST1VAFE6AX_XL_LIGHT;
       break;
 
-    case 3:
-      tmp = (float_t)wake_up_ths.wk_ths * 62.5f;
-      val->wk_ths_mg = (uint32_t)tmp;
+    case 0x03:
+      *val = ST1VAFE6AX_XL_MEDIUM;
+      break;
 
-      tmp = (float_t)inactivity_ths.inact_ths * 62.5f;
-      val->inact_ths_mg = (uint32_t)tmp;
+    case 0x04:
+      *val = ST1VAFE6AX_XL_STRONG;
       break;
 
-    case 4:
-      tmp = (float_t)wake_up_ths.wk_ths * 125.0f;
-      val->wk_ths_mg = (uint32_t)tmp;
+    case 0x05:
+      *val = ST1VAFE6AX_XL_VERY_STRONG;
+      break;
 
-      tmp = (float_t)inactivity_ths.inact_ths * 125.0f;
-      val->inact_ths_mg = (uint32_t)tmp;
+    case 0x06:
+      *val = ST1VAFE6AX_XL_AGGRESSIVE;
       break;
 
-    default:
-      tmp = (float_t)wake_up_ths.wk_ths * 250.0f;
-      val->wk_ths_mg = (uint32_t)tmp;
+    case 0x07:
+      *val = ST1VAFE6AX_XL_XTREME;
+      break;
 
-      tmp = (float_t)inactivity_ths.inact_ths * 250.0f;
-      val->inact_ths_mg = (uint32_t)tmp;
+    default:
+      *val = ST1VAFE6AX_XL_ULTRA_LIGHT;
       break;
   }
-
   return ret;
 }
 
 /**
-  * @brief  Time windows configuration for Wake Up - Activity - Inactivity (SLEEP, WAKE). Duration to go in sleep mode. Default value: 0000 (this corresponds to 16 ODR) 1 LSB = 512/ODR_XL time. Wake up duration event. 1 LSB = 1/ODR_XL time. [set]
+  * @brief  Enable accelerometer LPS2 (Low Pass Filter 2) filtering stage.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Time windows configuration for Wake Up - Activity - Inactivity (SLEEP, WAKE). Duration to go in sleep mode. Default value: 0000 (this corresponds to 16 ODR) 1 LSB = 512/ODR_XL time. Wake up duration event. 1 LSB = 1/ODR_XL time.
+  * @param  val      Enable accelerometer LPS2 (Low Pass Filter 2) filtering stage.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_wkup_time_windows_set(const stmdev_ctx_t *ctx,
-                                             st1vafe6ax_act_wkup_time_windows_t val)
+int32_t st1vafe6ax_filt_xl_lp2_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_wake_up_dur_t wake_up_dur = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   if (ret == 0)
   {
-    wake_up_dur.wake_dur = val.shock;
-    wake_up_dur.sleep_dur = val.quiet;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
+    ctrl9.lpf2_xl_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Time windows configuration for Wake Up - Activity - Inactivity (SLEEP, WAKE). Duration to go in sleep mode. Default value: 0000 (this corresponds to 16 ODR) 1 LSB = 512/ODR_XL time. Wake up duration event. 1 LSB = 1/ODR_XL time. [get]
+  * @brief  Enable accelerometer LPS2 (Low Pass Filter 2) filtering stage.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Time windows configuration for Wake Up - Activity - Inactivity (SLEEP, WAKE). Duration to go in sleep mode. Default value: 0000 (this corresponds to 16 ODR) 1 LSB = 512/ODR_XL time. Wake up duration event. 1 LSB = 1/ODR_XL time.
+  * @param  val      Enable accelerometer LPS2 (Low Pass Filter 2) filtering stage.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_act_wkup_time_windows_get(const stmdev_ctx_t *ctx,
-                                             st1vafe6ax_act_wkup_time_windows_t *val)
+int32_t st1vafe6ax_filt_xl_lp2_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_wake_up_dur_t wake_up_dur = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  val->shock = wake_up_dur.wake_dur;
-  val->quiet = wake_up_dur.sleep_dur;
+  *val = ctrl9.lpf2_xl_en;
 
   return ret;
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup  Tap Generator
-  * @brief     This section groups all the functions that manage the
-  *            tap and double tap event generation.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Enable axis for Tap - Double Tap detection.[set]
+  * @brief  Accelerometer slope filter / high-pass filter selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enable axis for Tap - Double Tap detection.
+  * @param  val      Accelerometer slope filter / high-pass filter selection.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_detection_set(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_tap_detection_t val)
+int32_t st1vafe6ax_filt_xl_hp_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   if (ret == 0)
   {
-    tap_cfg0.tap_x_en = val.tap_x_en;
-    tap_cfg0.tap_y_en = val.tap_y_en;
-    tap_cfg0.tap_z_en = val.tap_z_en;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+    ctrl9.hp_slope_xl_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enable axis for Tap - Double Tap detection.[get]
+  * @brief  Accelerometer slope filter / high-pass filter selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enable axis for Tap - Double Tap detection.
+  * @param  val      Accelerometer slope filter / high-pass filter selection.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_detection_get(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_tap_detection_t *val)
+int32_t st1vafe6ax_filt_xl_hp_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  val->tap_x_en = tap_cfg0.tap_x_en;
-  val->tap_y_en = tap_cfg0.tap_y_en;
-  val->tap_z_en = tap_cfg0.tap_z_en;
+  *val = ctrl9.hp_slope_xl_en;
 
   return ret;
 }
 
 /**
-  * @brief  axis Tap - Double Tap recognition thresholds.[set]
+  * @brief  Enables accelerometer LPF2 and HPF fast-settling mode. The filter sets the first sample.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      axis Tap - Double Tap recognition thresholds.
+  * @param  val      Enables accelerometer LPF2 and HPF fast-settling mode. The filter sets the first sample.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_thresholds_set(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_tap_thresholds_t val)
+int32_t st1vafe6ax_filt_xl_fast_settling_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_tap_ths_6d_t tap_ths_6d = {0};
-  st1vafe6ax_tap_cfg2_t tap_cfg2 = {0};
-  st1vafe6ax_tap_cfg1_t tap_cfg1 = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG2, (uint8_t *)&tap_cfg2, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-
-  tap_cfg1.tap_ths_z = val.z;
-  tap_cfg2.tap_ths_y = val.y;
-  tap_ths_6d.tap_ths_x = val.x;
-
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG2, (uint8_t *)&tap_cfg2, 1);
-  if (ret != 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  if (ret == 0)
   {
-    return ret;
+    ctrl9.xl_fastsettl_mode = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   }
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
 
   return ret;
 }
 
 /**
-  * @brief  axis Tap - Double Tap recognition thresholds.[get]
+  * @brief  Enables accelerometer LPF2 and HPF fast-settling mode. The filter sets the first sample.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      axis Tap - Double Tap recognition thresholds.
+  * @param  val      Enables accelerometer LPF2 and HPF fast-settling mode. The filter sets the first sample.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_thresholds_get(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_tap_thresholds_t *val)
+int32_t st1vafe6ax_filt_xl_fast_settling_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_tap_ths_6d_t tap_ths_6d = {0};
-  st1vafe6ax_tap_cfg2_t tap_cfg2 = {0};
-  st1vafe6ax_tap_cfg1_t tap_cfg1 = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG2, (uint8_t *)&tap_cfg2, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  val->z  = tap_cfg1.tap_ths_z;
-  val->y = tap_cfg2.tap_ths_y;
-  val->x = tap_ths_6d.tap_ths_x;
+  *val = ctrl9.xl_fastsettl_mode;
 
   return ret;
 }
 
 /**
-  * @brief  Selection of axis priority for TAP detection.[set]
+  * @brief  Accelerometer high-pass filter mode.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      XYZ , YXZ , XZY, ZYX , YZX , ZXY ,
+  * @param  val      HP_MD_NORMAL, HP_MD_REFERENCE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_axis_priority_set(const stmdev_ctx_t *ctx,
-                                         st1vafe6ax_tap_axis_priority_t val)
+int32_t st1vafe6ax_filt_xl_hp_mode_set(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_filt_xl_hp_mode_t val)
 {
-  st1vafe6ax_tap_cfg1_t tap_cfg1 = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   if (ret == 0)
   {
-    tap_cfg1.tap_priority = (uint8_t)val & 0x07U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
+    ctrl9.hp_ref_mode_xl = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Selection of axis priority for TAP detection.[get]
+  * @brief  Accelerometer high-pass filter mode.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      XYZ , YXZ , XZY, ZYX , YZX , ZXY ,
+  * @param  val      HP_MD_NORMAL, HP_MD_REFERENCE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_axis_priority_get(const stmdev_ctx_t *ctx,
-                                         st1vafe6ax_tap_axis_priority_t *val)
+int32_t st1vafe6ax_filt_xl_hp_mode_get(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_filt_xl_hp_mode_t *val)
 {
-  st1vafe6ax_tap_cfg1_t tap_cfg1 = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (tap_cfg1.tap_priority)
+  switch (ctrl9.hp_ref_mode_xl)
   {
     case 0x00:
-      *val = ST1VAFE6AX_ZYX ;
+      *val = ST1VAFE6AX_HP_MD_NORMAL;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_YZX ;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_ZXY ;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_XYZ ;
-      break;
-
-    case 0x04:
-      *val = ST1VAFE6AX_ZYX ;
-      break;
-
-    case 0x05:
-      *val = ST1VAFE6AX_YXZ ;
-      break;
-
-    case 0x06:
-      *val = ST1VAFE6AX_XZY;
-      break;
-
-    case 0x07:
-      *val = ST1VAFE6AX_XYZ;
+      *val = ST1VAFE6AX_HP_MD_REFERENCE;
       break;
 
     default:
-      *val = ST1VAFE6AX_XYZ ;
+      *val = ST1VAFE6AX_HP_MD_NORMAL;
       break;
   }
   return ret;
 }
 
-
 /**
-  * @brief  Time windows configuration for Tap - Double Tap SHOCK, QUIET, DUR : SHOCK Maximum duration is the maximum time of an overthreshold signal detection to be recognized as a tap event. The default value of these bits is 00b which corresponds to 4/ODR_XL time. If the SHOCK bits are set to a different value, 1LSB corresponds to 8/ODR_XL time. QUIET Expected quiet time after a tap detection. Quiet time is the time after the first detected tap in which there must not be any overthreshold event. The default value of these bits is 00b which corresponds to 2/ODR_XL time. If the QUIET bits are set to a different value, 1LSB corresponds to 4/ODR_XL time. DUR Duration of maximum time gap for double tap recognition. When double tap recognition is enabled, this register expresses the maximum time between two consecutive detected taps to determine a double tap event. The default value of these bits is 0000b which corresponds to 16/ODR_XL time. If the DUR_[3:0] bits are set to a different value, 1LSB corresponds to 32/ODR_XL time.[set]
+  * @brief  HPF or SLOPE filter selection on wake-up and Activity/Inactivity functions.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Time windows configuration for Tap - Double Tap SHOCK, QUIET, DUR : SHOCK Maximum duration is the maximum time of an overthreshold signal detection to be recognized as a tap event. The default value of these bits is 00b which corresponds to 4/ODR_XL time. If the SHOCK bits are set to a different value, 1LSB corresponds to 8/ODR_XL time. QUIET Expected quiet time after a tap detection. Quiet time is the time after the first detected tap in which there must not be any overthreshold event. The default value of these bits is 00b which corresponds to 2/ODR_XL time. If the QUIET bits are set to a different value, 1LSB corresponds to 4/ODR_XL time. DUR Duration of maximum time gap for double tap recognition. When double tap recognition is enabled, this register expresses the maximum time between two consecutive detected taps to determine a double tap event. The default value of these bits is 0000b which corresponds to 16/ODR_XL time. If the DUR_[3:0] bits are set to a different value, 1LSB corresponds to 32/ODR_XL time.
+  * @param  val      WK_FEED_SLOPE, WK_FEED_HIGH_PASS,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_time_windows_set(const stmdev_ctx_t *ctx,
-                                        st1vafe6ax_tap_time_windows_t val)
+int32_t st1vafe6ax_filt_wkup_act_feed_set(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_filt_wkup_act_feed_t val)
 {
-  st1vafe6ax_tap_dur_t tap_dur = {0};
+  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_DUR, (uint8_t *)&tap_dur, 1);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+
+  if (ret != 0)
   {
-    tap_dur.shock = val.shock;
-    tap_dur.quiet = val.quiet;
-    tap_dur.dur = val.tap_gap;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_DUR, (uint8_t *)&tap_dur, 1);
+    return ret;
+  }
+
+  tap_cfg0.slope_fds = (uint8_t)val & 0x01U;
+  wake_up_ths.usr_off_on_wu = ((uint8_t)val & 0x02U) >> 1;
+
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+
+  if (ret != 0)
+  {
+    return ret;
   }
 
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+
   return ret;
 }
 
 /**
-  * @brief  Time windows configuration for Tap - Double Tap SHOCK, QUIET, DUR : SHOCK Maximum duration is the maximum time of an overthreshold signal detection to be recognized as a tap event. The default value of these bits is 00b which corresponds to 4/ODR_XL time. If the SHOCK bits are set to a different value, 1LSB corresponds to 8/ODR_XL time. QUIET Expected quiet time after a tap detection. Quiet time is the time after the first detected tap in which there must not be any overthreshold event. The default value of these bits is 00b which corresponds to 2/ODR_XL time. If the QUIET bits are set to a different value, 1LSB corresponds to 4/ODR_XL time. DUR Duration of maximum time gap for double tap recognition. When double tap recognition is enabled, this register expresses the maximum time between two consecutive detected taps to determine a double tap event. The default value of these bits is 0000b which corresponds to 16/ODR_XL time. If the DUR_[3:0] bits are set to a different value, 1LSB corresponds to 32/ODR_XL time.[get]
+  * @brief  HPF or SLOPE filter selection on wake-up and Activity/Inactivity functions.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Time windows configuration for Tap - Double Tap SHOCK, QUIET, DUR : SHOCK Maximum duration is the maximum time of an overthreshold signal detection to be recognized as a tap event. The default value of these bits is 00b which corresponds to 4/ODR_XL time. If the SHOCK bits are set to a different value, 1LSB corresponds to 8/ODR_XL time. QUIET Expected quiet time after a tap detection. Quiet time is the time after the first detected tap in which there must not be any overthreshold event. The default value of these bits is 00b which corresponds to 2/ODR_XL time. If the QUIET bits are set to a different value, 1LSB corresponds to 4/ODR_XL time. DUR Duration of maximum time gap for double tap recognition. When double tap recognition is enabled, this register expresses the maximum time between two consecutive detected taps to determine a double tap event. The default value of these bits is 0000b which corresponds to 16/ODR_XL time. If the DUR_[3:0] bits are set to a different value, 1LSB corresponds to 32/ODR_XL time.
+  * @param  val      WK_FEED_SLOPE, WK_FEED_HIGH_PASS,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_time_windows_get(const stmdev_ctx_t *ctx,
-                                        st1vafe6ax_tap_time_windows_t *val)
+int32_t st1vafe6ax_filt_wkup_act_feed_get(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_filt_wkup_act_feed_t *val)
 {
-  st1vafe6ax_tap_dur_t tap_dur = {0};
+  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_DUR, (uint8_t *)&tap_dur, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+
   if (ret != 0)
   {
     return ret;
   }
 
-  val->shock = tap_dur.shock;
-  val->quiet = tap_dur.quiet;
-  val->tap_gap = tap_dur.dur;
+  switch ((wake_up_ths.usr_off_on_wu << 1) + tap_cfg0.slope_fds)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_WK_FEED_SLOPE;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_WK_FEED_HIGH_PASS;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_WK_FEED_LP_WITH_OFFSET;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_WK_FEED_SLOPE;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Single/double-tap event enable.[set]
+  * @brief  Mask hw function triggers when xl is settling.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ONLY_SINGLE, BOTH_SINGLE_DOUBLE,
+  * @param  val      0 or 1,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_tap_mode_t val)
+int32_t st1vafe6ax_mask_trigger_xl_settl_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+
   if (ret == 0)
   {
-    wake_up_ths.single_double_tap = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+    tap_cfg0.hw_func_mask_xl_settl = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Single/double-tap event enable.[get]
+  * @brief  Mask hw function triggers when xl is settling.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      ONLY_SINGLE, BOTH_SINGLE_DOUBLE,
+  * @param  val      0 or 1,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tap_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_tap_mode_t *val)
+int32_t st1vafe6ax_mask_trigger_xl_settl_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (wake_up_ths.single_double_tap)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_ONLY_SINGLE;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_BOTH_SINGLE_DOUBLE;
-      break;
+  *val = tap_cfg0.hw_func_mask_xl_settl;
 
-    default:
-      *val = ST1VAFE6AX_ONLY_SINGLE;
-      break;
-  }
   return ret;
 }
 
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup  Six position detection (6D)
-  * @brief   This section groups all the functions concerning six position
-  *          detection (6D).
-  * @{
-  *
-  */
 
 /**
-  * @brief  Threshold for 4D/6D function.[set]
+  * @brief  LPF2 filter on 6D (sixd) function selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      DEG_80, DEG_70, DEG_60, DEG_50,
+  * @param  val      SIXD_FEED_ODR_DIV_2, SIXD_FEED_LOW_PASS,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_6d_threshold_set(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_6d_threshold_t val)
+int32_t st1vafe6ax_filt_sixd_feed_set(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_filt_sixd_feed_t val)
 {
-  st1vafe6ax_tap_ths_6d_t tap_ths_6d = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
   if (ret == 0)
   {
-    tap_ths_6d.sixd_ths = (uint8_t)val & 0x03U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
+    tap_cfg0.low_pass_on_6d = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Threshold for 4D/6D function.[get]
+  * @brief  LPF2 filter on 6D (sixd) function selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      DEG_80, DEG_70, DEG_60, DEG_50,
+  * @param  val      SIXD_FEED_ODR_DIV_2, SIXD_FEED_LOW_PASS,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_6d_threshold_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_6d_threshold_t *val)
+int32_t st1vafe6ax_filt_sixd_feed_get(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_filt_sixd_feed_t *val)
 {
-  st1vafe6ax_tap_ths_6d_t tap_ths_6d = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (tap_ths_6d.sixd_ths)
+  switch (tap_cfg0.low_pass_on_6d)
   {
     case 0x00:
-      *val = ST1VAFE6AX_DEG_80;
+      *val = ST1VAFE6AX_SIXD_FEED_ODR_DIV_2;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_DEG_70;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_DEG_60;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_DEG_50;
+      *val = ST1VAFE6AX_SIXD_FEED_LOW_PASS;
       break;
 
     default:
-      *val = ST1VAFE6AX_DEG_80;
+      *val = ST1VAFE6AX_SIXD_FEED_ODR_DIV_2;
       break;
   }
   return ret;
@@ -4797,1909 +5597,2090 @@ int32_t st1vafe6ax_6d_threshold_get(const stmdev_ctx_t *ctx,
   */
 
 /**
-  * @defgroup  Free fall
-  * @brief   This section group all the functions concerning the free
-  *          fall detection.
+  * @defgroup  Serial interfaces
+  * @brief     This section groups all the functions concerning
+  *            serial interfaces management (not auxiliary)
   * @{
   *
   */
 
 /**
-  * @brief  Time windows configuration for Free Fall detection 1 LSB = 1/ODR_XL time[set]
+  * @brief  Enables pull-up on SDO pin of UI (User Interface).[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Time windows configuration for Free Fall detection 1 LSB = 1/ODR_XL time
+  * @param  val      Enables pull-up on SDO pin of UI (User Interface).
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ff_time_windows_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_ui_sdo_pull_up_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_wake_up_dur_t wake_up_dur = {0};
-  st1vafe6ax_free_fall_t free_fall = {0};
+  st1vafe6ax_pin_ctrl_t pin_ctrl = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
-  if (ret == 0)
-  {
-    wake_up_dur.ff_dur = ((uint8_t)val & 0x20U) >> 5;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
-  }
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
-  }
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
   if (ret == 0)
   {
-    free_fall.ff_dur = (uint8_t)val & 0x1FU;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
+    pin_ctrl.sdo_pu_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Time windows configuration for Free Fall detection 1 LSB = 1/ODR_XL time[get]
+  * @brief  Enables pull-up on SDO pin of UI (User Interface).[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Time windows configuration for Free Fall detection 1 LSB = 1/ODR_XL time
+  * @param  val      Enables pull-up on SDO pin of UI (User Interface).
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ff_time_windows_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_ui_sdo_pull_up_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_wake_up_dur_t wake_up_dur = {0};
-  st1vafe6ax_free_fall_t free_fall = {0};
+  st1vafe6ax_pin_ctrl_t pin_ctrl = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = (uint8_t)((wake_up_dur.ff_dur << 5) | free_fall.ff_dur);
+  *val = pin_ctrl.sdo_pu_en;
 
   return ret;
 }
 
 /**
-  * @brief  Free fall threshold setting.[set]
+  * @brief  Disables I2C and I3C on UI (User Interface).[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      156_mg, 219_mg, 250_mg, 312_mg, 344_mg, 406_mg, 469_mg, 500_mg,
+  * @param  val      I2C_I3C_ENABLE, I2C_I3C_DISABLE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ff_thresholds_set(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_ff_thresholds_t val)
+int32_t st1vafe6ax_ui_i2c_i3c_mode_set(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_ui_i2c_i3c_mode_t val)
 {
-  st1vafe6ax_free_fall_t free_fall = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret == 0)
   {
-    free_fall.ff_ths = (uint8_t)val & 0x7U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
+    if_cfg.i2c_i3c_disable = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Free fall threshold setting.[get]
+  * @brief  Disables I2C and I3C on UI (User Interface).[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      156_mg, 219_mg, 250_mg, 312_mg, 344_mg, 406_mg, 469_mg, 500_mg,
+  * @param  val      I2C_I3C_ENABLE, I2C_I3C_DISABLE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ff_thresholds_get(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_ff_thresholds_t *val)
+int32_t st1vafe6ax_ui_i2c_i3c_mode_get(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_ui_i2c_i3c_mode_t *val)
 {
-  st1vafe6ax_free_fall_t free_fall = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (free_fall.ff_ths)
+  switch (if_cfg.i2c_i3c_disable)
   {
     case 0x00:
-      *val = ST1VAFE6AX_156_mg;
+      *val = ST1VAFE6AX_I2C_I3C_ENABLE;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_219_mg;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_250_mg;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_312_mg;
-      break;
-
-    case 0x04:
-      *val = ST1VAFE6AX_344_mg;
-      break;
-
-    case 0x05:
-      *val = ST1VAFE6AX_406_mg;
-      break;
-
-    case 0x06:
-      *val = ST1VAFE6AX_469_mg;
-      break;
-
-    case 0x07:
-      *val = ST1VAFE6AX_500_mg;
+      *val = ST1VAFE6AX_I2C_I3C_DISABLE;
       break;
 
     default:
-      *val = ST1VAFE6AX_156_mg;
+      *val = ST1VAFE6AX_I2C_I3C_ENABLE;
       break;
   }
   return ret;
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup  FIFO
-  * @brief   This section group all the functions concerning the fifo usage
-  * @{
-  *
-  */
-
-/**
-  * @brief  FIFO watermark threshold (1 LSb = TAG (1 Byte) + 1 sensor (6 Bytes) written in FIFO).[set]
+  * @brief  SPI Serial Interface Mode selection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FIFO watermark threshold (1 LSb = TAG (1 Byte) + 1 sensor (6 Bytes) written in FIFO).
+  * @param  val      SPI_4_WIRE, SPI_3_WIRE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_watermark_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_spi_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_spi_mode_t val)
 {
-  st1vafe6ax_fifo_ctrl1_t fifo_ctrl1 = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret == 0)
   {
-    fifo_ctrl1.wtm = val;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
+    if_cfg.sim = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  FIFO watermark threshold (1 LSb = TAG (1 Byte) + 1 sensor (6 Bytes) written in FIFO).[get]
+  * @brief  SPI Serial Interface Mode selection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FIFO watermark threshold (1 LSb = TAG (1 Byte) + 1 sensor (6 Bytes) written in FIFO).
+  * @param  val      SPI_4_WIRE, SPI_3_WIRE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_watermark_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_spi_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_spi_mode_t *val)
 {
-  st1vafe6ax_fifo_ctrl1_t fifo_ctrl1 = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = fifo_ctrl1.wtm;
+  switch (if_cfg.sim)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_SPI_4_WIRE;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_SPI_3_WIRE;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_SPI_4_WIRE;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  When dual channel mode is enabled, this function enables FSM-triggered batching in FIFO of accelerometer channel 2.[set]
+  * @brief  Enables pull-up on SDA pin.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      When dual channel mode is enabled, this function enables FSM-triggered batching in FIFO of accelerometer channel 2.
+  * @param  val      Enables pull-up on SDA pin.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_xl_dual_fsm_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_ui_sda_pull_up_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret == 0)
   {
-    fifo_ctrl2.xl_dualc_batch_from_fsm = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+    if_cfg.sda_pu_en = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  When dual channel mode is enabled, this function enables FSM-triggered batching in FIFO of accelerometer channel 2.[get]
+  * @brief  Enables pull-up on SDA pin.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      When dual channel mode is enabled, this function enables FSM-triggered batching in FIFO of accelerometer channel 2.
+  * @param  val      Enables pull-up on SDA pin.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_xl_dual_fsm_batch_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_ui_sda_pull_up_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = fifo_ctrl2.xl_dualc_batch_from_fsm;
+  *val = if_cfg.sda_pu_en;
 
   return ret;
 }
 
 /**
-  * @brief  It configures the compression algorithm to write non-compressed data at each rate.[set]
+  * @brief  Select the us activity time for IBI (In-Band Interrupt) with I3C[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      CMP_DISABLE, CMP_ALWAYS, CMP_8_TO_1, CMP_16_TO_1, CMP_32_TO_1,
+  * @param  val      IBI_2us, IBI_50us, IBI_1ms, IBI_25ms,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_compress_algo_set(const stmdev_ctx_t *ctx,
-                                          st1vafe6ax_fifo_compress_algo_t val)
+int32_t st1vafe6ax_i3c_ibi_time_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_i3c_ibi_time_t val)
 {
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  st1vafe6ax_ctrl5_t ctrl5 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
   if (ret == 0)
   {
-    fifo_ctrl2.uncompr_rate = (uint8_t)val & 0x03U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+    ctrl5.bus_act_sel = (uint8_t)val & 0x03U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  It configures the compression algorithm to write non-compressed data at each rate.[get]
+  * @brief  Select the us activity time for IBI (In-Band Interrupt) with I3C[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      CMP_DISABLE, CMP_ALWAYS, CMP_8_TO_1, CMP_16_TO_1, CMP_32_TO_1,
+  * @param  val      IBI_2us, IBI_50us, IBI_1ms, IBI_25ms,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_compress_algo_get(const stmdev_ctx_t *ctx,
-                                          st1vafe6ax_fifo_compress_algo_t *val)
+int32_t st1vafe6ax_i3c_ibi_time_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_i3c_ibi_time_t *val)
 {
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  st1vafe6ax_ctrl5_t ctrl5 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (fifo_ctrl2.uncompr_rate)
+  switch (ctrl5.bus_act_sel)
   {
     case 0x00:
-      *val = ST1VAFE6AX_CMP_DISABLE;
+      *val = ST1VAFE6AX_IBI_2us;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_CMP_8_TO_1;
+      *val = ST1VAFE6AX_IBI_50us;
       break;
 
     case 0x02:
-      *val = ST1VAFE6AX_CMP_16_TO_1;
+      *val = ST1VAFE6AX_IBI_1ms;
       break;
 
     case 0x03:
-      *val = ST1VAFE6AX_CMP_32_TO_1;
+      *val = ST1VAFE6AX_IBI_25ms;
       break;
 
     default:
-      *val = ST1VAFE6AX_CMP_DISABLE;
+      *val = ST1VAFE6AX_IBI_2us;
       break;
   }
   return ret;
 }
 
 /**
-  * @brief  Enables ODR CHANGE virtual sensor to be batched in FIFO.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Enables ODR CHANGE virtual sensor to be batched in FIFO.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @}
   *
   */
-int32_t st1vafe6ax_fifo_virtual_sens_odr_chg_set(const stmdev_ctx_t *ctx,
-                                                 uint8_t val)
-{
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
-  if (ret == 0)
-  {
-    fifo_ctrl2.odr_chg_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
-  }
-
-  return ret;
-}
 
 /**
-  * @brief  Enables ODR CHANGE virtual sensor to be batched in FIFO.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Enables ODR CHANGE virtual sensor to be batched in FIFO.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @defgroup  Interrupt pins
+  * @brief     This section groups all the functions that manage interrupt pins
+  * @{
   *
   */
-int32_t st1vafe6ax_fifo_virtual_sens_odr_chg_get(const stmdev_ctx_t *ctx,
-                                                 uint8_t *val)
-{
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-
-  *val = fifo_ctrl2.odr_chg_en;
-
-  return ret;
-}
 
 /**
-  * @brief  Enables/Disables compression algorithm runtime.[set]
+  * @brief  Push-pull/open-drain selection on INT1 and INT2 pins.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables/Disables compression algorithm runtime.
+  * @param  val      PUSH_PULL, OPEN_DRAIN,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_compress_algo_real_time_set(const stmdev_ctx_t *ctx,
-                                                    uint8_t val)
+int32_t st1vafe6ax_int_pin_mode_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_int_pin_mode_t val)
 {
-  st1vafe6ax_emb_func_en_b_t emb_func_en_b = {0};
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
-
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
-  if (ret == 0)
-  {
-    fifo_ctrl2.fifo_compr_rt_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
-  }
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret == 0)
   {
-    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-
-    if (ret == 0)
-    {
-      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
-    }
-    if (ret == 0)
-    {
-      emb_func_en_b.fifo_compr_en = val & 0x01U;
-      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
-    }
-
-    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+    if_cfg.pp_od = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enables/Disables compression algorithm runtime.[get]
+  * @brief  Push-pull/open-drain selection on INT1 and INT2 pins.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables/Disables compression algorithm runtime.
+  * @param  val      PUSH_PULL, OPEN_DRAIN,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_compress_algo_real_time_get(const stmdev_ctx_t *ctx,
-                                                    uint8_t *val)
+int32_t st1vafe6ax_int_pin_mode_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_int_pin_mode_t *val)
 {
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = fifo_ctrl2.fifo_compr_rt_en;
+  switch (if_cfg.pp_od)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_PUSH_PULL;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_OPEN_DRAIN;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_PUSH_PULL;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Sensing chain FIFO stop values memorization at threshold level.[set]
+  * @brief  Interrupt activation level.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Sensing chain FIFO stop values memorization at threshold level.
+  * @param  val      ACTIVE_HIGH, ACTIVE_LOW,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_stop_on_wtm_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_pin_polarity_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_pin_polarity_t val)
 {
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret == 0)
   {
-    fifo_ctrl2.stop_on_wtm = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+    if_cfg.h_lactive = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Sensing chain FIFO stop values memorization at threshold level.[get]
+  * @brief  Interrupt activation level.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Sensing chain FIFO stop values memorization at threshold level.
+  * @param  val      ACTIVE_HIGH, ACTIVE_LOW,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_stop_on_wtm_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_pin_polarity_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_pin_polarity_t *val)
 {
-  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  st1vafe6ax_if_cfg_t if_cfg = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_IF_CFG, (uint8_t *)&if_cfg, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = fifo_ctrl2.stop_on_wtm;
+  switch (if_cfg.h_lactive)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_ACTIVE_HIGH;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_ACTIVE_LOW;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_ACTIVE_HIGH;
+      break;
+  }
   return ret;
 }
 
-/**
-  * @brief  Selects Batch Data Rate (write frequency in FIFO) for accelerometer data.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_fifo_xl_batch_t enum
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_fifo_xl_batch_set(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_fifo_xl_batch_t val)
+/* Interrupt routing: write a register only if its content changes */
+static int32_t pin_int_route_write(const stmdev_ctx_t *ctx, uint8_t reg,
+                                   uint8_t cur, uint8_t val)
 {
-  st1vafe6ax_fifo_ctrl3_t fifo_ctrl3 = {0};
-  int32_t ret = {0};
+  return (cur != val) ? st1vafe6ax_write_reg(ctx, reg, &val, 1) : 0;
+}
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
-  if (ret == 0)
-  {
-    fifo_ctrl3.bdr_xl = (uint8_t)val & 0xFU;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
-  }
-
-  return ret;
-}
-
-/**
-  * @brief  Selects Batch Data Rate (write frequency in FIFO) for accelerometer data.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_fifo_xl_batch_t enum
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_fifo_xl_batch_get(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_fifo_xl_batch_t *val)
+/*
+ * Interrupt routing: embedded functions / FSM / MLC routes, step counter
+ * overflow. With the register shadow enabled they are taken from the route
+ * cache when valid, and the embedded bank is selected only to change them.
+ */
+static int32_t pin_int_route_emb(const stmdev_ctx_t *ctx, uint8_t pin,
+                                 const st1vafe6ax_pin_int_route_t *val)
 {
-  st1vafe6ax_fifo_ctrl3_t fifo_ctrl3 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  st1vafe6ax_emb_func_int1_t emb_func_int1 = {0};
+  st1vafe6ax_emb_func_int2_t emb_func_int2 = {0};
+  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
+  st1vafe6ax_fsm_int1_t fsm_int = {0};
+  st1vafe6ax_mlc_int1_t mlc_int = {0};
+  uint8_t reg = (pin == 1U) ? ST1VAFE6AX_EMB_FUNC_INT1 : ST1VAFE6AX_EMB_FUNC_INT2;
+  uint8_t mlc = (pin == 1U) ? ST1VAFE6AX_MLC_INT1 : ST1VAFE6AX_MLC_INT2;
+  uint8_t valid = (pin == 1U) ? 0x01U : 0x02U;
+  uint8_t cur[3] = {0};
+  uint8_t upd[3] = {0};
+  uint8_t cache = 0U;
+  uint8_t bank = 0U;
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
-  if (ret != 0)
+  if ((priv != NULL) && (priv->shadow_en != PROPERTY_DISABLE) && (priv->cmd_list == NULL))
   {
-    return ret;
+    cache = 1U;
   }
 
-  switch (fifo_ctrl3.bdr_xl)
+  if ((cache == 1U) && ((priv->route_valid & valid) != 0U))
   {
-    case 0x00:
-      *val = ST1VAFE6AX_XL_NOT_BATCHED;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_1Hz875;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_7Hz5;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_15Hz;
-      break;
+    (void)memcpy(cur, priv->route[pin - 1U], sizeof(cur));
+  }
+  else
+  {
+    /* EMB_FUNC_INTx, FSM_INTx and MLC_INTx */
+    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+    bank = 1U;
+    if (ret == 0)
+    {
+      ret = st1vafe6ax_read_reg(ctx, reg, &cur[0], 2);
+      ret += st1vafe6ax_read_reg(ctx, mlc, &cur[2], 1);
+    }
+  }
 
-    case 0x04:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_30Hz;
-      break;
+  if (ret == 0)
+  {
+    /* FSM_INT1 / FSM_INT2 and MLC_INT1 / MLC_INT2 have the same layout */
+    bytecpy((uint8_t *)&fsm_int, &cur[1]);
+    fsm_int.int1_fsm1 = val->fsm1;
+    fsm_int.int1_fsm2 = val->fsm2;
+    fsm_int.int1_fsm3 = val->fsm3;
+    fsm_int.int1_fsm4 = val->fsm4;
+    fsm_int.int1_fsm5 = val->fsm5;
+    fsm_int.int1_fsm6 = val->fsm6;
+    fsm_int.int1_fsm7 = val->fsm7;
+    fsm_int.int1_fsm8 = val->fsm8;
 
-    case 0x05:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_60Hz;
-      break;
+    bytecpy((uint8_t *)&mlc_int, &cur[2]);
+    mlc_int.int1_mlc1 = val->mlc1;
+    mlc_int.int1_mlc2 = val->mlc2;
+    mlc_int.int1_mlc3 = val->mlc3;
+    mlc_int.int1_mlc4 = val->mlc4;
 
-    case 0x06:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_120Hz;
-      break;
+    if (pin == 1U)
+    {
+      bytecpy((uint8_t *)&emb_func_int1, &cur[0]);
+      emb_func_int1.int1_step_detector = val->step_detector;
+      emb_func_int1.int1_tilt = val->tilt;
+      emb_func_int1.int1_sig_mot = val->sig_mot;
+      emb_func_int1.int1_fsm_lc = val->fsm_lc;
+      bytecpy(&upd[0], (uint8_t *)&emb_func_int1);
+    }
+    else
+    {
+      bytecpy((uint8_t *)&emb_func_int2, &cur[0]);
+      emb_func_int2.int2_step_detector = val->step_detector;
+      emb_func_int2.int2_tilt = val->tilt;
+      emb_func_int2.int2_sig_mot = val->sig_mot;
+      emb_func_int2.int2_fsm_lc = val->fsm_lc;
+      bytecpy(&upd[0], (uint8_t *)&emb_func_int2);
+    }
 
-    case 0x07:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_240Hz;
-      break;
+    bytecpy(&upd[1], (uint8_t *)&fsm_int);
+    bytecpy(&upd[2], (uint8_t *)&mlc_int);
 
-    case 0x08:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_480Hz;
-      break;
+    if ((bank == 0U) && (memcmp(cur, upd, sizeof(cur)) != 0))
+    {
+      ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+      bank = 1U;
+    }
+  }
 
-    case 0x09:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_960Hz;
-      break;
+  if ((ret == 0) && (bank == 1U))
+  {
+    ret = pin_int_route_write(ctx, reg, cur[0], upd[0]);
+    ret += pin_int_route_write(ctx, reg + 1U, cur[1], upd[1]);
+    ret += pin_int_route_write(ctx, mlc, cur[2], upd[2]);
+  }
 
-    case 0x0A:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_1920Hz;
-      break;
+  if (bank == 1U)
+  {
+    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  }
 
-    case 0x0B:
-      *val = ST1VAFE6AX_XL_BATCHED_AT_3840Hz;
-      break;
+  if ((ret == 0) && (cache == 1U))
+  {
+    (void)memcpy(priv->route[pin - 1U], upd, sizeof(upd));
+    priv->route_valid |= valid;
+  }
 
-    default:
-      *val = ST1VAFE6AX_XL_NOT_BATCHED;
-      break;
+  if ((ret == 0) && (cache == 1U) && ((priv->route_valid & 0x04U) != 0U))
+  {
+    bytecpy((uint8_t *)&pedo_cmd_reg, &priv->route_pedo);
+  }
+  else
+  {
+    ret = (ret == 0) ?
+          st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1) : ret;
   }
-  return ret;
-}
 
-/**
-  * @brief  Selects Batch Data Rate (write frequency in FIFO) for gyroscope data.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_fifo_gy_batch_t enum
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_fifo_gy_batch_set(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_fifo_gy_batch_t val)
-{
-  st1vafe6ax_fifo_ctrl3_t fifo_ctrl3 = {0};
-  int32_t ret = {0};
+  if ((ret == 0) && (pedo_cmd_reg.carry_count_en != val->step_count_overflow))
+  {
+    pedo_cmd_reg.carry_count_en = val->step_count_overflow;
+    ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
+  }
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
-  if (ret == 0)
+  if ((ret == 0) && (cache == 1U))
   {
-    fifo_ctrl3.bdr_gy = (uint8_t)val & 0xFU;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
+    bytecpy(&priv->route_pedo, (uint8_t *)&pedo_cmd_reg);
+    priv->route_valid |= 0x04U;
   }
 
   return ret;
 }
 
-/**
-  * @brief  Selects Batch Data Rate (write frequency in FIFO) for gyroscope data.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_fifo_gy_batch_t enum
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_fifo_gy_batch_get(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_fifo_gy_batch_t *val)
+/*
+ * Interrupt routing on INT1 (pin 1) or INT2 (pin 2): the main bank
+ * registers of both pins are read with three bursts and only those whose
+ * content changes are written. The embedded bank routes are handled by
+ * pin_int_route_emb().
+ */
+static int32_t pin_int_route_update(const stmdev_ctx_t *ctx, uint8_t pin,
+                                    const st1vafe6ax_pin_int_route_t *val)
 {
-  st1vafe6ax_fifo_ctrl3_t fifo_ctrl3 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_functions_enable_t functions_enable = {0};
+  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
+  st1vafe6ax_int1_ctrl_t int1_ctrl = {0};
+  st1vafe6ax_int2_ctrl_t int2_ctrl = {0};
+  st1vafe6ax_md1_cfg_t md1_cfg = {0};
+  st1vafe6ax_md2_cfg_t md2_cfg = {0};
+  st1vafe6ax_ctrl4_t ctrl4 = {0};
+  st1vafe6ax_ctrl7_t ctrl7 = {0};
+  uint8_t ctrl[10] = {0}; /* INT1_CTRL ... CTRL7 */
+  uint8_t md[12] = {0};   /* INACTIVITY_DUR ... MD2_CFG */
+  uint8_t fe = 0U;
+  uint8_t emb_any;
+  uint8_t reg_new;
+  int32_t ret;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT1_CTRL, ctrl, 10);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, &fe, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, md, 12);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (fifo_ctrl3.bdr_gy)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_GY_NOT_BATCHED;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_1Hz875;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_7Hz5;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_15Hz;
-      break;
-
-    case 0x04:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_30Hz;
-      break;
+  bytecpy((uint8_t *)&int1_ctrl, &ctrl[ST1VAFE6AX_INT1_CTRL - ST1VAFE6AX_INT1_CTRL]);
+  bytecpy((uint8_t *)&int2_ctrl, &ctrl[ST1VAFE6AX_INT2_CTRL - ST1VAFE6AX_INT1_CTRL]);
+  bytecpy((uint8_t *)&ctrl4, &ctrl[ST1VAFE6AX_CTRL4 - ST1VAFE6AX_INT1_CTRL]);
+  bytecpy((uint8_t *)&ctrl7, &ctrl[ST1VAFE6AX_CTRL7 - ST1VAFE6AX_INT1_CTRL]);
+  bytecpy((uint8_t *)&inactivity_dur, &md[ST1VAFE6AX_INACTIVITY_DUR - ST1VAFE6AX_INACTIVITY_DUR]);
+  bytecpy((uint8_t *)&md1_cfg, &md[ST1VAFE6AX_MD1_CFG - ST1VAFE6AX_INACTIVITY_DUR]);
+  bytecpy((uint8_t *)&md2_cfg, &md[ST1VAFE6AX_MD2_CFG - ST1VAFE6AX_INACTIVITY_DUR]);
+  bytecpy((uint8_t *)&functions_enable, &fe);
 
-    case 0x05:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_60Hz;
-      break;
+  emb_any = ((val->step_detector | val->tilt | val->sig_mot | val->fsm_lc |
+              val->fsm1 | val->fsm2 | val->fsm3 | val->fsm4 |
+              val->fsm5 | val->fsm6 | val->fsm7 | val->fsm8 |
+              val->mlc1 | val->mlc2 | val->mlc3 | val->mlc4) != PROPERTY_DISABLE) ? 1U : 0U;
 
-    case 0x06:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_120Hz;
-      break;
+  ret = pin_int_route_emb(ctx, pin, val);
+  if (ret != 0)
+  {
+    return ret;
+  }
 
-    case 0x07:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_240Hz;
-      break;
+  inactivity_dur.sleep_status_on_int = val->sleep_status;
 
-    case 0x08:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_480Hz;
-      break;
+  if (pin == 1U)
+  {
+    ctrl4.int2_on_int1 = ((val->emb_func_stand_by | val->timestamp) != PROPERTY_DISABLE) ?
+                         PROPERTY_ENABLE : PROPERTY_DISABLE;
+    int2_ctrl.int2_emb_func_endop = val->emb_func_stand_by;
+    md2_cfg.int2_timestamp = val->timestamp;
 
-    case 0x09:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_960Hz;
-      break;
+    int1_ctrl.int1_drdy_xl = val->drdy_xl;
+    int1_ctrl.int1_drdy_g = val->drdy_gy;
+    int1_ctrl.int1_fifo_th = val->fifo_th;
+    int1_ctrl.int1_fifo_ovr = val->fifo_ovr;
+    int1_ctrl.int1_fifo_full = val->fifo_full;
+    int1_ctrl.int1_cnt_bdr = val->fifo_bdr;
 
-    case 0x0A:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_1920Hz;
-      break;
+    md1_cfg.int1_emb_func = (emb_any != 0U) ? PROPERTY_ENABLE : PROPERTY_DISABLE;
+    md1_cfg.int1_6d = val->six_d;
+    md1_cfg.int1_double_tap = val->double_tap;
+    md1_cfg.int1_ff = val->free_fall;
+    md1_cfg.int1_wu = val->wake_up;
+    md1_cfg.int1_single_tap = val->single_tap;
+    md1_cfg.int1_sleep_change = ((val->sleep_status | val->sleep_change) != PROPERTY_DISABLE) ?
+                                PROPERTY_ENABLE : PROPERTY_DISABLE;
+  }
+  else
+  {
+    if ((val->emb_func_stand_by | val->timestamp) != PROPERTY_DISABLE)
+    {
+      ctrl4.int2_on_int1 = PROPERTY_DISABLE;
+    }
 
-    case 0x0B:
-      *val = ST1VAFE6AX_GY_BATCHED_AT_3840Hz;
-      break;
+    int2_ctrl.int2_drdy_xl = val->drdy_xl;
+    int2_ctrl.int2_drdy_g = val->drdy_gy;
+    int2_ctrl.int2_fifo_th = val->fifo_th;
+    int2_ctrl.int2_fifo_ovr = val->fifo_ovr;
+    int2_ctrl.int2_fifo_full = val->fifo_full;
+    int2_ctrl.int2_cnt_bdr = val->fifo_bdr;
+    int2_ctrl.int2_emb_func_endop = val->emb_func_stand_by;
+    ctrl7.int2_drdy_ah_bio = val->drdy_ah_bio;
+
+    md2_cfg.int2_emb_func = (emb_any != 0U) ? PROPERTY_ENABLE : PROPERTY_DISABLE;
+    md2_cfg.int2_6d = val->six_d;
+    md2_cfg.int2_double_tap = val->double_tap;
+    md2_cfg.int2_ff = val->free_fall;
+    md2_cfg.int2_wu = val->wake_up;
+    md2_cfg.int2_single_tap = val->single_tap;
+    md2_cfg.int2_timestamp = val->timestamp;
+    md2_cfg.int2_sleep_change = ((val->sleep_status | val->sleep_change) != PROPERTY_DISABLE) ?
+                                PROPERTY_ENABLE : PROPERTY_DISABLE;
+  }
+
+  /* basic interrupts routed on any pin */
+  functions_enable.interrupts_enable =
+    ((md1_cfg.int1_6d | md1_cfg.int1_double_tap | md1_cfg.int1_ff | md1_cfg.int1_wu |
+      md1_cfg.int1_single_tap | md1_cfg.int1_sleep_change |
+      md2_cfg.int2_6d | md2_cfg.int2_double_tap | md2_cfg.int2_ff | md2_cfg.int2_wu |
+      md2_cfg.int2_single_tap | md2_cfg.int2_sleep_change |
+      inactivity_dur.sleep_status_on_int) != PROPERTY_DISABLE) ?
+    PROPERTY_ENABLE : PROPERTY_DISABLE;
+
+  bytecpy(&reg_new, (uint8_t *)&ctrl4);
+  ret = pin_int_route_write(ctx, ST1VAFE6AX_CTRL4, ctrl[ST1VAFE6AX_CTRL4 - ST1VAFE6AX_INT1_CTRL], reg_new);
+  bytecpy(&reg_new, (uint8_t *)&int2_ctrl);
+  ret += pin_int_route_write(ctx, ST1VAFE6AX_INT2_CTRL, ctrl[ST1VAFE6AX_INT2_CTRL - ST1VAFE6AX_INT1_CTRL], reg_new);
+  bytecpy(&reg_new, (uint8_t *)&ctrl7);
+  ret += pin_int_route_write(ctx, ST1VAFE6AX_CTRL7, ctrl[ST1VAFE6AX_CTRL7 - ST1VAFE6AX_INT1_CTRL], reg_new);
+  bytecpy(&reg_new, (uint8_t *)&md2_cfg);
+  ret += pin_int_route_write(ctx, ST1VAFE6AX_MD2_CFG, md[ST1VAFE6AX_MD2_CFG - ST1VAFE6AX_INACTIVITY_DUR], reg_new);
+  bytecpy(&reg_new, (uint8_t *)&inactivity_dur);
+  ret += pin_int_route_write(ctx, ST1VAFE6AX_INACTIVITY_DUR, md[0], reg_new);
+  bytecpy(&reg_new, (uint8_t *)&int1_ctrl);
+  ret += pin_int_route_write(ctx, ST1VAFE6AX_INT1_CTRL, ctrl[0], reg_new);
+  bytecpy(&reg_new, (uint8_t *)&md1_cfg);
+  ret += pin_int_route_write(ctx, ST1VAFE6AX_MD1_CFG, md[ST1VAFE6AX_MD1_CFG - ST1VAFE6AX_INACTIVITY_DUR], reg_new);
+  bytecpy(&reg_new, (uint8_t *)&functions_enable);
+  ret += pin_int_route_write(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, fe, reg_new);
 
-    default:
-      *val = ST1VAFE6AX_GY_NOT_BATCHED;
-      break;
-  }
   return ret;
 }
 
 /**
-  * @brief  FIFO mode selection.[set]
+  * @brief  It routes interrupt signals on INT 1 pin.[set]
+  *         Only the registers whose content changes are written.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      BYPASS_MODE, FIFO_MODE, STREAM_WTM_TO_FULL_MODE, STREAM_TO_FIFO_MODE, BYPASS_TO_STREAM_MODE, STREAM_MODE, BYPASS_TO_FIFO_MODE,
+  * @param  val      It routes interrupt signals on INT 1 pin.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_mode_set(const stmdev_ctx_t *ctx,
-                                 st1vafe6ax_fifo_mode_t val)
+int32_t st1vafe6ax_pin_int1_route_set(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_pin_int_route_t val)
 {
-  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
-  if (ret == 0)
-  {
-    fifo_ctrl4.fifo_mode = (uint8_t)val & 0x07U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
-  }
-
-  return ret;
+  return pin_int_route_update(ctx, 1U, &val);
 }
 
 /**
-  * @brief  FIFO mode selection.[get]
+  * @brief  It routes interrupt signals on INT 1 pin.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      BYPASS_MODE, FIFO_MODE, STREAM_WTM_TO_FULL_MODE, STREAM_TO_FIFO_MODE, BYPASS_TO_STREAM_MODE, STREAM_MODE, BYPASS_TO_FIFO_MODE,
+  * @param  val      It routes interrupt signals on INT 1 pin.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_mode_get(const stmdev_ctx_t *ctx,
-                                 st1vafe6ax_fifo_mode_t *val)
+int32_t st1vafe6ax_pin_int1_route_get(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_pin_int_route_t *val)
 {
-  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
+  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
+  st1vafe6ax_emb_func_int1_t emb_func_int1 = {0};
+  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
+  st1vafe6ax_int1_ctrl_t int1_ctrl = {0};
+  st1vafe6ax_int2_ctrl_t int2_ctrl = {0};
+  st1vafe6ax_fsm_int1_t fsm_int1 = {0};
+  st1vafe6ax_mlc_int1_t mlc_int1 = {0};
+  st1vafe6ax_md1_cfg_t md1_cfg = {0};
+  st1vafe6ax_md2_cfg_t md2_cfg = {0};
+  st1vafe6ax_ctrl4_t ctrl4 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
 
-  switch (fifo_ctrl4.fifo_mode)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
+  if (ctrl4.int2_on_int1 == PROPERTY_ENABLE)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_BYPASS_MODE;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_FIFO_MODE;
-      break;
+    if (ret == 0)
+    {
+      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
+    }
 
-    case 0x02:
-      *val = ST1VAFE6AX_STREAM_WTM_TO_FULL_MODE;
-      break;
+    if (ret == 0)
+    {
+      val->emb_func_stand_by = int2_ctrl.int2_emb_func_endop;
+      val->timestamp = md2_cfg.int2_timestamp;
+    }
+  }
 
-    case 0x03:
-      *val = ST1VAFE6AX_STREAM_TO_FIFO_MODE;
-      break;
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT1_CTRL, (uint8_t *)&int1_ctrl, 1);
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD1_CFG, (uint8_t *)&md1_cfg, 1);
+  }
 
-    case 0x04:
-      *val = ST1VAFE6AX_BYPASS_TO_STREAM_MODE;
-      break;
 
-    case 0x06:
-      *val = ST1VAFE6AX_STREAM_MODE;
-      break;
+  if (ret == 0)
+  {
+    val->sleep_status = inactivity_dur.sleep_status_on_int;
 
-    case 0x07:
-      *val = ST1VAFE6AX_BYPASS_TO_FIFO_MODE;
-      break;
+    val->drdy_xl   = int1_ctrl.int1_drdy_xl;
+    val->drdy_gy   = int1_ctrl.int1_drdy_g;
+    val->fifo_th   = int1_ctrl.int1_fifo_th;
+    val->fifo_ovr  = int1_ctrl.int1_fifo_ovr;
+    val->fifo_full = int1_ctrl.int1_fifo_full;
+    val->fifo_bdr  = int1_ctrl.int1_cnt_bdr;
 
-    default:
-      *val = ST1VAFE6AX_BYPASS_MODE;
-      break;
+    val->six_d        = md1_cfg.int1_6d;
+    val->double_tap   = md1_cfg.int1_double_tap;
+    val->free_fall    = md1_cfg.int1_ff;
+    val->wake_up      = md1_cfg.int1_wu;
+    val->single_tap   = md1_cfg.int1_single_tap;
+    val->sleep_change = md1_cfg.int1_sleep_change;
+  }
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+
+    if (ret == 0)
+    {
+      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_INT1, (uint8_t *)&emb_func_int1, 1);
+      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_INT1, (uint8_t *)&fsm_int1, 1);
+      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_INT1, (uint8_t *)&mlc_int1, 1);
+    }
+
+    if (ret == 0)
+    {
+      val->step_detector = emb_func_int1.int1_step_detector;
+      val->tilt          = emb_func_int1.int1_tilt;
+      val->sig_mot       = emb_func_int1.int1_sig_mot;
+      val->fsm_lc        = emb_func_int1.int1_fsm_lc;
+
+      val->fsm1 = fsm_int1.int1_fsm1;
+      val->fsm2 = fsm_int1.int1_fsm2;
+      val->fsm3 = fsm_int1.int1_fsm3;
+      val->fsm4 = fsm_int1.int1_fsm4;
+      val->fsm5 = fsm_int1.int1_fsm5;
+      val->fsm6 = fsm_int1.int1_fsm6;
+      val->fsm7 = fsm_int1.int1_fsm7;
+      val->fsm8 = fsm_int1.int1_fsm8;
+
+      val->mlc1 = mlc_int1.int1_mlc1;
+      val->mlc2 = mlc_int1.int1_mlc2;
+      val->mlc3 = mlc_int1.int1_mlc3;
+      val->mlc4 = mlc_int1.int1_mlc4;
+    }
+
+    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  }
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
+  }
+
+  if (ret == 0)
+  {
+    val->step_count_overflow = pedo_cmd_reg.carry_count_en;
   }
+
   return ret;
 }
 
+
 /**
-  * @brief  Selects batch data rate (write frequency in FIFO) for temperature data.[set]
+  * @brief  It routes interrupt signals on INT 2 pin.[set]
+  *         Only the registers whose content changes are written.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      TEMP_NOT_BATCHED, TEMP_BATCHED_AT_1Hz875, TEMP_BATCHED_AT_15Hz, TEMP_BATCHED_AT_60Hz,
+  * @param  val      It routes interrupt signals on INT 2 pin.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_temp_batch_set(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_fifo_temp_batch_t val)
+int32_t st1vafe6ax_pin_int2_route_set(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_pin_int_route_t val)
 {
-  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
-  if (ret == 0)
-  {
-    fifo_ctrl4.odr_t_batch = (uint8_t)val & 0x03U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
-  }
-
-  return ret;
+  return pin_int_route_update(ctx, 2U, &val);
 }
 
 /**
-  * @brief  Selects batch data rate (write frequency in FIFO) for temperature data.[get]
+  * @brief  It routes interrupt signals on INT 2 pin.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      TEMP_NOT_BATCHED, TEMP_BATCHED_AT_1Hz875, TEMP_BATCHED_AT_15Hz, TEMP_BATCHED_AT_60Hz,
+  * @param  val      It routes interrupt signals on INT 2 pin.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_temp_batch_get(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_fifo_temp_batch_t *val)
+int32_t st1vafe6ax_pin_int2_route_get(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_pin_int_route_t *val)
 {
-  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
+  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
+  st1vafe6ax_emb_func_int2_t emb_func_int2 = {0};
+  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
+  st1vafe6ax_int2_ctrl_t int2_ctrl = {0};
+  st1vafe6ax_fsm_int2_t fsm_int2 = {0};
+  st1vafe6ax_mlc_int2_t mlc_int2 = {0};
+  st1vafe6ax_ctrl7_t ctrl7 = {0};
+  st1vafe6ax_md2_cfg_t md2_cfg = {0};
+  st1vafe6ax_ctrl4_t ctrl4 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL4, (uint8_t *)&ctrl4, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (fifo_ctrl4.odr_t_batch)
+  if (ctrl4.int2_on_int1 == PROPERTY_DISABLE)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_TEMP_NOT_BATCHED;
-      break;
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
+    if (ret != 0)
+    {
+      return ret;
+    }
 
-    case 0x01:
-      *val = ST1VAFE6AX_TEMP_BATCHED_AT_1Hz875;
-      break;
+    val->timestamp = md2_cfg.int2_timestamp;
+    val->emb_func_stand_by = int2_ctrl.int2_emb_func_endop;
+  }
 
-    case 0x02:
-      *val = ST1VAFE6AX_TEMP_BATCHED_AT_15Hz;
-      break;
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INT2_CTRL, (uint8_t *)&int2_ctrl, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MD2_CFG, (uint8_t *)&md2_cfg, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
 
-    case 0x03:
-      *val = ST1VAFE6AX_TEMP_BATCHED_AT_60Hz;
-      break;
+  val->sleep_status = inactivity_dur.sleep_status_on_int;
 
-    default:
-      *val = ST1VAFE6AX_TEMP_NOT_BATCHED;
-      break;
+  val->drdy_xl = int2_ctrl.int2_drdy_xl;
+  val->drdy_gy = int2_ctrl.int2_drdy_g;
+  val->fifo_th = int2_ctrl.int2_fifo_th;
+  val->fifo_ovr = int2_ctrl.int2_fifo_ovr;
+  val->fifo_full = int2_ctrl.int2_fifo_full;
+  val->fifo_bdr = int2_ctrl.int2_cnt_bdr;
+
+  val->six_d = md2_cfg.int2_6d;
+  val->double_tap = md2_cfg.int2_double_tap;
+  val->free_fall = md2_cfg.int2_ff;
+  val->wake_up = md2_cfg.int2_wu;
+  val->single_tap = md2_cfg.int2_single_tap;
+  val->sleep_change = md2_cfg.int2_sleep_change;
+
+  val->drdy_ah_bio = ctrl7.int2_drdy_ah_bio;
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_INT2, (uint8_t *)&emb_func_int2, 1);
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_INT2, (uint8_t *)&fsm_int2, 1);
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_INT2, (uint8_t *)&mlc_int2, 1);
+  }
+
+  if (ret == 0)
+  {
+    val->step_detector = emb_func_int2.int2_step_detector;
+    val->tilt = emb_func_int2.int2_tilt;
+    val->sig_mot = emb_func_int2.int2_sig_mot;
+    val->fsm_lc = emb_func_int2.int2_fsm_lc;
+
+    val->fsm1 = fsm_int2.int2_fsm1;
+    val->fsm2 = fsm_int2.int2_fsm2;
+    val->fsm3 = fsm_int2.int2_fsm3;
+    val->fsm4 = fsm_int2.int2_fsm4;
+    val->fsm5 = fsm_int2.int2_fsm5;
+    val->fsm6 = fsm_int2.int2_fsm6;
+    val->fsm7 = fsm_int2.int2_fsm7;
+    val->fsm8 = fsm_int2.int2_fsm8;
+
+    val->mlc1 = mlc_int2.int2_mlc1;
+    val->mlc2 = mlc_int2.int2_mlc2;
+    val->mlc3 = mlc_int2.int2_mlc3;
+    val->mlc4 = mlc_int2.int2_mlc4;
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
+  }
+
+  if (ret == 0)
+  {
+    val->step_count_overflow = pedo_cmd_reg.carry_count_en;
   }
+
   return ret;
 }
 
 /**
-  * @brief  Selects decimation for timestamp batching in FIFO. Write rate will be the maximum rate between XL and GYRO BDR divided by decimation decoder.[set]
+  * @brief  Interrupt pin routing to ST1VAFE6AX_EVENT_* bitmask.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      TMSTMP_NOT_BATCHED, TMSTMP_DEC_1, TMSTMP_DEC_8, TMSTMP_DEC_32,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  val      signals routed to the interrupt pin
+  * @retval          bitmask of ST1VAFE6AX_EVENT_* flags
   *
   */
-int32_t st1vafe6ax_fifo_timestamp_batch_set(const stmdev_ctx_t *ctx,
-                                            st1vafe6ax_fifo_timestamp_batch_t val)
+uint64_t st1vafe6ax_pin_int_route_to_mask(const st1vafe6ax_pin_int_route_t *val)
 {
-  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
-  int32_t ret = {0};
+  uint64_t mask = 0U;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
-  if (ret == 0)
-  {
-    fifo_ctrl4.dec_ts_batch = (uint8_t)val & 0x3U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
-  }
+  mask |= (val->drdy_xl != 0U) ? ST1VAFE6AX_EVENT_DRDY_XL : 0U;
+  mask |= (val->drdy_gy != 0U) ? ST1VAFE6AX_EVENT_DRDY_GY : 0U;
+  mask |= (val->drdy_ah_bio != 0U) ? ST1VAFE6AX_EVENT_DRDY_AH_BIO : 0U;
+  mask |= (val->fifo_th != 0U) ? ST1VAFE6AX_EVENT_FIFO_TH : 0U;
+  mask |= (val->fifo_ovr != 0U) ? ST1VAFE6AX_EVENT_FIFO_OVR : 0U;
+  mask |= (val->fifo_full != 0U) ? ST1VAFE6AX_EVENT_FIFO_FULL : 0U;
+  mask |= (val->fifo_bdr != 0U) ? ST1VAFE6AX_EVENT_FIFO_BDR : 0U;
+  mask |= (val->timestamp != 0U) ? ST1VAFE6AX_EVENT_TIMESTAMP : 0U;
+  mask |= (val->six_d != 0U) ? ST1VAFE6AX_EVENT_SIX_D : 0U;
+  mask |= (val->double_tap != 0U) ? ST1VAFE6AX_EVENT_DOUBLE_TAP : 0U;
+  mask |= (val->free_fall != 0U) ? ST1VAFE6AX_EVENT_FREE_FALL : 0U;
+  mask |= (val->wake_up != 0U) ? ST1VAFE6AX_EVENT_WAKE_UP : 0U;
+  mask |= (val->single_tap != 0U) ? ST1VAFE6AX_EVENT_SINGLE_TAP : 0U;
+  mask |= (val->sleep_change != 0U) ? ST1VAFE6AX_EVENT_SLEEP_CHANGE : 0U;
+  mask |= (val->sleep_status != 0U) ? ST1VAFE6AX_EVENT_SLEEP_STATE : 0U;
+  mask |= (val->step_detector != 0U) ? ST1VAFE6AX_EVENT_STEP_DET : 0U;
+  mask |= (val->step_count_overflow != 0U) ? ST1VAFE6AX_EVENT_STEP_COUNT_OVERFLOW : 0U;
+  mask |= (val->tilt != 0U) ? ST1VAFE6AX_EVENT_TILT : 0U;
+  mask |= (val->sig_mot != 0U) ? ST1VAFE6AX_EVENT_SIG_MOT : 0U;
+  mask |= (val->emb_func_stand_by != 0U) ? ST1VAFE6AX_EVENT_EMB_FUNC_STAND_BY : 0U;
+  mask |= (val->fsm_lc != 0U) ? ST1VAFE6AX_EVENT_FSM_LC : 0U;
+  mask |= (val->fsm1 != 0U) ? ST1VAFE6AX_EVENT_FSM(1U) : 0U;
+  mask |= (val->fsm2 != 0U) ? ST1VAFE6AX_EVENT_FSM(2U) : 0U;
+  mask |= (val->fsm3 != 0U) ? ST1VAFE6AX_EVENT_FSM(3U) : 0U;
+  mask |= (val->fsm4 != 0U) ? ST1VAFE6AX_EVENT_FSM(4U) : 0U;
+  mask |= (val->fsm5 != 0U) ? ST1VAFE6AX_EVENT_FSM(5U) : 0U;
+  mask |= (val->fsm6 != 0U) ? ST1VAFE6AX_EVENT_FSM(6U) : 0U;
+  mask |= (val->fsm7 != 0U) ? ST1VAFE6AX_EVENT_FSM(7U) : 0U;
+  mask |= (val->fsm8 != 0U) ? ST1VAFE6AX_EVENT_FSM(8U) : 0U;
+  mask |= (val->mlc1 != 0U) ? ST1VAFE6AX_EVENT_MLC(1U) : 0U;
+  mask |= (val->mlc2 != 0U) ? ST1VAFE6AX_EVENT_MLC(2U) : 0U;
+  mask |= (val->mlc3 != 0U) ? ST1VAFE6AX_EVENT_MLC(3U) : 0U;
+  mask |= (val->mlc4 != 0U) ? ST1VAFE6AX_EVENT_MLC(4U) : 0U;
 
-  return ret;
+  return mask;
 }
 
 /**
-  * @brief  Selects decimation for timestamp batching in FIFO. Write rate will be the maximum rate between XL and GYRO BDR divided by decimation decoder.[get]
+  * @brief  ST1VAFE6AX_EVENT_* bitmask to interrupt pin routing.
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      TMSTMP_NOT_BATCHED, TMSTMP_DEC_1, TMSTMP_DEC_8, TMSTMP_DEC_32,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  mask     bitmask of ST1VAFE6AX_EVENT_* flags
+  * @param  val      signals routed to the interrupt pin
   *
   */
-int32_t st1vafe6ax_fifo_timestamp_batch_get(const stmdev_ctx_t *ctx,
-                                            st1vafe6ax_fifo_timestamp_batch_t *val)
+void st1vafe6ax_pin_int_route_from_mask(uint64_t mask, st1vafe6ax_pin_int_route_t *val)
 {
-  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
-  int32_t ret = {0};
+  val->drdy_xl = ((mask & ST1VAFE6AX_EVENT_DRDY_XL) != 0U) ? 1U : 0U;
+  val->drdy_gy = ((mask & ST1VAFE6AX_EVENT_DRDY_GY) != 0U) ? 1U : 0U;
+  val->drdy_ah_bio = ((mask & ST1VAFE6AX_EVENT_DRDY_AH_BIO) != 0U) ? 1U : 0U;
+  val->fifo_th = ((mask & ST1VAFE6AX_EVENT_FIFO_TH) != 0U) ? 1U : 0U;
+  val->fifo_ovr = ((mask & ST1VAFE6AX_EVENT_FIFO_OVR) != 0U) ? 1U : 0U;
+  val->fifo_full = ((mask & ST1VAFE6AX_EVENT_FIFO_FULL) != 0U) ? 1U : 0U;
+  val->fifo_bdr = ((mask & ST1VAFE6AX_EVENT_FIFO_BDR) != 0U) ? 1U : 0U;
+  val->timestamp = ((mask & ST1VAFE6AX_EVENT_TIMESTAMP) != 0U) ? 1U : 0U;
+  val->six_d = ((mask & ST1VAFE6AX_EVENT_SIX_D) != 0U) ? 1U : 0U;
+  val->double_tap = ((mask & ST1VAFE6AX_EVENT_DOUBLE_TAP) != 0U) ? 1U : 0U;
+  val->free_fall = ((mask & ST1VAFE6AX_EVENT_FREE_FALL) != 0U) ? 1U : 0U;
+  val->wake_up = ((mask & ST1VAFE6AX_EVENT_WAKE_UP) != 0U) ? 1U : 0U;
+  val->single_tap = ((mask & ST1VAFE6AX_EVENT_SINGLE_TAP) != 0U) ? 1U : 0U;
+  val->sleep_change = ((mask & ST1VAFE6AX_EVENT_SLEEP_CHANGE) != 0U) ? 1U : 0U;
+  val->sleep_status = ((mask & ST1VAFE6AX_EVENT_SLEEP_STATE) != 0U) ? 1U : 0U;
+  val->step_detector = ((mask & ST1VAFE6AX_EVENT_STEP_DET) != 0U) ? 1U : 0U;
+  val->step_count_overflow = ((mask & ST1VAFE6AX_EVENT_STEP_COUNT_OVERFLOW) != 0U) ? 1U : 0U;
+  val->tilt = ((mask & ST1VAFE6AX_EVENT_TILT) != 0U) ? 1U : 0U;
+  val->sig_mot = ((mask & ST1VAFE6AX_EVENT_SIG_MOT) != 0U) ? 1U : 0U;
+  val->emb_func_stand_by = ((mask & ST1VAFE6AX_EVENT_EMB_FUNC_STAND_BY) != 0U) ? 1U : 0U;
+  val->fsm_lc = ((mask & ST1VAFE6AX_EVENT_FSM_LC) != 0U) ? 1U : 0U;
+  val->fsm1 = ((mask & ST1VAFE6AX_EVENT_FSM(1U)) != 0U) ? 1U : 0U;
+  val->fsm2 = ((mask & ST1VAFE6AX_EVENT_FSM(2U)) != 0U) ? 1U : 0U;
+  val->fsm3 = ((mask & ST1VAFE6AX_EVENT_FSM(3U)) != 0U) ? 1U : 0U;
+  val->fsm4 = ((mask & ST1VAFE6AX_EVENT_FSM(4U)) != 0U) ? 1U : 0U;
+  val->fsm5 = ((mask & ST1VAFE6AX_EVENT_FSM(5U)) != 0U) ? 1U : 0U;
+  val->fsm6 = ((mask & ST1VAFE6AX_EVENT_FSM(6U)) != 0U) ? 1U : 0U;
+  val->fsm7 = ((mask & ST1VAFE6AX_EVENT_FSM(7U)) != 0U) ? 1U : 0U;
+  val->fsm8 = ((mask & ST1VAFE6AX_EVENT_FSM(8U)) != 0U) ? 1U : 0U;
+  val->mlc1 = ((mask & ST1VAFE6AX_EVENT_MLC(1U)) != 0U) ? 1U : 0U;
+  val->mlc2 = ((mask & ST1VAFE6AX_EVENT_MLC(2U)) != 0U) ? 1U : 0U;
+  val->mlc3 = ((mask & ST1VAFE6AX_EVENT_MLC(3U)) != 0U) ? 1U : 0U;
+  val->mlc4 = ((mask & ST1VAFE6AX_EVENT_MLC(4U)) != 0U) ? 1U : 0U;
+}
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-
-  switch (fifo_ctrl4.dec_ts_batch)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_TMSTMP_NOT_BATCHED;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_TMSTMP_DEC_1;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_TMSTMP_DEC_8;
-      break;
+/**
+  * @brief  Route interrupt signals on int1 pin, as ST1VAFE6AX_EVENT_*
+  *         bitmask.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      bitmask of the signals to route on int1 pin
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_pin_int1_route_mask_set(const stmdev_ctx_t *ctx, uint64_t val)
+{
+  st1vafe6ax_pin_int_route_t route = {0};
 
-    case 0x03:
-      *val = ST1VAFE6AX_TMSTMP_DEC_32;
-      break;
+  st1vafe6ax_pin_int_route_from_mask(val, &route);
 
-    default:
-      *val = ST1VAFE6AX_TMSTMP_NOT_BATCHED;
-      break;
-  }
-  return ret;
+  return st1vafe6ax_pin_int1_route_set(ctx, route);
 }
 
 /**
-  * @brief  The threshold for the internal counter of batch events. When this counter reaches the threshold, the counter is reset and the interrupt flag is set to 1.[set]
+  * @brief  Route interrupt signals on int1 pin, as ST1VAFE6AX_EVENT_*
+  *         bitmask.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      The threshold for the internal counter of batch events. When this counter reaches the threshold, the counter is reset and the interrupt flag is set to 1.
+  * @param  val      bitmask of the signals routed on int1 pin
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_batch_counter_threshold_set(const stmdev_ctx_t *ctx,
-                                                    uint16_t val)
+int32_t st1vafe6ax_pin_int1_route_mask_get(const stmdev_ctx_t *ctx, uint64_t *val)
 {
-  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
-  st1vafe6ax_counter_bdr_reg2_t counter_bdr_reg2 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  st1vafe6ax_pin_int_route_t route = {0};
+  int32_t ret;
 
+  ret = st1vafe6ax_pin_int1_route_get(ctx, &route);
   if (ret == 0)
   {
-    counter_bdr_reg2.cnt_bdr_th = (uint8_t)val & 0xFFU;
-    counter_bdr_reg1.cnt_bdr_th = (uint8_t)(val >> 8) & 0x3U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
-    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG2, (uint8_t *)&counter_bdr_reg2, 1);
+    *val = st1vafe6ax_pin_int_route_to_mask(&route);
   }
 
   return ret;
 }
 
 /**
-  * @brief  The threshold for the internal counter of batch events. When this counter reaches the threshold, the counter is reset and the interrupt flag is set to 1.[get]
+  * @brief  Route interrupt signals on int2 pin, as ST1VAFE6AX_EVENT_*
+  *         bitmask.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      The threshold for the internal counter of batch events. When this counter reaches the threshold, the counter is reset and the interrupt flag is set to 1.
+  * @param  val      bitmask of the signals to route on int2 pin
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_batch_counter_threshold_get(const stmdev_ctx_t *ctx,
-                                                    uint16_t *val)
+int32_t st1vafe6ax_pin_int2_route_mask_set(const stmdev_ctx_t *ctx, uint64_t val)
 {
-  uint8_t buff[2] = {0};
-  int32_t ret = {0};
+  st1vafe6ax_pin_int_route_t route = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, &buff[0], 2);
-  if (ret != 0)
+  st1vafe6ax_pin_int_route_from_mask(val, &route);
+
+  return st1vafe6ax_pin_int2_route_set(ctx, route);
+}
+
+/**
+  * @brief  Route interrupt signals on int2 pin, as ST1VAFE6AX_EVENT_*
+  *         bitmask.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      bitmask of the signals routed on int2 pin
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_pin_int2_route_mask_get(const stmdev_ctx_t *ctx, uint64_t *val)
+{
+  st1vafe6ax_pin_int_route_t route = {0};
+  int32_t ret;
+
+  ret = st1vafe6ax_pin_int2_route_get(ctx, &route);
+  if (ret == 0)
   {
-    return ret;
+    *val = st1vafe6ax_pin_int_route_to_mask(&route);
   }
 
-  *val = (uint16_t)(buff[1] | ((uint16_t)(buff[0] & 0x03U) << 8));
-
   return ret;
 }
 
 /**
-  * @brief  Enables AH_BIO batching in FIFO.[set]
+  * @brief  Enables INT pin when I3C is enabled.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables AH_BIO batching in FIFO.
+  * @param  val      Enables INT pin when I3C is enabled.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_batch_ah_bio_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_pin_int_en_when_i2c_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
+  st1vafe6ax_ctrl5_t ctrl5 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
   if (ret == 0)
   {
-    counter_bdr_reg1.ah_bio_batch_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+    ctrl5.int_en_i3c = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Enables AH_BIO batching in FIFO.[get]
+  * @brief  Enables INT pin when I3C is enabled.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables AH_BIO batching in FIFO.
+  * @param  val      Enables INT pin when I3C is enabled.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_batch_ah_bio_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_pin_int_en_when_i2c_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
+  st1vafe6ax_ctrl5_t ctrl5 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL5, (uint8_t *)&ctrl5, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = counter_bdr_reg1.ah_bio_batch_en;
+  *val = ctrl5.int_en_i3c;
 
   return ret;
 }
 
 /**
-  * @brief  Selects the trigger for the internal counter of batch events between the accelerometer, gyroscope.[set]
+  * @brief  Interrupt notification mode.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      XL_BATCH_EVENT, GY_BATCH_EVENT
+  * @param  val      ALL_INT_PULSED, BASE_LATCHED_EMB_PULSED, BASE_PULSED_EMB_LATCHED, ALL_INT_LATCHED,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_batch_cnt_event_set(const stmdev_ctx_t *ctx,
-                                            st1vafe6ax_fifo_batch_cnt_event_t val)
+int32_t st1vafe6ax_int_notification_set(const stmdev_ctx_t *ctx,
+                                        st1vafe6ax_int_notification_t val)
 {
-  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
+  st1vafe6ax_page_rw_t page_rw = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+  if (ret == 0)
+  {
+    tap_cfg0.lir = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+  }
 
   if (ret == 0)
   {
-    counter_bdr_reg1.trig_counter_bdr = (uint8_t)val & 0x03U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+
+    if (ret == 0)
+    {
+      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
+    }
+
+    if (ret == 0)
+    {
+      page_rw.emb_func_lir = ((uint8_t)val & 0x02U) >> 1;
+      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
+    }
+
+    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Selects the trigger for the internal counter of batch events between the accelerometer, gyroscope.[get]
+  * @brief  Interrupt notification mode.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      XL_BATCH_EVENT, GY_BATCH_EVENT
+  * @param  val      ALL_INT_PULSED, BASE_LATCHED_EMB_PULSED, BASE_PULSED_EMB_LATCHED, ALL_INT_LATCHED,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_batch_cnt_event_get(const stmdev_ctx_t *ctx,
-                                            st1vafe6ax_fifo_batch_cnt_event_t *val)
+int32_t st1vafe6ax_int_notification_get(const stmdev_ctx_t *ctx,
+                                        st1vafe6ax_int_notification_t *val)
 {
-  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
+  st1vafe6ax_page_rw_t page_rw = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+
+    if (ret == 0)
+    {
+      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PAGE_RW, (uint8_t *)&page_rw, 1);
+    }
+
+    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  }
+
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (counter_bdr_reg1.trig_counter_bdr)
+  switch ((page_rw.emb_func_lir << 1) + tap_cfg0.lir)
   {
     case 0x00:
-      *val = ST1VAFE6AX_XL_BATCH_EVENT;
+      *val = ST1VAFE6AX_ALL_INT_PULSED;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_GY_BATCH_EVENT;
+      *val = ST1VAFE6AX_BASE_LATCHED_EMB_PULSED;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_BASE_PULSED_EMB_LATCHED;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_ALL_INT_LATCHED;
       break;
 
     default:
-      *val = ST1VAFE6AX_XL_BATCH_EVENT;
+      *val = ST1VAFE6AX_ALL_INT_PULSED;
       break;
   }
   return ret;
 }
 
 /**
-  * @brief  Batching in FIFO buffer of SFLP.[set]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  Wake Up event and Activity / Inactivity detection
+  * @brief     This section groups all the functions that manage the Wake Up
+  *            event generation.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enable activity/inactivity (sleep) function.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Batching in FIFO buffer of SFLP values.
+  * @param  val      XL_AND_GY_NOT_AFFECTED, XL_LOW_POWER_GY_NOT_AFFECTED, XL_LOW_POWER_GY_SLEEP, XL_LOW_POWER_GY_POWER_DOWN,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_sflp_batch_set(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_fifo_sflp_raw_t val)
+int32_t st1vafe6ax_act_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_act_mode_t val)
 {
-  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  st1vafe6ax_functions_enable_t functions_enable = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
-  }
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
   if (ret == 0)
   {
-    emb_func_fifo_en_a.sflp_game_fifo_en = val.game_rotation;
-    emb_func_fifo_en_a.sflp_gravity_fifo_en = val.gravity;
-    emb_func_fifo_en_a.sflp_gbias_fifo_en = val.gbias;
-    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A,
-                                (uint8_t *)&emb_func_fifo_en_a, 1);
+    functions_enable.inact_en = (uint8_t)val & 0x03U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
   return ret;
 }
 
 /**
-  * @brief  Batching in FIFO buffer of SFLP.[get]
+  * @brief  Enable activity/inactivity (sleep) function.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Batching in FIFO buffer of SFLP values.
+  * @param  val      XL_AND_GY_NOT_AFFECTED, XL_LOW_POWER_GY_NOT_AFFECTED, XL_LOW_POWER_GY_SLEEP, XL_LOW_POWER_GY_POWER_DOWN,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_sflp_batch_get(const stmdev_ctx_t *ctx,
-                                       st1vafe6ax_fifo_sflp_raw_t *val)
+int32_t st1vafe6ax_act_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_act_mode_t *val)
 {
-  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  st1vafe6ax_functions_enable_t functions_enable = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNCTIONS_ENABLE, (uint8_t *)&functions_enable, 1);
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+    return ret;
   }
 
-  if (ret == 0)
+  switch (functions_enable.inact_en)
   {
-    val->game_rotation = emb_func_fifo_en_a.sflp_game_fifo_en;
-    val->gravity = emb_func_fifo_en_a.sflp_gravity_fifo_en;
-    val->gbias = emb_func_fifo_en_a.sflp_gbias_fifo_en;
-  }
+    case 0x00:
+      *val = ST1VAFE6AX_XL_AND_GY_NOT_AFFECTED;
+      break;
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+    case 0x01:
+      *val = ST1VAFE6AX_XL_LOW_POWER_GY_NOT_AFFECTED;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_XL_LOW_POWER_GY_SLEEP;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_XL_LOW_POWER_GY_POWER_DOWN;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_XL_AND_GY_NOT_AFFECTED;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Status of FIFO.[get]
+  * @brief  Duration in the transition from Stationary to Motion (from Inactivity to Activity).[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Status of FIFO (level and flags).
+  * @param  val      SLEEP_TO_ACT_AT_1ST_SAMPLE, SLEEP_TO_ACT_AT_2ND_SAMPLE, SLEEP_TO_ACT_AT_3RD_SAMPLE, SLEEP_TO_ACT_AT_4th_SAMPLE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_status_get(const stmdev_ctx_t *ctx,
-                                   st1vafe6ax_fifo_status_t *val)
+int32_t st1vafe6ax_act_from_sleep_to_act_dur_set(const stmdev_ctx_t *ctx,
+                                                 st1vafe6ax_act_from_sleep_to_act_dur_t val)
 {
-  uint8_t buff[2] = {0};
-  st1vafe6ax_fifo_status2_t status = {0};
+  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_STATUS1, (uint8_t *)&buff[0], 2);
-  if (ret != 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+  if (ret == 0)
   {
-    return ret;
+    inactivity_dur.inact_dur = (uint8_t)val & 0x3U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
   }
 
-  bytecpy((uint8_t *)&status, &buff[1]);
-
-  val->fifo_bdr = status.counter_bdr_ia;
-  val->fifo_ovr = status.fifo_ovr_ia;
-  val->fifo_full = status.fifo_full_ia;
-  val->fifo_th = status.fifo_wtm_ia;
-
-  val->fifo_level = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8)) & 0x1FU;
-
   return ret;
 }
 
 /**
-  * @brief  FIFO data output[get]
+  * @brief  Duration in the transition from Stationary to Motion (from Inactivity to Activity).[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      st1vafe6ax_fifo_out_raw_t enum
+  * @param  val      SLEEP_TO_ACT_AT_1ST_SAMPLE, SLEEP_TO_ACT_AT_2ND_SAMPLE, SLEEP_TO_ACT_AT_3RD_SAMPLE, SLEEP_TO_ACT_AT_4th_SAMPLE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_out_raw_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_fifo_out_raw_t *val)
+int32_t st1vafe6ax_act_from_sleep_to_act_dur_get(const stmdev_ctx_t *ctx,
+                                                 st1vafe6ax_act_from_sleep_to_act_dur_t *val)
 {
-  st1vafe6ax_fifo_data_out_tag_t fifo_data_out_tag = {0};
-  uint8_t buff[7] = {0};
+  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_DATA_OUT_TAG, buff, 7);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  bytecpy((uint8_t *)&fifo_data_out_tag, &buff[0]);
-
-  switch (fifo_data_out_tag.tag_sensor)
+  switch (inactivity_dur.inact_dur)
   {
     case 0x00:
-      val->tag = ST1VAFE6AX_FIFO_EMPTY;
+      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_1ST_SAMPLE;
       break;
 
     case 0x01:
-      val->tag = ST1VAFE6AX_GY_NC_TAG;
+      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_2ND_SAMPLE;
       break;
 
     case 0x02:
-      val->tag = ST1VAFE6AX_XL_NC_TAG;
+      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_3RD_SAMPLE;
       break;
 
     case 0x03:
-      val->tag = ST1VAFE6AX_TEMPERATURE_TAG;
-      break;
-
-    case 0x04:
-      val->tag = ST1VAFE6AX_TIMESTAMP_TAG;
-      break;
-
-    case 0x05:
-      val->tag = ST1VAFE6AX_CFG_CHANGE_TAG;
-      break;
-
-    case 0x06:
-      val->tag = ST1VAFE6AX_XL_NC_T_2_TAG;
-      break;
-
-    case 0x07:
-      val->tag = ST1VAFE6AX_XL_NC_T_1_TAG;
-      break;
-
-    case 0x08:
-      val->tag = ST1VAFE6AX_XL_2XC_TAG;
-      break;
-
-    case 0x09:
-      val->tag = ST1VAFE6AX_XL_3XC_TAG;
-      break;
-
-    case 0x0A:
-      val->tag = ST1VAFE6AX_GY_NC_T_2_TAG;
-      break;
-
-    case 0x0B:
-      val->tag = ST1VAFE6AX_GY_NC_T_1_TAG;
-      break;
-
-    case 0x0C:
-      val->tag = ST1VAFE6AX_GY_2XC_TAG;
-      break;
-
-    case 0x0D:
-      val->tag = ST1VAFE6AX_GY_3XC_TAG;
-      break;
-
-    case 0x12:
-      val->tag = ST1VAFE6AX_STEP_COUNTER_TAG;
-      break;
-
-    case 0x13:
-      val->tag = ST1VAFE6AX_SFLP_GAME_ROTATION_VECTOR_TAG;
-      break;
-
-    case 0x16:
-      val->tag = ST1VAFE6AX_SFLP_GYROSCOPE_BIAS_TAG;
-      break;
-
-    case 0x17:
-      val->tag = ST1VAFE6AX_SFLP_GRAVITY_VECTOR_TAG;
-      break;
-
-    case 0x1A:
-      val->tag = ST1VAFE6AX_MLC_RESULT_TAG;
-      break;
-
-    case 0x1B:
-      val->tag = ST1VAFE6AX_MLC_FILTER;
-      break;
-
-    case 0x1C:
-      val->tag = ST1VAFE6AX_MLC_FEATURE;
-      break;
-
-    case 0x1D:
-      val->tag = ST1VAFE6AX_XL_DUAL_CORE;
-      break;
-
-    case 0x1F:
-      val->tag = ST1VAFE6AX_AH_VAFE;
+      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_4th_SAMPLE;
       break;
 
     default:
-      val->tag = ST1VAFE6AX_FIFO_EMPTY;
+      *val = ST1VAFE6AX_SLEEP_TO_ACT_AT_1ST_SAMPLE;
       break;
   }
-
-  val->cnt = fifo_data_out_tag.tag_cnt;
-
-  val->data[0] = buff[1];
-  val->data[1] = buff[2];
-  val->data[2] = buff[3];
-  val->data[3] = buff[4];
-  val->data[4] = buff[5];
-  val->data[5] = buff[6];
-
   return ret;
 }
 
 /**
-  * @brief  Batching in FIFO buffer of step counter value.[set]
+  * @brief  Selects the accelerometer data rate during Inactivity.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Batching in FIFO buffer of step counter value.
+  * @param  val      1Hz875, 15Hz, 30Hz, 60Hz,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_stpcnt_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_act_sleep_xl_odr_set(const stmdev_ctx_t *ctx,
+                                        st1vafe6ax_act_sleep_xl_odr_t val)
 {
-  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
-  }
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
   if (ret == 0)
   {
-    emb_func_fifo_en_a.step_counter_fifo_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+    inactivity_dur.xl_inact_odr = (uint8_t)val & 0x03U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
   return ret;
 }
 
 /**
-  * @brief  Batching in FIFO buffer of step counter value.[get]
+  * @brief  Selects the accelerometer data rate during Inactivity.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Batching in FIFO buffer of step counter value.
+  * @param  val      1Hz875, 15Hz, 30Hz, 60Hz,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_stpcnt_batch_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_act_sleep_xl_odr_get(const stmdev_ctx_t *ctx,
+                                        st1vafe6ax_act_sleep_xl_odr_t *val)
 {
-  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+    return ret;
   }
 
-  if (ret == 0)
+  switch (inactivity_dur.xl_inact_odr)
   {
-    *val = emb_func_fifo_en_a.step_counter_fifo_en;
-  }
+    case 0x00:
+      *val = ST1VAFE6AX_1Hz875;
+      break;
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+    case 0x01:
+      *val = ST1VAFE6AX_15Hz;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_30Hz;
+      break;
 
+    case 0x03:
+      *val = ST1VAFE6AX_60Hz;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_1Hz875;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Batching in FIFO buffer of machine learning core results.[set]
+  * @brief  Wakeup and activity/inactivity threshold.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Batching in FIFO buffer of machine learning core results.
+  * @param  val      Wakeup and activity/inactivity threshold.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_mlc_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_act_thresholds_set(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_act_thresholds_t val)
 {
-  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  st1vafe6ax_inactivity_ths_t inactivity_ths = {0};
+  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
+  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
   int32_t ret = {0};
+  float_t tmp = 0.0f;
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_THS, (uint8_t *)&inactivity_ths, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+    return ret;
   }
 
-  if (ret == 0)
+  if ((val.wk_ths_mg < 492u) // 7.8125 * 63.0
+      && (val.inact_ths_mg < 492u)) // 7.8125 * 63.0
   {
-    emb_func_fifo_en_a.mlc_fifo_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
-  }
+    inactivity_dur.wu_inact_ths_w = 0;
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+    tmp = (float_t)val.inact_ths_mg / 7.8125f;
+    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
 
-  return ret;
-}
+    tmp = (float_t)val.wk_ths_mg / 7.8125f;
+    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
+  }
+  else if ((val.wk_ths_mg < 984u) // 15.625 * 63.0
+           && (val.inact_ths_mg < 984u)) // 15.625 * 63.0
+  {
+    inactivity_dur.wu_inact_ths_w = 1;
 
-/**
-  * @brief  Batching in FIFO buffer of machine learning core results.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Batching in FIFO buffer of machine learning core results.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_fifo_mlc_batch_get(const stmdev_ctx_t *ctx, uint8_t *val)
-{
-  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
-  int32_t ret = {0};
+    tmp = (float_t)val.inact_ths_mg / 15.625f;
+    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+    tmp = (float_t)val.wk_ths_mg / 15.625f;
+    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
   }
+  else if ((val.wk_ths_mg < 1968u)  // 31.25 * 63.0
+           && (val.inact_ths_mg < 1968u)) // 31.25 * 63.0
+  {
+    inactivity_dur.wu_inact_ths_w = 2;
 
-  if (ret == 0)
+    tmp = (float_t)val.inact_ths_mg / 31.25f;
+    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
+
+    tmp = (float_t)val.wk_ths_mg / 31.25f;
+    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
+  }
+  else if ((val.wk_ths_mg < 3937u) // 62.5 * 63.0
+           && (val.inact_ths_mg < 3937u)) // 62.5 * 63.0
   {
-    *val = emb_func_fifo_en_a.mlc_fifo_en;
+    inactivity_dur.wu_inact_ths_w = 3;
+
+    tmp = (float_t)val.inact_ths_mg / 62.5f;
+    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
+
+    tmp = (float_t)val.wk_ths_mg / 62.5f;
+    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
   }
+  else if ((val.wk_ths_mg < 7875u) // 125.0 * 63.0
+           && (val.inact_ths_mg < 7875u)) // 125.0 * 63.0
+  {
+    inactivity_dur.wu_inact_ths_w = 4;
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+    tmp = (float_t)val.inact_ths_mg / 125.0f;
+    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
 
-  return ret;
-}
+    tmp = (float_t)val.wk_ths_mg / 125.0f;
+    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
+  }
+  else if ((val.wk_ths_mg < 15750u) // 250.0 * 63.0
+           && (val.inact_ths_mg < 15750u)) // 250.0 * 63.0
+  {
+    inactivity_dur.wu_inact_ths_w = 5;
 
-/**
-  * @brief  Enables batching in FIFO buffer of machine learning core filters and features.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Enables batching in FIFO buffer of machine learning core filters and features.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_fifo_mlc_filt_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
-{
-  st1vafe6ax_emb_func_fifo_en_b_t emb_func_fifo_en_b = {0};
-  int32_t ret = {0};
+    tmp = (float_t)val.inact_ths_mg / 250.0f;
+    inactivity_ths.inact_ths = (uint8_t)tmp & 0x3FU;
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+    tmp = (float_t)val.wk_ths_mg / 250.0f;
+    wake_up_ths.wk_ths = (uint8_t)tmp & 0x3FU;
+  }
+  else // out of limit
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_B, (uint8_t *)&emb_func_fifo_en_b, 1);
+    inactivity_dur.wu_inact_ths_w = 5;
+    inactivity_ths.inact_ths = 0x3FU;
+    wake_up_ths.wk_ths = 0x3FU;
   }
 
-  if (ret == 0)
+
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+
+  if (ret != 0)
   {
-    emb_func_fifo_en_b.mlc_filter_feature_fifo_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_B, (uint8_t *)&emb_func_fifo_en_b, 1);
+    return ret;
   }
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_INACTIVITY_THS, (uint8_t *)&inactivity_ths, 1);
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  if (ret != 0)
+  {
+    return ret;
+  }
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
 
   return ret;
 }
 
 /**
-  * @brief  Enables batching in FIFO buffer of machine learning core filters and features.[get]
+  * @brief  Wakeup and activity/inactivity threshold.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables batching in FIFO buffer of machine learning core filters and features.
+  * @param  val      Wakeup and activity/inactivity threshold.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fifo_mlc_filt_batch_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_act_thresholds_get(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_act_thresholds_t *val)
 {
-  st1vafe6ax_emb_func_fifo_en_b_t emb_func_fifo_en_b = {0};
+  st1vafe6ax_inactivity_dur_t inactivity_dur = {0};
+  st1vafe6ax_inactivity_ths_t inactivity_ths = {0};
+  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
   int32_t ret = {0};
+  float_t tmp = 0.0f;
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_DUR, (uint8_t *)&inactivity_dur, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_INACTIVITY_THS, (uint8_t *)&inactivity_ths, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_B, (uint8_t *)&emb_func_fifo_en_b, 1);
+    return ret;
   }
 
-  if (ret == 0)
+  switch (inactivity_dur.wu_inact_ths_w)
   {
-    *val = emb_func_fifo_en_b.mlc_filter_feature_fifo_en;
-  }
+    case 0:
+      tmp = (float_t)wake_up_ths.wk_ths * 7.8125f;
+      val->wk_ths_mg = (uint32_t)tmp;
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+      tmp = (float_t)inactivity_ths.inact_ths * 7.8125f;
+      val->inact_ths_mg = (uint32_t)tmp;
+      break;
 
-  return ret;
-}
+    case 1:
+      tmp = (float_t)wake_up_ths.wk_ths * 15.625f;
+      val->wk_ths_mg = (uint32_t)tmp;
 
-/**
-  * @}
-  *
-  */
+      tmp = (float_t)inactivity_ths.inact_ths * 15.625f;
+      val->inact_ths_mg = (uint32_t)tmp;
+      break;
 
-/**
-  * @defgroup  Step Counter
-  * @brief     This section groups all the functions that manage pedometer.
-  * @{
-  *
-  */
+    case 2:
+      tmp = (float_t)wake_up_ths.wk_ths * 31.25f;
+      val->wk_ths_mg = (uint32_t)tmp;
 
-/**
-  * @brief  Step counter mode[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      false_step_rej, step_counter, step_detector,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_stpcnt_mode_set(const stmdev_ctx_t *ctx,
-                                   st1vafe6ax_stpcnt_mode_t val)
-{
-  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
-  st1vafe6ax_emb_func_en_b_t emb_func_en_b = {0};
-  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
-  int32_t ret = {0};
+      tmp = (float_t)inactivity_ths.inact_ths * 31.25f;
+      val->inact_ths_mg = (uint32_t)tmp;
+      break;
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
-  }
-  if ((val.false_step_rej == PROPERTY_ENABLE)
-      && ((emb_func_en_a.mlc_before_fsm_en & emb_func_en_b.mlc_en) ==
-          PROPERTY_DISABLE))
-  {
-    emb_func_en_a.mlc_before_fsm_en = PROPERTY_ENABLE;
-  }
-  if (ret == 0)
-  {
-    emb_func_en_a.pedo_en = val.step_counter_enable;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
-  }
+    case 3:
+      tmp = (float_t)wake_up_ths.wk_ths * 62.5f;
+      val->wk_ths_mg = (uint32_t)tmp;
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+      tmp = (float_t)inactivity_ths.inact_ths * 62.5f;
+      val->inact_ths_mg = (uint32_t)tmp;
+      break;
 
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
-  }
-  if (ret == 0)
-  {
-    pedo_cmd_reg.fp_rejection_en = val.false_step_rej;
-    ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
+    case 4:
+      tmp = (float_t)wake_up_ths.wk_ths * 125.0f;
+      val->wk_ths_mg = (uint32_t)tmp;
+
+      tmp = (float_t)inactivity_ths.inact_ths * 125.0f;
+      val->inact_ths_mg = (uint32_t)tmp;
+      break;
+
+    default:
+      tmp = (float_t)wake_up_ths.wk_ths * 250.0f;
+      val->wk_ths_mg = (uint32_t)tmp;
+
+      tmp = (float_t)inactivity_ths.inact_ths * 250.0f;
+      val->inact_ths_mg = (uint32_t)tmp;
+      break;
   }
 
   return ret;
 }
 
 /**
-  * @brief  Step counter mode[get]
+  * @brief  Time windows configuration for Wake Up - Activity - Inactivity (SLEEP, WAKE). Duration to go in sleep mode. Default value: 0000 (this corresponds to 16 ODR) 1 LSB = 512/ODR_XL time. Wake up duration event. 1 LSB = 1/ODR_XL time. [set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      false_step_rej, step_counter, step_detector,
+  * @param  val      Time windows configuration for Wake Up - Activity - Inactivity (SLEEP, WAKE). Duration to go in sleep mode. Default value: 0000 (this corresponds to 16 ODR) 1 LSB = 512/ODR_XL time. Wake up duration event. 1 LSB = 1/ODR_XL time.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_stpcnt_mode_get(const stmdev_ctx_t *ctx,
-                                   st1vafe6ax_stpcnt_mode_t *val)
+int32_t st1vafe6ax_act_wkup_time_windows_set(const stmdev_ctx_t *ctx,
+                                             st1vafe6ax_act_wkup_time_windows_t val)
 {
-  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
-  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
+  st1vafe6ax_wake_up_dur_t wake_up_dur = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
-  }
-
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
-  }
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
   if (ret == 0)
   {
-    val->false_step_rej = pedo_cmd_reg.fp_rejection_en;
-    val->step_counter_enable = emb_func_en_a.pedo_en;
+    wake_up_dur.wake_dur = val.shock;
+    wake_up_dur.sleep_dur = val.quiet;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  Step counter output, number of detected steps.[get]
+  * @brief  Time windows configuration for Wake Up - Activity - Inactivity (SLEEP, WAKE). Duration to go in sleep mode. Default value: 0000 (this corresponds to 16 ODR) 1 LSB = 512/ODR_XL time. Wake up duration event. 1 LSB = 1/ODR_XL time. [get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Step counter output, number of detected steps.
+  * @param  val      Time windows configuration for Wake Up - Activity - Inactivity (SLEEP, WAKE). Duration to go in sleep mode. Default value: 0000 (this corresponds to 16 ODR) 1 LSB = 512/ODR_XL time. Wake up duration event. 1 LSB = 1/ODR_XL time.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_stpcnt_steps_get(const stmdev_ctx_t *ctx, uint16_t *val)
+int32_t st1vafe6ax_act_wkup_time_windows_get(const stmdev_ctx_t *ctx,
+                                             st1vafe6ax_act_wkup_time_windows_t *val)
 {
-  uint8_t buff[2] = {0};
+  st1vafe6ax_wake_up_dur_t wake_up_dur = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_STEP_COUNTER_L, &buff[0], 2);
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
-  if (ret == 0)
-  {
-    *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
-  }
+  val->shock = wake_up_dur.wake_dur;
+  val->quiet = wake_up_dur.sleep_dur;
 
   return ret;
 }
 
 /**
-  * @brief  Reset step counter.[set]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  Tap Generator
+  * @brief     This section groups all the functions that manage the
+  *            tap and double tap event generation.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enable axis for Tap - Double Tap detection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Reset step counter.
+  * @param  val      Enable axis for Tap - Double Tap detection.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_stpcnt_rst_step_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_tap_detection_set(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_tap_detection_t val)
 {
-  st1vafe6ax_emb_func_src_t emb_func_src = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_SRC, (uint8_t *)&emb_func_src, 1);
-  }
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
   if (ret == 0)
   {
-    emb_func_src.pedo_rst_step = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_SRC, (uint8_t *)&emb_func_src, 1);
+    tap_cfg0.tap_x_en = val.tap_x_en;
+    tap_cfg0.tap_y_en = val.tap_y_en;
+    tap_cfg0.tap_z_en = val.tap_z_en;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
   return ret;
 }
 
 /**
-  * @brief  Reset step counter.[get]
+  * @brief  Enable axis for Tap - Double Tap detection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Reset step counter.
+  * @param  val      Enable axis for Tap - Double Tap detection.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_stpcnt_rst_step_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_tap_detection_get(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_tap_detection_t *val)
 {
-  st1vafe6ax_emb_func_src_t emb_func_src = {0};
+  st1vafe6ax_tap_cfg0_t tap_cfg0 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_SRC, (uint8_t *)&emb_func_src, 1);
-  }
-
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG0, (uint8_t *)&tap_cfg0, 1);
+  if (ret != 0)
   {
-    *val = emb_func_src.pedo_rst_step;
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  val->tap_x_en = tap_cfg0.tap_x_en;
+  val->tap_y_en = tap_cfg0.tap_y_en;
+  val->tap_z_en = tap_cfg0.tap_z_en;
 
   return ret;
 }
 
 /**
-  * @brief  Pedometer debounce configuration.[set]
+  * @brief  axis Tap - Double Tap recognition thresholds.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Pedometer debounce configuration.
+  * @param  val      axis Tap - Double Tap recognition thresholds.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_stpcnt_debounce_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_tap_thresholds_set(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_tap_thresholds_t val)
 {
-  st1vafe6ax_pedo_deb_steps_conf_t pedo_deb_steps_conf = {0};
+  st1vafe6ax_tap_ths_6d_t tap_ths_6d = {0};
+  st1vafe6ax_tap_cfg2_t tap_cfg2 = {0};
+  st1vafe6ax_tap_cfg1_t tap_cfg1 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_DEB_STEPS_CONF, (uint8_t *)&pedo_deb_steps_conf,
-                              1);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG2, (uint8_t *)&tap_cfg2, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
+  if (ret != 0)
   {
-    pedo_deb_steps_conf.deb_step = val;
-    ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_DEB_STEPS_CONF, (uint8_t *)&pedo_deb_steps_conf,
-                                 1);
+    return ret;
+  }
+
+  tap_cfg1.tap_ths_z = val.z;
+  tap_cfg2.tap_ths_y = val.y;
+  tap_ths_6d.tap_ths_x = val.x;
+
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG2, (uint8_t *)&tap_cfg2, 1);
+  if (ret != 0)
+  {
+    return ret;
   }
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
 
   return ret;
 }
 
 /**
-  * @brief  Pedometer debounce configuration.[get]
+  * @brief  axis Tap - Double Tap recognition thresholds.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Pedometer debounce configuration.
+  * @param  val      axis Tap - Double Tap recognition thresholds.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_stpcnt_debounce_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_tap_thresholds_get(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_tap_thresholds_t *val)
 {
-  st1vafe6ax_pedo_deb_steps_conf_t pedo_deb_steps_conf = {0};
+  st1vafe6ax_tap_ths_6d_t tap_ths_6d = {0};
+  st1vafe6ax_tap_cfg2_t tap_cfg2 = {0};
+  st1vafe6ax_tap_cfg1_t tap_cfg1 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_DEB_STEPS_CONF, (uint8_t *)&pedo_deb_steps_conf,
-                              1);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG2, (uint8_t *)&tap_cfg2, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
+  if (ret != 0)
   {
-    *val = pedo_deb_steps_conf.deb_step;
+    return ret;
   }
 
+  val->z  = tap_cfg1.tap_ths_z;
+  val->y = tap_cfg2.tap_ths_y;
+  val->x = tap_ths_6d.tap_ths_x;
+
   return ret;
 }
 
 /**
-  * @brief  Time period register for step detection on delta time.[set]
+  * @brief  Selection of axis priority for TAP detection.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Time period register for step detection on delta time.
+  * @param  val      XYZ , YXZ , XZY, ZYX , YZX , ZXY ,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_stpcnt_period_set(const stmdev_ctx_t *ctx, uint16_t val)
+int32_t st1vafe6ax_tap_axis_priority_set(const stmdev_ctx_t *ctx,
+                                         st1vafe6ax_tap_axis_priority_t val)
 {
-  uint8_t buff[2] = {0};
+  st1vafe6ax_tap_cfg1_t tap_cfg1 = {0};
   int32_t ret = {0};
 
-  buff[1] = (uint8_t)(val / 256U);
-  buff[0] = (uint8_t)(val - (buff[1] * 256U));
-
-  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_SC_DELTAT_L, (uint8_t *)&buff[0], 2);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
+  if (ret == 0)
+  {
+    tap_cfg1.tap_priority = (uint8_t)val & 0x07U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
+  }
 
   return ret;
 }
 
 /**
-  * @brief  Time period register for step detection on delta time.[get]
+  * @brief  Selection of axis priority for TAP detection.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Time period register for step detection on delta time.
+  * @param  val      XYZ , YXZ , XZY, ZYX , YZX , ZXY ,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_stpcnt_period_get(const stmdev_ctx_t *ctx, uint16_t *val)
+int32_t st1vafe6ax_tap_axis_priority_get(const stmdev_ctx_t *ctx,
+                                         st1vafe6ax_tap_axis_priority_t *val)
 {
-  uint8_t buff[2] = {0};
+  st1vafe6ax_tap_cfg1_t tap_cfg1 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_SC_DELTAT_L, &buff[0], 2);
-
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_CFG1, (uint8_t *)&tap_cfg1, 1);
+  if (ret != 0)
   {
-    *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+    return ret;
   }
 
+  switch (tap_cfg1.tap_priority)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_ZYX ;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_YZX ;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_ZXY ;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_XYZ ;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_ZYX ;
+      break;
+
+    case 0x05:
+      *val = ST1VAFE6AX_YXZ ;
+      break;
+
+    case 0x06:
+      *val = ST1VAFE6AX_XZY;
+      break;
+
+    case 0x07:
+      *val = ST1VAFE6AX_XYZ;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_XYZ ;
+      break;
+  }
   return ret;
 }
 
-/**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup  Significant motion
-  * @brief   This section groups all the functions that manage the
-  *          significant motion detection.
-  * @{
-  *
-  */
 
 /**
-  * @brief  Enables significant motion detection function.[set]
+  * @brief  Time windows configuration for Tap - Double Tap SHOCK, QUIET, DUR : SHOCK Maximum duration is the maximum time of an overthreshold signal detection to be recognized as a tap event. The default value of these bits is 00b which corresponds to 4/ODR_XL time. If the SHOCK bits are set to a different value, 1LSB corresponds to 8/ODR_XL time. QUIET Expected quiet time after a tap detection. Quiet time is the time after the first detected tap in which there must not be any overthreshold event. The default value of these bits is 00b which corresponds to 2/ODR_XL time. If the QUIET bits are set to a different value, 1LSB corresponds to 4/ODR_XL time. DUR Duration of maximum time gap for double tap recognition. When double tap recognition is enabled, this register expresses the maximum time between two consecutive detected taps to determine a double tap event. The default value of these bits is 0000b which corresponds to 16/ODR_XL time. If the DUR_[3:0] bits are set to a different value, 1LSB corresponds to 32/ODR_XL time.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables significant motion detection function.
+  * @param  val      Time windows configuration for Tap - Double Tap SHOCK, QUIET, DUR : SHOCK Maximum duration is the maximum time of an overthreshold signal detection to be recognized as a tap event. The default value of these bits is 00b which corresponds to 4/ODR_XL time. If the SHOCK bits are set to a different value, 1LSB corresponds to 8/ODR_XL time. QUIET Expected quiet time after a tap detection. Quiet time is the time after the first detected tap in which there must not be any overthreshold event. The default value of these bits is 00b which corresponds to 2/ODR_XL time. If the QUIET bits are set to a different value, 1LSB corresponds to 4/ODR_XL time. DUR Duration of maximum time gap for double tap recognition. When double tap recognition is enabled, this register expresses the maximum time between two consecutive detected taps to determine a double tap event. The default value of these bits is 0000b which corresponds to 16/ODR_XL time. If the DUR_[3:0] bits are set to a different value, 1LSB corresponds to 32/ODR_XL time.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_sigmot_mode_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_tap_time_windows_set(const stmdev_ctx_t *ctx,
+                                        st1vafe6ax_tap_time_windows_t val)
 {
-  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  st1vafe6ax_tap_dur_t tap_dur = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
-  }
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_DUR, (uint8_t *)&tap_dur, 1);
   if (ret == 0)
   {
-    emb_func_en_a.sign_motion_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+    tap_dur.shock = val.shock;
+    tap_dur.quiet = val.quiet;
+    tap_dur.dur = val.tap_gap;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_DUR, (uint8_t *)&tap_dur, 1);
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
-
   return ret;
 }
 
 /**
-  * @brief  Enables significant motion detection function.[get]
+  * @brief  Time windows configuration for Tap - Double Tap SHOCK, QUIET, DUR : SHOCK Maximum duration is the maximum time of an overthreshold signal detection to be recognized as a tap event. The default value of these bits is 00b which corresponds to 4/ODR_XL time. If the SHOCK bits are set to a different value, 1LSB corresponds to 8/ODR_XL time. QUIET Expected quiet time after a tap detection. Quiet time is the time after the first detected tap in which there must not be any overthreshold event. The default value of these bits is 00b which corresponds to 2/ODR_XL time. If the QUIET bits are set to a different value, 1LSB corresponds to 4/ODR_XL time. DUR Duration of maximum time gap for double tap recognition. When double tap recognition is enabled, this register expresses the maximum time between two consecutive detected taps to determine a double tap event. The default value of these bits is 0000b which corresponds to 16/ODR_XL time. If the DUR_[3:0] bits are set to a different value, 1LSB corresponds to 32/ODR_XL time.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enables significant motion detection function.
+  * @param  val      Time windows configuration for Tap - Double Tap SHOCK, QUIET, DUR : SHOCK Maximum duration is the maximum time of an overthreshold signal detection to be recognized as a tap event. The default value of these bits is 00b which corresponds to 4/ODR_XL time. If the SHOCK bits are set to a different value, 1LSB corresponds to 8/ODR_XL time. QUIET Expected quiet time after a tap detection. Quiet time is the time after the first detected tap in which there must not be any overthreshold event. The default value of these bits is 00b which corresponds to 2/ODR_XL time. If the QUIET bits are set to a different value, 1LSB corresponds to 4/ODR_XL time. DUR Duration of maximum time gap for double tap recognition. When double tap recognition is enabled, this register expresses the maximum time between two consecutive detected taps to determine a double tap event. The default value of these bits is 0000b which corresponds to 16/ODR_XL time. If the DUR_[3:0] bits are set to a different value, 1LSB corresponds to 32/ODR_XL time.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_sigmot_mode_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_tap_time_windows_get(const stmdev_ctx_t *ctx,
+                                        st1vafe6ax_tap_time_windows_t *val)
 {
-  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  st1vafe6ax_tap_dur_t tap_dur = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
-  }
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_DUR, (uint8_t *)&tap_dur, 1);
+  if (ret != 0)
   {
-    *val = emb_func_en_a.sign_motion_en;
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
+  val->shock = tap_dur.shock;
+  val->quiet = tap_dur.quiet;
+  val->tap_gap = tap_dur.dur;
 
   return ret;
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup  Tilt detection
-  * @brief     This section groups all the functions that manage the tilt
-  *            event detection.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Tilt calculation.[set]
+  * @brief  Single/double-tap event enable.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Tilt calculation.
+  * @param  val      ONLY_SINGLE, BOTH_SINGLE_DOUBLE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tilt_mode_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_tap_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_tap_mode_t val)
 {
-  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
-  }
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
   if (ret == 0)
   {
-    emb_func_en_a.tilt_en = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+    wake_up_ths.single_double_tap = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
   return ret;
 }
 
 /**
-  * @brief  Tilt calculation.[get]
+  * @brief  Single/double-tap event enable.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Tilt calculation.
+  * @param  val      ONLY_SINGLE, BOTH_SINGLE_DOUBLE,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_tilt_mode_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_tap_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_tap_mode_t *val)
 {
-  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  st1vafe6ax_wake_up_ths_t wake_up_ths = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_THS, (uint8_t *)&wake_up_ths, 1);
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+    return ret;
   }
-  if (ret == 0)
+
+  switch (wake_up_ths.single_double_tap)
   {
-    *val = emb_func_en_a.tilt_en;
-  }
+    case 0x00:
+      *val = ST1VAFE6AX_ONLY_SINGLE;
+      break;
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+    case 0x01:
+      *val = ST1VAFE6AX_BOTH_SINGLE_DOUBLE;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_ONLY_SINGLE;
+      break;
+  }
   return ret;
 }
 
@@ -6709,1050 +7690,4594 @@ int32_t st1vafe6ax_tilt_mode_get(const stmdev_ctx_t *ctx, uint8_t *val)
   */
 
 /**
-  * @defgroup  Sensor Fusion Low Power (SFLP)
-  * @brief     This section groups all the functions that manage pedometer.
+  * @defgroup  Six position detection (6D)
+  * @brief   This section groups all the functions concerning six position
+  *          detection (6D).
   * @{
   *
   */
 
 /**
-  * @brief  Enable SFLP Game Rotation Vector (6x).[set]
+  * @brief  Threshold for 4D/6D function.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enable/Disable game rotation value (0/1).
+  * @param  val      DEG_80, DEG_70, DEG_60, DEG_50,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_sflp_game_rotation_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_6d_threshold_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_6d_threshold_t val)
 {
-  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  st1vafe6ax_tap_ths_6d_t tap_ths_6d = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
   if (ret == 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+    tap_ths_6d.sixd_ths = (uint8_t)val & 0x03U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
   }
-  if (ret == 0)
+
+  return ret;
+}
+
+/**
+  * @brief  Threshold for 4D/6D function.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      DEG_80, DEG_70, DEG_60, DEG_50,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_6d_threshold_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_6d_threshold_t *val)
+{
+  st1vafe6ax_tap_ths_6d_t tap_ths_6d = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_TAP_THS_6D, (uint8_t *)&tap_ths_6d, 1);
+  if (ret != 0)
   {
-    emb_func_en_a.sflp_game_en = (uint8_t)(val & 0x01);
-    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A,
-                                (uint8_t *)&emb_func_en_a, 1);
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  switch (tap_ths_6d.sixd_ths)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_DEG_80;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_DEG_70;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_DEG_60;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_DEG_50;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_DEG_80;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Enable SFLP Game Rotation Vector (6x).[get]
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  Free fall
+  * @brief   This section group all the functions concerning the free
+  *          fall detection.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Time windows configuration for Free Fall detection 1 LSB = 1/ODR_XL time[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enable/Disable game rotation value (0/1).
+  * @param  val      Time windows configuration for Free Fall detection 1 LSB = 1/ODR_XL time
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_sflp_game_rotation_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_ff_time_windows_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  st1vafe6ax_wake_up_dur_t wake_up_dur = {0};
+  st1vafe6ax_free_fall_t free_fall = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
   if (ret == 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+    wake_up_dur.ff_dur = ((uint8_t)val & 0x20U) >> 5;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
   }
   if (ret == 0)
   {
-    *val = emb_func_en_a.sflp_game_en;
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  if (ret == 0)
+  {
+    free_fall.ff_dur = (uint8_t)val & 0x1FU;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
+  }
 
   return ret;
 }
 
 /**
-  * @brief  SFLP Data Rate (ODR) configuration.[set]
+  * @brief  Time windows configuration for Free Fall detection 1 LSB = 1/ODR_XL time[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      SFLP_15Hz, SFLP_30Hz, SFLP_60Hz, SFLP_120Hz, SFLP_240Hz, SFLP_480Hz
+  * @param  val      Time windows configuration for Free Fall detection 1 LSB = 1/ODR_XL time
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_sflp_data_rate_set(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_sflp_data_rate_t val)
+int32_t st1vafe6ax_ff_time_windows_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_sflp_odr_t sflp_odr = {0};
+  st1vafe6ax_wake_up_dur_t wake_up_dur = {0};
+  st1vafe6ax_free_fall_t free_fall = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_SFLP_ODR, (uint8_t *)&sflp_odr, 1);
-  }
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_WAKE_UP_DUR, (uint8_t *)&wake_up_dur, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
+  if (ret != 0)
   {
-    sflp_odr.sflp_game_odr = (uint8_t)val & 0x07U;
-    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_SFLP_ODR, (uint8_t *)&sflp_odr,
-                                1);
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  *val = (uint8_t)((wake_up_dur.ff_dur << 5) | free_fall.ff_dur);
 
   return ret;
 }
 
 /**
-  * @brief  SFLP Data Rate (ODR) configuration.[get]
+  * @brief  Free fall threshold setting.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      SFLP_15Hz, SFLP_30Hz, SFLP_60Hz, SFLP_120Hz, SFLP_240Hz, SFLP_480Hz
+  * @param  val      156_mg, 219_mg, 250_mg, 312_mg, 344_mg, 406_mg, 469_mg, 500_mg,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_sflp_data_rate_get(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_sflp_data_rate_t *val)
+int32_t st1vafe6ax_ff_thresholds_set(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_ff_thresholds_t val)
 {
-  st1vafe6ax_sflp_odr_t sflp_odr = {0};
+  st1vafe6ax_free_fall_t free_fall = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
   if (ret == 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_SFLP_ODR, (uint8_t *)&sflp_odr, 1);
+    free_fall.ff_ths = (uint8_t)val & 0x7U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
   }
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
 
+  return ret;
+}
+
+/**
+  * @brief  Free fall threshold setting.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      156_mg, 219_mg, 250_mg, 312_mg, 344_mg, 406_mg, 469_mg, 500_mg,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_ff_thresholds_get(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_ff_thresholds_t *val)
+{
+  st1vafe6ax_free_fall_t free_fall = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FREE_FALL, (uint8_t *)&free_fall, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (sflp_odr.sflp_game_odr)
+  switch (free_fall.ff_ths)
   {
     case 0x00:
-      *val = ST1VAFE6AX_SFLP_15Hz;
+      *val = ST1VAFE6AX_156_mg;
       break;
 
     case 0x01:
-      *val = ST1VAFE6AX_SFLP_30Hz;
+      *val = ST1VAFE6AX_219_mg;
       break;
 
     case 0x02:
-      *val = ST1VAFE6AX_SFLP_60Hz;
+      *val = ST1VAFE6AX_250_mg;
       break;
 
     case 0x03:
-      *val = ST1VAFE6AX_SFLP_120Hz;
+      *val = ST1VAFE6AX_312_mg;
       break;
 
     case 0x04:
-      *val = ST1VAFE6AX_SFLP_240Hz;
+      *val = ST1VAFE6AX_344_mg;
       break;
 
     case 0x05:
-      *val = ST1VAFE6AX_SFLP_480Hz;
+      *val = ST1VAFE6AX_406_mg;
+      break;
+
+    case 0x06:
+      *val = ST1VAFE6AX_469_mg;
+      break;
+
+    case 0x07:
+      *val = ST1VAFE6AX_500_mg;
       break;
 
     default:
-      *val = ST1VAFE6AX_SFLP_15Hz;
+      *val = ST1VAFE6AX_156_mg;
       break;
   }
   return ret;
 }
 
-/*
- * Original conversion routines taken from: https://github.com/numpy/numpy
- *
- * uint16_t npy_floatbits_to_halfbits(uint32_t f);
- * uint16_t npy_float_to_half(float_t f);
- *
- * Released under BSD-3-Clause License
- */
+/**
+  * @}
+  *
+  */
 
-#define NPY_HALF_GENERATE_OVERFLOW  0 /* do not trigger FP overflow */
-#define NPY_HALF_GENERATE_UNDERFLOW 0 /* do not trigger FP underflow */
-#ifndef NPY_HALF_ROUND_TIES_TO_EVEN
-#define NPY_HALF_ROUND_TIES_TO_EVEN 1
-#endif
+/**
+  * @defgroup  FIFO
+  * @brief   This section group all the functions concerning the fifo usage
+  * @{
+  *
+  */
 
-static uint16_t npy_floatbits_to_halfbits(uint32_t f)
+/**
+  * @brief  FIFO watermark threshold (1 LSb = TAG (1 Byte) + 1 sensor (6 Bytes) written in FIFO).[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FIFO watermark threshold (1 LSb = TAG (1 Byte) + 1 sensor (6 Bytes) written in FIFO).
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_watermark_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  uint32_t f_exp = 0, f_sig = 0;
-  uint16_t h_sgn = 0, h_exp = 0, h_sig = 0;
+  st1vafe6ax_fifo_ctrl1_t fifo_ctrl1 = {0};
+  int32_t ret = {0};
 
-  h_sgn = (uint16_t)((f & 0x80000000u) >> 16);
-  f_exp = (f & 0x7f800000u);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
 
-  /* Exponent overflow/NaN converts to signed inf/NaN */
-  if (f_exp >= 0x47800000u)
+  if (ret == 0)
   {
-    if (f_exp == 0x7f800000u)
-    {
-      /* Inf or NaN */
-      f_sig = (f & 0x007fffffu);
-      if (f_sig != 0u)
-      {
-        /* NaN - propagate the flag in the significand... */
-        uint16_t ret = (uint16_t)(0x7c00u + (f_sig >> 13));
-        /* ...but make sure it stays a NaN */
-        if (ret == 0x7c00u)
-        {
-          ret++;
-        }
+    fifo_ctrl1.wtm = val;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO watermark threshold (1 LSb = TAG (1 Byte) + 1 sensor (6 Bytes) written in FIFO).[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FIFO watermark threshold (1 LSb = TAG (1 Byte) + 1 sensor (6 Bytes) written in FIFO).
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_watermark_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_fifo_ctrl1_t fifo_ctrl1 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL1, (uint8_t *)&fifo_ctrl1, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = fifo_ctrl1.wtm;
+
+  return ret;
+}
+
+/**
+  * @brief  When dual channel mode is enabled, this function enables FSM-triggered batching in FIFO of accelerometer channel 2.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      When dual channel mode is enabled, this function enables FSM-triggered batching in FIFO of accelerometer channel 2.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_xl_dual_fsm_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl2.xl_dualc_batch_from_fsm = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  When dual channel mode is enabled, this function enables FSM-triggered batching in FIFO of accelerometer channel 2.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      When dual channel mode is enabled, this function enables FSM-triggered batching in FIFO of accelerometer channel 2.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_xl_dual_fsm_batch_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = fifo_ctrl2.xl_dualc_batch_from_fsm;
+
+  return ret;
+}
+
+/**
+  * @brief  It configures the compression algorithm to write non-compressed data at each rate.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      CMP_DISABLE, CMP_ALWAYS, CMP_8_TO_1, CMP_16_TO_1, CMP_32_TO_1,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_compress_algo_set(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_fifo_compress_algo_t val)
+{
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl2.uncompr_rate = (uint8_t)val & 0x03U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  It configures the compression algorithm to write non-compressed data at each rate.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      CMP_DISABLE, CMP_ALWAYS, CMP_8_TO_1, CMP_16_TO_1, CMP_32_TO_1,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_compress_algo_get(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_fifo_compress_algo_t *val)
+{
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (fifo_ctrl2.uncompr_rate)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_CMP_DISABLE;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_CMP_8_TO_1;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_CMP_16_TO_1;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_CMP_32_TO_1;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_CMP_DISABLE;
+      break;
+  }
+  return ret;
+}
+
+/**
+  * @brief  Enables ODR CHANGE virtual sensor to be batched in FIFO.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables ODR CHANGE virtual sensor to be batched in FIFO.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_virtual_sens_odr_chg_set(const stmdev_ctx_t *ctx,
+                                                 uint8_t val)
+{
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl2.odr_chg_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Enables ODR CHANGE virtual sensor to be batched in FIFO.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables ODR CHANGE virtual sensor to be batched in FIFO.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_virtual_sens_odr_chg_get(const stmdev_ctx_t *ctx,
+                                                 uint8_t *val)
+{
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = fifo_ctrl2.odr_chg_en;
+
+  return ret;
+}
+
+/**
+  * @brief  Enables/Disables compression algorithm runtime.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables/Disables compression algorithm runtime.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_compress_algo_real_time_set(const stmdev_ctx_t *ctx,
+                                                    uint8_t val)
+{
+  st1vafe6ax_emb_func_en_b_t emb_func_en_b = {0};
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl2.fifo_compr_rt_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+
+    if (ret == 0)
+    {
+      ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
+    }
+    if (ret == 0)
+    {
+      emb_func_en_b.fifo_compr_en = val & 0x01U;
+      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
+    }
+
+    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Enables/Disables compression algorithm runtime.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables/Disables compression algorithm runtime.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_compress_algo_real_time_get(const stmdev_ctx_t *ctx,
+                                                    uint8_t *val)
+{
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = fifo_ctrl2.fifo_compr_rt_en;
+
+  return ret;
+}
+
+/**
+  * @brief  Sensing chain FIFO stop values memorization at threshold level.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Sensing chain FIFO stop values memorization at threshold level.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_stop_on_wtm_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl2.stop_on_wtm = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Sensing chain FIFO stop values memorization at threshold level.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Sensing chain FIFO stop values memorization at threshold level.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_stop_on_wtm_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_fifo_ctrl2_t fifo_ctrl2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL2, (uint8_t *)&fifo_ctrl2, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = fifo_ctrl2.stop_on_wtm;
+
+  return ret;
+}
+
+/**
+  * @brief  Selects Batch Data Rate (write frequency in FIFO) for accelerometer data.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      st1vafe6ax_fifo_xl_batch_t enum
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_xl_batch_set(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_fifo_xl_batch_t val)
+{
+  st1vafe6ax_fifo_ctrl3_t fifo_ctrl3 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl3.bdr_xl = (uint8_t)val & 0xFU;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Selects Batch Data Rate (write frequency in FIFO) for accelerometer data.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      st1vafe6ax_fifo_xl_batch_t enum
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_xl_batch_get(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_fifo_xl_batch_t *val)
+{
+  st1vafe6ax_fifo_ctrl3_t fifo_ctrl3 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (fifo_ctrl3.bdr_xl)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_XL_NOT_BATCHED;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_1Hz875;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_7Hz5;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_15Hz;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_30Hz;
+      break;
+
+    case 0x05:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_60Hz;
+      break;
+
+    case 0x06:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_120Hz;
+      break;
+
+    case 0x07:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_240Hz;
+      break;
+
+    case 0x08:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_480Hz;
+      break;
+
+    case 0x09:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_960Hz;
+      break;
+
+    case 0x0A:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_1920Hz;
+      break;
+
+    case 0x0B:
+      *val = ST1VAFE6AX_XL_BATCHED_AT_3840Hz;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_XL_NOT_BATCHED;
+      break;
+  }
+  return ret;
+}
+
+/**
+  * @brief  Selects Batch Data Rate (write frequency in FIFO) for gyroscope data.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      st1vafe6ax_fifo_gy_batch_t enum
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_gy_batch_set(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_fifo_gy_batch_t val)
+{
+  st1vafe6ax_fifo_ctrl3_t fifo_ctrl3 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl3.bdr_gy = (uint8_t)val & 0xFU;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Selects Batch Data Rate (write frequency in FIFO) for gyroscope data.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      st1vafe6ax_fifo_gy_batch_t enum
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_gy_batch_get(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_fifo_gy_batch_t *val)
+{
+  st1vafe6ax_fifo_ctrl3_t fifo_ctrl3 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL3, (uint8_t *)&fifo_ctrl3, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (fifo_ctrl3.bdr_gy)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_GY_NOT_BATCHED;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_1Hz875;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_7Hz5;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_15Hz;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_30Hz;
+      break;
+
+    case 0x05:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_60Hz;
+      break;
+
+    case 0x06:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_120Hz;
+      break;
+
+    case 0x07:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_240Hz;
+      break;
+
+    case 0x08:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_480Hz;
+      break;
+
+    case 0x09:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_960Hz;
+      break;
+
+    case 0x0A:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_1920Hz;
+      break;
+
+    case 0x0B:
+      *val = ST1VAFE6AX_GY_BATCHED_AT_3840Hz;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_GY_NOT_BATCHED;
+      break;
+  }
+  return ret;
+}
+
+/**
+  * @brief  FIFO mode selection.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      BYPASS_MODE, FIFO_MODE, STREAM_WTM_TO_FULL_MODE, STREAM_TO_FIFO_MODE, BYPASS_TO_STREAM_MODE, STREAM_MODE, BYPASS_TO_FIFO_MODE,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_mode_set(const stmdev_ctx_t *ctx,
+                                 st1vafe6ax_fifo_mode_t val)
+{
+  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl4.fifo_mode = (uint8_t)val & 0x07U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO mode selection.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      BYPASS_MODE, FIFO_MODE, STREAM_WTM_TO_FULL_MODE, STREAM_TO_FIFO_MODE, BYPASS_TO_STREAM_MODE, STREAM_MODE, BYPASS_TO_FIFO_MODE,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_mode_get(const stmdev_ctx_t *ctx,
+                                 st1vafe6ax_fifo_mode_t *val)
+{
+  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (fifo_ctrl4.fifo_mode)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_BYPASS_MODE;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_FIFO_MODE;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_STREAM_WTM_TO_FULL_MODE;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_STREAM_TO_FIFO_MODE;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_BYPASS_TO_STREAM_MODE;
+      break;
+
+    case 0x06:
+      *val = ST1VAFE6AX_STREAM_MODE;
+      break;
+
+    case 0x07:
+      *val = ST1VAFE6AX_BYPASS_TO_FIFO_MODE;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_BYPASS_MODE;
+      break;
+  }
+  return ret;
+}
+
+/**
+  * @brief  Selects batch data rate (write frequency in FIFO) for temperature data.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      TEMP_NOT_BATCHED, TEMP_BATCHED_AT_1Hz875, TEMP_BATCHED_AT_15Hz, TEMP_BATCHED_AT_60Hz,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_temp_batch_set(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_fifo_temp_batch_t val)
+{
+  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl4.odr_t_batch = (uint8_t)val & 0x03U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Selects batch data rate (write frequency in FIFO) for temperature data.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      TEMP_NOT_BATCHED, TEMP_BATCHED_AT_1Hz875, TEMP_BATCHED_AT_15Hz, TEMP_BATCHED_AT_60Hz,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_temp_batch_get(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_fifo_temp_batch_t *val)
+{
+  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (fifo_ctrl4.odr_t_batch)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_TEMP_NOT_BATCHED;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_TEMP_BATCHED_AT_1Hz875;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_TEMP_BATCHED_AT_15Hz;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_TEMP_BATCHED_AT_60Hz;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_TEMP_NOT_BATCHED;
+      break;
+  }
+  return ret;
+}
+
+/**
+  * @brief  Selects decimation for timestamp batching in FIFO. Write rate will be the maximum rate between XL and GYRO BDR divided by decimation decoder.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      TMSTMP_NOT_BATCHED, TMSTMP_DEC_1, TMSTMP_DEC_8, TMSTMP_DEC_32,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_timestamp_batch_set(const stmdev_ctx_t *ctx,
+                                            st1vafe6ax_fifo_timestamp_batch_t val)
+{
+  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+  if (ret == 0)
+  {
+    fifo_ctrl4.dec_ts_batch = (uint8_t)val & 0x3U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Selects decimation for timestamp batching in FIFO. Write rate will be the maximum rate between XL and GYRO BDR divided by decimation decoder.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      TMSTMP_NOT_BATCHED, TMSTMP_DEC_1, TMSTMP_DEC_8, TMSTMP_DEC_32,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_timestamp_batch_get(const stmdev_ctx_t *ctx,
+                                            st1vafe6ax_fifo_timestamp_batch_t *val)
+{
+  st1vafe6ax_fifo_ctrl4_t fifo_ctrl4 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_CTRL4, (uint8_t *)&fifo_ctrl4, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (fifo_ctrl4.dec_ts_batch)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_TMSTMP_NOT_BATCHED;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_TMSTMP_DEC_1;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_TMSTMP_DEC_8;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_TMSTMP_DEC_32;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_TMSTMP_NOT_BATCHED;
+      break;
+  }
+  return ret;
+}
+
+/**
+  * @brief  The threshold for the internal counter of batch events. When this counter reaches the threshold, the counter is reset and the interrupt flag is set to 1.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      The threshold for the internal counter of batch events. When this counter reaches the threshold, the counter is reset and the interrupt flag is set to 1.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_batch_counter_threshold_set(const stmdev_ctx_t *ctx,
+                                                    uint16_t val)
+{
+  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
+  st1vafe6ax_counter_bdr_reg2_t counter_bdr_reg2 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+
+  if (ret == 0)
+  {
+    counter_bdr_reg2.cnt_bdr_th = (uint8_t)val & 0xFFU;
+    counter_bdr_reg1.cnt_bdr_th = (uint8_t)(val >> 8) & 0x3U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG2, (uint8_t *)&counter_bdr_reg2, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  The threshold for the internal counter of batch events. When this counter reaches the threshold, the counter is reset and the interrupt flag is set to 1.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      The threshold for the internal counter of batch events. When this counter reaches the threshold, the counter is reset and the interrupt flag is set to 1.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_batch_counter_threshold_get(const stmdev_ctx_t *ctx,
+                                                    uint16_t *val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, &buff[0], 2);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = (uint16_t)(buff[1] | ((uint16_t)(buff[0] & 0x03U) << 8));
+
+  return ret;
+}
+
+/**
+  * @brief  Enables AH_BIO batching in FIFO.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables AH_BIO batching in FIFO.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_batch_ah_bio_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  if (ret == 0)
+  {
+    counter_bdr_reg1.ah_bio_batch_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Enables AH_BIO batching in FIFO.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables AH_BIO batching in FIFO.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_batch_ah_bio_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = counter_bdr_reg1.ah_bio_batch_en;
+
+  return ret;
+}
+
+/**
+  * @brief  Selects the trigger for the internal counter of batch events between the accelerometer, gyroscope.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      XL_BATCH_EVENT, GY_BATCH_EVENT
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_batch_cnt_event_set(const stmdev_ctx_t *ctx,
+                                            st1vafe6ax_fifo_batch_cnt_event_t val)
+{
+  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+
+  if (ret == 0)
+  {
+    counter_bdr_reg1.trig_counter_bdr = (uint8_t)val & 0x03U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Selects the trigger for the internal counter of batch events between the accelerometer, gyroscope.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      XL_BATCH_EVENT, GY_BATCH_EVENT
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_batch_cnt_event_get(const stmdev_ctx_t *ctx,
+                                            st1vafe6ax_fifo_batch_cnt_event_t *val)
+{
+  st1vafe6ax_counter_bdr_reg1_t counter_bdr_reg1 = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_COUNTER_BDR_REG1, (uint8_t *)&counter_bdr_reg1, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (counter_bdr_reg1.trig_counter_bdr)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_XL_BATCH_EVENT;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_GY_BATCH_EVENT;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_XL_BATCH_EVENT;
+      break;
+  }
+  return ret;
+}
+
+/**
+  * @brief  Batching in FIFO buffer of SFLP.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Batching in FIFO buffer of SFLP values.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_sflp_batch_set(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_fifo_sflp_raw_t val)
+{
+  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_fifo_en_a.sflp_game_fifo_en = val.game_rotation;
+    emb_func_fifo_en_a.sflp_gravity_fifo_en = val.gravity;
+    emb_func_fifo_en_a.sflp_gbias_fifo_en = val.gbias;
+    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A,
+                                (uint8_t *)&emb_func_fifo_en_a, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Batching in FIFO buffer of SFLP.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Batching in FIFO buffer of SFLP values.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_sflp_batch_get(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_fifo_sflp_raw_t *val)
+{
+  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    val->game_rotation = emb_func_fifo_en_a.sflp_game_fifo_en;
+    val->gravity = emb_func_fifo_en_a.sflp_gravity_fifo_en;
+    val->gbias = emb_func_fifo_en_a.sflp_gbias_fifo_en;
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/* FIFO_STATUS1, FIFO_STATUS2 */
+static void fifo_status_decode(const uint8_t *buff, st1vafe6ax_fifo_status_t *val)
+{
+  st1vafe6ax_fifo_status2_t status = {0};
+
+  bytecpy((uint8_t *)&status, &buff[1]);
+
+  val->fifo_bdr = status.counter_bdr_ia;
+  val->fifo_ovr = status.fifo_ovr_ia;
+  val->fifo_full = status.fifo_full_ia;
+  val->fifo_th = status.fifo_wtm_ia;
+
+  val->fifo_level = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8)) & 0x1FFU;
+}
+
+/**
+  * @brief  Status of FIFO.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Status of FIFO (level and flags).
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_status_get(const stmdev_ctx_t *ctx,
+                                   st1vafe6ax_fifo_status_t *val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_STATUS1, (uint8_t *)&buff[0], 2);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  fifo_status_decode(buff, val);
+
+  return ret;
+}
+
+/* FIFO tag_sensor field to st1vafe6ax_fifo_out_raw_t tag, unknown -> EMPTY */
+static const uint8_t fifo_tag_lut[32] =
+{
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_GY_NC_TAG,
+  ST1VAFE6AX_XL_NC_TAG,
+  ST1VAFE6AX_TEMPERATURE_TAG,
+  ST1VAFE6AX_TIMESTAMP_TAG,
+  ST1VAFE6AX_CFG_CHANGE_TAG,
+  ST1VAFE6AX_XL_NC_T_2_TAG,
+  ST1VAFE6AX_XL_NC_T_1_TAG,
+  ST1VAFE6AX_XL_2XC_TAG,
+  ST1VAFE6AX_XL_3XC_TAG,
+  ST1VAFE6AX_GY_NC_T_2_TAG,
+  ST1VAFE6AX_GY_NC_T_1_TAG,
+  ST1VAFE6AX_GY_2XC_TAG,
+  ST1VAFE6AX_GY_3XC_TAG,
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_STEP_COUNTER_TAG,
+  ST1VAFE6AX_SFLP_GAME_ROTATION_VECTOR_TAG,
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_SFLP_GYROSCOPE_BIAS_TAG,
+  ST1VAFE6AX_SFLP_GRAVITY_VECTOR_TAG,
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_MLC_RESULT_TAG,
+  ST1VAFE6AX_MLC_FILTER,
+  ST1VAFE6AX_MLC_FEATURE,
+  ST1VAFE6AX_XL_DUAL_CORE,
+  ST1VAFE6AX_FIFO_EMPTY,
+  ST1VAFE6AX_AH_VAFE,
+};
+
+/* Decode one 7-byte FIFO word (tag + data) read from FIFO_DATA_OUT_TAG */
+static void fifo_word_decode(const uint8_t *buff, st1vafe6ax_fifo_out_raw_t *val)
+{
+  st1vafe6ax_fifo_data_out_tag_t fifo_data_out_tag = {0};
+
+  bytecpy((uint8_t *)&fifo_data_out_tag, &buff[0]);
+
+  val->tag = fifo_tag_lut[fifo_data_out_tag.tag_sensor];
+  val->cnt = fifo_data_out_tag.tag_cnt;
+
+  val->data[0] = buff[1];
+  val->data[1] = buff[2];
+  val->data[2] = buff[3];
+  val->data[3] = buff[4];
+  val->data[4] = buff[5];
+  val->data[5] = buff[6];
+}
+
+/**
+  * @brief  Decode FIFO words previously read from FIFO_DATA_OUT_TAG (e.g.
+  *         by DMA) without any bus access.
+  *
+  * @param  buff     raw FIFO words, 7 bytes each (tag + 6 data bytes). It may
+  *                  be the same memory as val (in-place decoding).
+  * @param  num      number of words in buff
+  * @param  val      array of num st1vafe6ax_fifo_out_raw_t
+  *
+  */
+void st1vafe6ax_fifo_out_raw_decode(const uint8_t *buff, uint16_t num,
+                                    st1vafe6ax_fifo_out_raw_t *val)
+{
+  uint8_t word[7];
+  uint16_t i;
+
+  /*
+   * Raw word i lies at buff[7 * i], never after element i of val: decoding
+   * from the last word to the first never overwrites a word not yet decoded.
+   */
+  for (i = num; i > 0U; i--)
+  {
+    (void)memcpy(word, &buff[(i - 1U) * 7U], sizeof(word));
+    fifo_word_decode(word, &val[i - 1U]);
+  }
+}
+
+/**
+  * @brief  FIFO data output[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      st1vafe6ax_fifo_out_raw_t enum
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_out_raw_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_fifo_out_raw_t *val)
+{
+  uint8_t buff[7] = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_DATA_OUT_TAG, buff, 7);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  fifo_word_decode(buff, val);
+
+  return ret;
+}
+
+/**
+  * @brief  FIFO data output, multiple words in a single transaction.[get]
+  *         The number of words is taken from FIFO_STATUS1/2 and all of them
+  *         are read with one burst starting from FIFO_DATA_OUT_TAG: the
+  *         device wraps the register address from FIFO_DATA_OUT_BYTE_5 back
+  *         to FIFO_DATA_OUT_TAG (CTRL3.IF_INC must be set, default).
+  *
+  * @param  ctx        read / write interface definitions
+  * @param  val        array of st1vafe6ax_fifo_out_raw_t, also used as
+  *                    raw buffer for the bus transfer
+  * @param  max_words  number of elements of val
+  * @param  n_read     number of words read from FIFO
+  * @retval            interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_out_raw_burst_get(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_fifo_out_raw_t *val,
+                                          uint16_t max_words, uint16_t *n_read)
+{
+  st1vafe6ax_fifo_status_t fifo_status = {0};
+  uint8_t *buff = (uint8_t *)val;
+  uint16_t num;
+  int32_t ret;
+
+  *n_read = 0;
+
+  ret = st1vafe6ax_fifo_status_get(ctx, &fifo_status);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  num = (fifo_status.fifo_level < max_words) ? fifo_status.fifo_level : max_words;
+  if (num == 0U)
+  {
+    return ret;
+  }
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FIFO_DATA_OUT_TAG, buff, (uint16_t)(num * 7U));
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  st1vafe6ax_fifo_out_raw_decode(buff, num, val);
+
+  *n_read = num;
+
+  return ret;
+}
+
+/* Sign extension of a 'bits' wide two's complement field */
+static int16_t fifo_dcmp_sext(uint16_t val, uint8_t bits)
+{
+  uint16_t sign = (uint16_t)(1U << (bits - 1U));
+  int32_t res = (int32_t)val;
+
+  if ((val & sign) != 0U)
+  {
+    res -= (int32_t)sign << 1;
+  }
+
+  return (int16_t)res;
+}
+
+static void fifo_dcmp_emit(st1vafe6ax_fifo_dcmp_stream_t *stream,
+                           st1vafe6ax_fifo_dcmp_sensor_t sensor, uint32_t slot,
+                           const int16_t *data, st1vafe6ax_fifo_dcmp_sample_t *out)
+{
+  uint8_t i;
+
+  for (i = 0U; i < 3U; i++)
+  {
+    stream->data[i] = data[i];
+    out->data[i] = data[i];
+  }
+  stream->valid = 1U;
+  out->sensor = sensor;
+  out->slot = slot;
+}
+
+/**
+  * @brief  Reset FIFO decompressor state. To be called before the first
+  *         word, after FIFO overrun and whenever the FIFO is flushed.
+  *
+  * @param  dcmp     decompressor state
+  *
+  */
+void st1vafe6ax_fifo_dcmp_reset(st1vafe6ax_fifo_dcmp_t *dcmp)
+{
+  (void)memset(dcmp, 0x00, sizeof(st1vafe6ax_fifo_dcmp_t));
+}
+
+/**
+  * @brief  Rebuild the accelerometer / gyroscope samples carried by one
+  *         FIFO word, also when FIFO compression is enabled
+  *         (st1vafe6ax_fifo_compress_algo_set()).
+  *         Samples are returned in time order and tagged with their time
+  *         slot: slots advance with the FIFO tag counter (one slot per
+  *         batch data rate period of the fastest batched sensor) and are
+  *         counted modulo 2^32 from the last reset.
+  *         The reference samples of both streams are dropped on
+  *         CFG_CHANGE_TAG words; compressed words received without a
+  *         reference sample (e.g. after an overrun) are discarded.
+  *         Samples are in the FIFO order (x, y, z).
+  *
+  * @param  dcmp     decompressor state
+  * @param  val      FIFO word (st1vafe6ax_fifo_out_raw_get(),
+  *                  st1vafe6ax_fifo_out_raw_decode())
+  * @param  out      array of (at least) 3 samples
+  * @retval          number of samples written in out (0 to 3)
+  *
+  */
+uint8_t st1vafe6ax_fifo_dcmp_process(st1vafe6ax_fifo_dcmp_t *dcmp,
+                                     const st1vafe6ax_fifo_out_raw_t *val,
+                                     st1vafe6ax_fifo_dcmp_sample_t *out)
+{
+  st1vafe6ax_fifo_dcmp_stream_t *stream;
+  st1vafe6ax_fifo_dcmp_sensor_t sensor;
+  int16_t diff[9];
+  int16_t sample[3];
+  uint16_t word;
+  uint8_t num;
+  uint8_t i;
+  uint8_t j;
+
+  if (val->tag == ST1VAFE6AX_FIFO_EMPTY)
+  {
+    return 0U;
+  }
+
+  /* the tag counter changes once per time slot */
+  if (dcmp->cnt_valid != 0U)
+  {
+    dcmp->slot += (uint32_t)(((uint8_t)(val->cnt - dcmp->cnt)) & 0x03U);
+  }
+  dcmp->cnt = val->cnt;
+  dcmp->cnt_valid = 1U;
+
+  switch (val->tag)
+  {
+    case ST1VAFE6AX_XL_NC_TAG:
+    case ST1VAFE6AX_XL_NC_T_1_TAG:
+    case ST1VAFE6AX_XL_NC_T_2_TAG:
+    case ST1VAFE6AX_XL_2XC_TAG:
+    case ST1VAFE6AX_XL_3XC_TAG:
+      stream = &dcmp->xl;
+      sensor = ST1VAFE6AX_FIFO_DCMP_XL;
+      break;
+
+    case ST1VAFE6AX_GY_NC_TAG:
+    case ST1VAFE6AX_GY_NC_T_1_TAG:
+    case ST1VAFE6AX_GY_NC_T_2_TAG:
+    case ST1VAFE6AX_GY_2XC_TAG:
+    case ST1VAFE6AX_GY_3XC_TAG:
+      stream = &dcmp->gy;
+      sensor = ST1VAFE6AX_FIFO_DCMP_GY;
+      break;
+
+    case ST1VAFE6AX_CFG_CHANGE_TAG:
+      dcmp->xl.valid = 0U;
+      dcmp->gy.valid = 0U;
+      return 0U;
+
+    default:
+      return 0U;
+  }
+
+  switch (val->tag)
+  {
+    case ST1VAFE6AX_XL_2XC_TAG:
+    case ST1VAFE6AX_GY_2XC_TAG:
+      /* low compression: 8-bit differences of T-2 and T-1 samples */
+      for (i = 0U; i < 6U; i++)
+      {
+        diff[i] = fifo_dcmp_sext(val->data[i], 8U);
+      }
+      num = 2U;
+      break;
+
+    case ST1VAFE6AX_XL_3XC_TAG:
+    case ST1VAFE6AX_GY_3XC_TAG:
+      /* high compression: 5-bit differences of T-2, T-1 and T samples */
+      for (i = 0U; i < 3U; i++)
+      {
+        word = (uint16_t)val->data[2U * i] | ((uint16_t)val->data[(2U * i) + 1U] << 8);
+        for (j = 0U; j < 3U; j++)
+        {
+          diff[(3U * i) + j] = fifo_dcmp_sext((word >> (5U * j)) & 0x1FU, 5U);
+        }
+      }
+      num = 3U;
+      break;
+
+    default:
+      /* uncompressed sample at T, T-1 or T-2 */
+      for (i = 0U; i < 3U; i++)
+      {
+        sample[i] = (int16_t)((uint16_t)val->data[2U * i] |
+                              ((uint16_t)val->data[(2U * i) + 1U] << 8));
+      }
+      j = ((val->tag == ST1VAFE6AX_XL_NC_T_2_TAG) ||
+           (val->tag == ST1VAFE6AX_GY_NC_T_2_TAG)) ? 2U : 0U;
+      j = ((val->tag == ST1VAFE6AX_XL_NC_T_1_TAG) ||
+           (val->tag == ST1VAFE6AX_GY_NC_T_1_TAG)) ? 1U : j;
+      fifo_dcmp_emit(stream, sensor, dcmp->slot - j, sample, &out[0]);
+      return 1U;
+  }
+
+  if (stream->valid == 0U)
+  {
+    /* no reference sample */
+    return 0U;
+  }
+
+  /* each compressed sample is relative to the previous one */
+  for (i = 0U; i < num; i++)
+  {
+    for (j = 0U; j < 3U; j++)
+    {
+      sample[j] = (int16_t)(stream->data[j] + diff[(3U * i) + j]);
+    }
+    fifo_dcmp_emit(stream, sensor, dcmp->slot - 2U + i, sample, &out[i]);
+  }
+
+  return num;
+}
+
+/**
+  * @brief  Initialize the FIFO timestamp engine.
+  *         The engine extends the 32-bit timestamp carried by
+  *         TIMESTAMP_TAG words to 64 bits and gives the time of every FIFO
+  *         time slot (see st1vafe6ax_fifo_dcmp_process()), interpolating
+  *         between timestamp words. To be initialized again whenever the
+  *         timestamp counter is reset.
+  *
+  * @param  fts        timestamp engine state
+  * @param  bdr        batch data rate of the fastest sensor batched in FIFO
+  *                    (st1vafe6ax_fifo_gy_batch_t values are the same),
+  *                    used until two timestamp words have been received.
+  * @param  freq_fine  ODR calibration (st1vafe6ax_odr_cal_reg_get())
+  *
+  */
+void st1vafe6ax_fifo_ts_init(st1vafe6ax_fifo_ts_t *fts, st1vafe6ax_fifo_xl_batch_t bdr,
+                             int8_t freq_fine)
+{
+  /* slot period in timestamp LSB (21.75 us) units, 16 fractional bits */
+  static const uint32_t period_nom[12] =
+  {
+    0U,
+    1607013027U,       /* 1.875 Hz */
+    401753257U,        /* 7.5 Hz */
+    401753257U >> 1,
+    401753257U >> 2,
+    401753257U >> 3,
+    401753257U >> 4,
+    401753257U >> 5,
+    401753257U >> 6,
+    401753257U >> 7,
+    401753257U >> 8,
+    401753257U >> 9,   /* 3840 Hz */
+  };
+
+  (void)memset(fts, 0x00, sizeof(st1vafe6ax_fifo_ts_t));
+  fts->period_nom = ((uint8_t)bdr < 12U) ? period_nom[(uint8_t)bdr] : 0U;
+  fts->period = fts->period_nom;
+  fts->freq_fine = freq_fine;
+}
+
+/**
+  * @brief  Feed a timestamp word to the FIFO timestamp engine.
+  *
+  * @param  fts      timestamp engine state
+  * @param  slot     time slot of the word (st1vafe6ax_fifo_dcmp_t.slot
+  *                  after processing the word)
+  * @param  val      FIFO word, ignored if not ST1VAFE6AX_TIMESTAMP_TAG
+  *
+  */
+void st1vafe6ax_fifo_ts_anchor(st1vafe6ax_fifo_ts_t *fts, uint32_t slot,
+                               const st1vafe6ax_fifo_out_raw_t *val)
+{
+  uint64_t period;
+  uint32_t raw;
+  uint32_t delta;
+
+  if (val->tag != ST1VAFE6AX_TIMESTAMP_TAG)
+  {
+    return;
+  }
+
+  raw = (uint32_t)val->data[0] | ((uint32_t)val->data[1] << 8) |
+        ((uint32_t)val->data[2] << 16) | ((uint32_t)val->data[3] << 24);
+
+  /* 32-bit counter rollover (about 26 hours) */
+  if ((fts->anchors != 0U) && (raw < fts->raw))
+  {
+    fts->ts_hi += 0x100000000ULL;
+  }
+  fts->raw = raw;
+
+  fts->ts_prev = fts->ts_last;
+  fts->slot_prev = fts->slot_last;
+  fts->ts_last = fts->ts_hi + raw;
+  fts->slot_last = slot;
+  fts->anchors = (fts->anchors < 2U) ? (fts->anchors + 1U) : 2U;
+
+  delta = fts->slot_last - fts->slot_prev;
+  if ((fts->anchors < 2U) || (delta == 0U))
+  {
+    return;
+  }
+
+  /*
+   * Measured slot period. ODR and timestamp share the same oscillator, so
+   * in LSB units it only differs from nominal after an ODR change: values
+   * off by more than 1/8 are rejected.
+   */
+  period = ((fts->ts_last - fts->ts_prev) << 16) / delta;
+  if ((fts->period_nom == 0U) ||
+      ((period > (fts->period_nom - (fts->period_nom >> 3))) &&
+       (period < (fts->period_nom + (fts->period_nom >> 3)))))
+  {
+    fts->period = (uint32_t)period;
+  }
+  else
+  {
+    fts->period = fts->period_nom;
+  }
+}
+
+/**
+  * @brief  Time of a FIFO time slot, in timestamp LSB.
+  *         Slots between the last two timestamp words are linearly
+  *         interpolated, the other ones are extrapolated from the last
+  *         timestamp word with the measured slot period.
+  *
+  * @param  fts      timestamp engine state
+  * @param  slot     time slot
+  * @retval          64-bit timestamp [LSB]
+  *
+  */
+uint64_t st1vafe6ax_fifo_ts_slot_to_lsb(const st1vafe6ax_fifo_ts_t *fts, uint32_t slot)
+{
+  uint64_t delta;
+  uint32_t span = fts->slot_last - fts->slot_prev;
+  uint32_t pos = slot - fts->slot_prev;
+  uint32_t dist;
+
+  if ((fts->anchors == 2U) && (span != 0U) && (pos <= span))
+  {
+    delta = fts->ts_last - fts->ts_prev;
+    return fts->ts_prev + (((delta * pos) + (span / 2U)) / span);
+  }
+
+  dist = slot - fts->slot_last;
+  if (dist < 0x80000000U)
+  {
+    return fts->ts_last + ((((uint64_t)dist * fts->period) + 0x8000U) >> 16);
+  }
+
+  /* slot before the last timestamp word */
+  dist = fts->slot_last - slot;
+  delta = (((uint64_t)dist * fts->period) + 0x8000U) >> 16;
+
+  return (delta < fts->ts_last) ? (fts->ts_last - delta) : 0U;
+}
+
+/**
+  * @brief  Convert timestamp LSB in nanoseconds, taking into account the
+  *         internal oscillator calibration (freq_fine, 0.13% per LSB).
+  *
+  * @param  fts      timestamp engine state
+  * @param  lsb      64-bit timestamp [LSB]
+  * @retval          time [ns]
+  *
+  */
+uint64_t st1vafe6ax_fifo_ts_lsb_to_nsec(const st1vafe6ax_fifo_ts_t *fts, uint64_t lsb)
+{
+  return st1vafe6ax_from_lsb_to_nsec_cal(lsb, fts->freq_fine);
+}
+
+/**
+  * @brief  Time of FIFO time slots in nanoseconds.
+  *
+  * @param  fts      timestamp engine state
+  * @param  slot     time slots
+  * @param  nsec     time of each slot [ns]
+  * @param  num      number of slots
+  *
+  */
+void st1vafe6ax_fifo_ts_slots_to_nsec(const st1vafe6ax_fifo_ts_t *fts,
+                                      const uint32_t *slot, uint64_t *nsec,
+                                      uint16_t num)
+{
+  uint16_t i;
+
+  for (i = 0U; i < num; i++)
+  {
+    nsec[i] = st1vafe6ax_fifo_ts_lsb_to_nsec(fts, st1vafe6ax_fifo_ts_slot_to_lsb(fts, slot[i]));
+  }
+}
+
+/* Convert the pending time slots of a timestamp column into nanoseconds */
+static void fifo_demux_ts_flush(const st1vafe6ax_fifo_ts_t *fts, uint64_t *ts,
+                                uint16_t *pend, uint16_t len)
+{
+  uint16_t i;
+
+  if (ts != NULL)
+  {
+    for (i = *pend; i < len; i++)
+    {
+      ts[i] = st1vafe6ax_fifo_ts_lsb_to_nsec(fts,
+                                             st1vafe6ax_fifo_ts_slot_to_lsb(fts, (uint32_t)ts[i]));
+    }
+  }
+  *pend = len;
+}
+
+static void fifo_demux_chan_put(st1vafe6ax_fifo_chan_buf_t *buf, uint32_t slot,
+                                const uint8_t *data)
+{
+  if (buf->data == NULL)
+  {
+    return;
+  }
+
+  buf->data[buf->len] = (int16_t)((uint16_t)data[0] | ((uint16_t)data[1] << 8));
+  if (buf->ts != NULL)
+  {
+    buf->ts[buf->len] = slot;
+  }
+  buf->len++;
+}
+
+/**
+  * @brief  Initialize a FIFO demultiplexer. Buffer pointers and capacities
+  *         must be set by the caller: NULL data buffers discard the
+  *         corresponding samples, NULL ts columns are not filled.
+  *
+  * @param  dmx      demultiplexer
+  * @param  dcmp     decompressor state (mandatory, reset by this call)
+  * @param  fts      timestamp engine, initialized by the caller (optional);
+  *                  when NULL, the ts columns receive the raw FIFO time slot
+  *                  of each sample (decompressor slot counter), not ns
+  *
+  */
+void st1vafe6ax_fifo_demux_init(st1vafe6ax_fifo_demux_t *dmx,
+                                st1vafe6ax_fifo_dcmp_t *dcmp,
+                                st1vafe6ax_fifo_ts_t *fts)
+{
+  st1vafe6ax_fifo_dcmp_reset(dcmp);
+  dmx->dcmp = dcmp;
+  dmx->fts = fts;
+  st1vafe6ax_fifo_demux_clear(dmx);
+}
+
+/**
+  * @brief  Empty all the demultiplexer buffers (e.g. once consumed).
+  *
+  * @param  dmx      demultiplexer
+  *
+  */
+void st1vafe6ax_fifo_demux_clear(st1vafe6ax_fifo_demux_t *dmx)
+{
+  dmx->xl.len = 0U;
+  dmx->xl.ts_pend = 0U;
+  dmx->gy.len = 0U;
+  dmx->gy.ts_pend = 0U;
+  dmx->ah_bio.len = 0U;
+  dmx->ah_bio.ts_pend = 0U;
+  dmx->temp.len = 0U;
+  dmx->temp.ts_pend = 0U;
+}
+
+/**
+  * @brief  Demultiplex FIFO words into per-channel buffers (structure of
+  *         arrays): accelerometer and gyroscope x[], y[], z[] (compressed
+  *         words are expanded), AH / vAFE and temperature samples.
+  *         If a timestamp engine is linked, the ts columns receive the time
+  *         of each sample in ns; samples after the last TIMESTAMP_TAG word
+  *         of the block are extrapolated. Without a timestamp engine the
+  *         ts columns hold the raw FIFO time slot of each sample.
+  *         Processing stops at the first word that does not fit in its
+  *         destination buffer.
+  *
+  * @param  dmx      demultiplexer
+  * @param  val      FIFO words (st1vafe6ax_fifo_out_raw_burst_get())
+  * @param  num      number of FIFO words
+  * @retval          number of FIFO words consumed
+  *
+  */
+uint16_t st1vafe6ax_fifo_demux(st1vafe6ax_fifo_demux_t *dmx,
+                               const st1vafe6ax_fifo_out_raw_t *val, uint16_t num)
+{
+  st1vafe6ax_fifo_dcmp_sample_t smp[3];
+  st1vafe6ax_fifo_axis_buf_t *axis;
+  st1vafe6ax_fifo_chan_buf_t *chan = NULL;
+  uint8_t need = 0U;
+  uint8_t cnt;
+  uint8_t i;
+  uint16_t n;
+
+  for (n = 0U; n < num; n++)
+  {
+    /* room needed in the destination buffer */
+    switch (val[n].tag)
+    {
+      case ST1VAFE6AX_XL_NC_TAG:
+      case ST1VAFE6AX_XL_NC_T_1_TAG:
+      case ST1VAFE6AX_XL_NC_T_2_TAG:
+      case ST1VAFE6AX_GY_NC_TAG:
+      case ST1VAFE6AX_GY_NC_T_1_TAG:
+      case ST1VAFE6AX_GY_NC_T_2_TAG:
+        need = 1U;
+        break;
+
+      case ST1VAFE6AX_XL_2XC_TAG:
+      case ST1VAFE6AX_GY_2XC_TAG:
+        need = 2U;
+        break;
+
+      case ST1VAFE6AX_XL_3XC_TAG:
+      case ST1VAFE6AX_GY_3XC_TAG:
+        need = 3U;
+        break;
+
+      default:
+        need = 0U;
+        break;
+    }
+
+    axis = ((val[n].tag == ST1VAFE6AX_XL_NC_TAG) || (val[n].tag == ST1VAFE6AX_XL_NC_T_1_TAG) ||
+            (val[n].tag == ST1VAFE6AX_XL_NC_T_2_TAG) || (val[n].tag == ST1VAFE6AX_XL_2XC_TAG) ||
+            (val[n].tag == ST1VAFE6AX_XL_3XC_TAG)) ? &dmx->xl : &dmx->gy;
+    chan = (val[n].tag == ST1VAFE6AX_TEMPERATURE_TAG) ? &dmx->temp :
+           ((val[n].tag == ST1VAFE6AX_AH_VAFE) ? &dmx->ah_bio : NULL);
+
+    if (((need != 0U) && (axis->x != NULL) && ((axis->cap - axis->len) < need)) ||
+        ((chan != NULL) && (chan->data != NULL) && (chan->len >= chan->cap)))
+    {
+      break;
+    }
+
+    cnt = st1vafe6ax_fifo_dcmp_process(dmx->dcmp, &val[n], smp);
+    for (i = 0U; i < cnt; i++)
+    {
+      axis = (smp[i].sensor == ST1VAFE6AX_FIFO_DCMP_XL) ? &dmx->xl : &dmx->gy;
+      if (axis->x == NULL)
+      {
+        continue;
+      }
+      axis->x[axis->len] = smp[i].data[0];
+      axis->y[axis->len] = smp[i].data[1];
+      axis->z[axis->len] = smp[i].data[2];
+      if (axis->ts != NULL)
+      {
+        axis->ts[axis->len] = smp[i].slot;
+      }
+      axis->len++;
+    }
+
+    if (chan != NULL)
+    {
+      fifo_demux_chan_put(chan, dmx->dcmp->slot, val[n].data);
+    }
+
+    if ((val[n].tag == ST1VAFE6AX_TIMESTAMP_TAG) && (dmx->fts != NULL))
+    {
+      /* samples received so far can be interpolated */
+      st1vafe6ax_fifo_ts_anchor(dmx->fts, dmx->dcmp->slot, &val[n]);
+      fifo_demux_ts_flush(dmx->fts, dmx->xl.ts, &dmx->xl.ts_pend, dmx->xl.len);
+      fifo_demux_ts_flush(dmx->fts, dmx->gy.ts, &dmx->gy.ts_pend, dmx->gy.len);
+      fifo_demux_ts_flush(dmx->fts, dmx->ah_bio.ts, &dmx->ah_bio.ts_pend, dmx->ah_bio.len);
+      fifo_demux_ts_flush(dmx->fts, dmx->temp.ts, &dmx->temp.ts_pend, dmx->temp.len);
+    }
+  }
+
+  if (dmx->fts != NULL)
+  {
+    fifo_demux_ts_flush(dmx->fts, dmx->xl.ts, &dmx->xl.ts_pend, dmx->xl.len);
+    fifo_demux_ts_flush(dmx->fts, dmx->gy.ts, &dmx->gy.ts_pend, dmx->gy.len);
+    fifo_demux_ts_flush(dmx->fts, dmx->ah_bio.ts, &dmx->ah_bio.ts_pend, dmx->ah_bio.len);
+    fifo_demux_ts_flush(dmx->fts, dmx->temp.ts, &dmx->temp.ts_pend, dmx->temp.len);
+  }
+
+  return n;
+}
+
+/**
+  * @brief  Batching in FIFO buffer of step counter value.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Batching in FIFO buffer of step counter value.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_stpcnt_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_fifo_en_a.step_counter_fifo_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Batching in FIFO buffer of step counter value.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Batching in FIFO buffer of step counter value.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_stpcnt_batch_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    *val = emb_func_fifo_en_a.step_counter_fifo_en;
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+
+  return ret;
+}
+
+/**
+  * @brief  Batching in FIFO buffer of machine learning core results.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Batching in FIFO buffer of machine learning core results.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_mlc_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_fifo_en_a.mlc_fifo_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Batching in FIFO buffer of machine learning core results.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Batching in FIFO buffer of machine learning core results.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_mlc_batch_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_emb_func_fifo_en_a_t emb_func_fifo_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_A, (uint8_t *)&emb_func_fifo_en_a, 1);
+  }
+
+  if (ret == 0)
+  {
+    *val = emb_func_fifo_en_a.mlc_fifo_en;
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Enables batching in FIFO buffer of machine learning core filters and features.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables batching in FIFO buffer of machine learning core filters and features.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_mlc_filt_batch_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_emb_func_fifo_en_b_t emb_func_fifo_en_b = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_B, (uint8_t *)&emb_func_fifo_en_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_fifo_en_b.mlc_filter_feature_fifo_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_B, (uint8_t *)&emb_func_fifo_en_b, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Enables batching in FIFO buffer of machine learning core filters and features.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables batching in FIFO buffer of machine learning core filters and features.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fifo_mlc_filt_batch_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_emb_func_fifo_en_b_t emb_func_fifo_en_b = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_FIFO_EN_B, (uint8_t *)&emb_func_fifo_en_b, 1);
+  }
+
+  if (ret == 0)
+  {
+    *val = emb_func_fifo_en_b.mlc_filter_feature_fifo_en;
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  Step Counter
+  * @brief     This section groups all the functions that manage pedometer.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Step counter mode[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      false_step_rej, step_counter, step_detector,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_stpcnt_mode_set(const stmdev_ctx_t *ctx,
+                                   st1vafe6ax_stpcnt_mode_t val)
+{
+  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  st1vafe6ax_emb_func_en_b_t emb_func_en_b = {0};
+  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
+  }
+  if ((val.false_step_rej == PROPERTY_ENABLE)
+      && ((emb_func_en_a.mlc_before_fsm_en & emb_func_en_b.mlc_en) ==
+          PROPERTY_DISABLE))
+  {
+    emb_func_en_a.mlc_before_fsm_en = PROPERTY_ENABLE;
+  }
+  if (ret == 0)
+  {
+    emb_func_en_a.pedo_en = val.step_counter_enable;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
+  }
+  if (ret == 0)
+  {
+    pedo_cmd_reg.fp_rejection_en = val.false_step_rej;
+    ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Step counter mode[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      false_step_rej, step_counter, step_detector,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_stpcnt_mode_get(const stmdev_ctx_t *ctx,
+                                   st1vafe6ax_stpcnt_mode_t *val)
+{
+  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  st1vafe6ax_pedo_cmd_reg_t pedo_cmd_reg = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_CMD_REG, (uint8_t *)&pedo_cmd_reg, 1);
+  }
+
+  if (ret == 0)
+  {
+    val->false_step_rej = pedo_cmd_reg.fp_rejection_en;
+    val->step_counter_enable = emb_func_en_a.pedo_en;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Step counter output, number of detected steps.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Step counter output, number of detected steps.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_stpcnt_steps_get(const stmdev_ctx_t *ctx, uint16_t *val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_STEP_COUNTER_L, &buff[0], 2);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  if (ret == 0)
+  {
+    *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Reset step counter.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Reset step counter.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_stpcnt_rst_step_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_emb_func_src_t emb_func_src = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_SRC, (uint8_t *)&emb_func_src, 1);
+  }
+
+  if (ret == 0)
+  {
+    emb_func_src.pedo_rst_step = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_SRC, (uint8_t *)&emb_func_src, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Reset step counter.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Reset step counter.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_stpcnt_rst_step_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_emb_func_src_t emb_func_src = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_SRC, (uint8_t *)&emb_func_src, 1);
+  }
+
+  if (ret == 0)
+  {
+    *val = emb_func_src.pedo_rst_step;
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Pedometer debounce configuration.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Pedometer debounce configuration.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_stpcnt_debounce_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_pedo_deb_steps_conf_t pedo_deb_steps_conf = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_DEB_STEPS_CONF, (uint8_t *)&pedo_deb_steps_conf,
+                              1);
+  if (ret == 0)
+  {
+    pedo_deb_steps_conf.deb_step = val;
+    ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_DEB_STEPS_CONF, (uint8_t *)&pedo_deb_steps_conf,
+                                 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Pedometer debounce configuration.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Pedometer debounce configuration.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_stpcnt_debounce_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_pedo_deb_steps_conf_t pedo_deb_steps_conf = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_DEB_STEPS_CONF, (uint8_t *)&pedo_deb_steps_conf,
+                              1);
+  if (ret == 0)
+  {
+    *val = pedo_deb_steps_conf.deb_step;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Time period register for step detection on delta time.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Time period register for step detection on delta time.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_stpcnt_period_set(const stmdev_ctx_t *ctx, uint16_t val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  buff[1] = (uint8_t)(val / 256U);
+  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+
+  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_SC_DELTAT_L, (uint8_t *)&buff[0], 2);
+
+  return ret;
+}
+
+/**
+  * @brief  Time period register for step detection on delta time.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Time period register for step detection on delta time.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_stpcnt_period_get(const stmdev_ctx_t *ctx, uint16_t *val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_PEDO_SC_DELTAT_L, &buff[0], 2);
+
+  if (ret == 0)
+  {
+    *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  }
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  Significant motion
+  * @brief   This section groups all the functions that manage the
+  *          significant motion detection.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enables significant motion detection function.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables significant motion detection function.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_sigmot_mode_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+  if (ret == 0)
+  {
+    emb_func_en_a.sign_motion_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+
+  return ret;
+}
+
+/**
+  * @brief  Enables significant motion detection function.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enables significant motion detection function.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_sigmot_mode_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+  if (ret == 0)
+  {
+    *val = emb_func_en_a.sign_motion_en;
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  Tilt detection
+  * @brief     This section groups all the functions that manage the tilt
+  *            event detection.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Tilt calculation.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Tilt calculation.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_tilt_mode_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+  if (ret == 0)
+  {
+    emb_func_en_a.tilt_en = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Tilt calculation.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Tilt calculation.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_tilt_mode_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+  if (ret == 0)
+  {
+    *val = emb_func_en_a.tilt_en;
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  Sensor Fusion Low Power (SFLP)
+  * @brief     This section groups all the functions that manage pedometer.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enable SFLP Game Rotation Vector (6x).[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enable/Disable game rotation value (0/1).
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_sflp_game_rotation_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+  if (ret == 0)
+  {
+    emb_func_en_a.sflp_game_en = (uint8_t)(val & 0x01);
+    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A,
+                                (uint8_t *)&emb_func_en_a, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Enable SFLP Game Rotation Vector (6x).[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enable/Disable game rotation value (0/1).
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_sflp_game_rotation_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_emb_func_en_a_t emb_func_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_func_en_a, 1);
+  }
+  if (ret == 0)
+  {
+    *val = emb_func_en_a.sflp_game_en;
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  SFLP Data Rate (ODR) configuration.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      SFLP_15Hz, SFLP_30Hz, SFLP_60Hz, SFLP_120Hz, SFLP_240Hz, SFLP_480Hz
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_sflp_data_rate_set(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_sflp_data_rate_t val)
+{
+  st1vafe6ax_sflp_odr_t sflp_odr = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_SFLP_ODR, (uint8_t *)&sflp_odr, 1);
+  }
+  if (ret == 0)
+  {
+    sflp_odr.sflp_game_odr = (uint8_t)val & 0x07U;
+    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_SFLP_ODR, (uint8_t *)&sflp_odr,
+                                1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  SFLP Data Rate (ODR) configuration.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      SFLP_15Hz, SFLP_30Hz, SFLP_60Hz, SFLP_120Hz, SFLP_240Hz, SFLP_480Hz
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_sflp_data_rate_get(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_sflp_data_rate_t *val)
+{
+  st1vafe6ax_sflp_odr_t sflp_odr = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_SFLP_ODR, (uint8_t *)&sflp_odr, 1);
+  }
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (sflp_odr.sflp_game_odr)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_SFLP_15Hz;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_SFLP_30Hz;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_SFLP_60Hz;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_SFLP_120Hz;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_SFLP_240Hz;
+      break;
+
+    case 0x05:
+      *val = ST1VAFE6AX_SFLP_480Hz;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_SFLP_15Hz;
+      break;
+  }
+  return ret;
+}
+
+/*
+ * Original conversion routines taken from: https://github.com/numpy/numpy
+ *
+ * uint16_t npy_floatbits_to_halfbits(uint32_t f);
+ * uint16_t npy_float_to_half(float_t f);
+ *
+ * Released under BSD-3-Clause License
+ */
+
+#define NPY_HALF_GENERATE_OVERFLOW  0 /* do not trigger FP overflow */
+#define NPY_HALF_GENERATE_UNDERFLOW 0 /* do not trigger FP underflow */
+#ifndef NPY_HALF_ROUND_TIES_TO_EVEN
+#define NPY_HALF_ROUND_TIES_TO_EVEN 1
+#endif
+
+static uint16_t npy_floatbits_to_halfbits(uint32_t f)
+{
+  uint32_t f_exp = 0, f_sig = 0;
+  uint16_t h_sgn = 0, h_exp = 0, h_sig = 0;
+
+  h_sgn = (uint16_t)((f & 0x80000000u) >> 16);
+  f_exp = (f & 0x7f800000u);
+
+  /* Exponent overflow/NaN converts to signed inf/NaN */
+  if (f_exp >= 0x47800000u)
+  {
+    if (f_exp == 0x7f800000u)
+    {
+      /* Inf or NaN */
+      f_sig = (f & 0x007fffffu);
+      if (f_sig != 0u)
+      {
+        /* NaN - propagate the flag in the significand... */
+        uint16_t ret = (uint16_t)(0x7c00u + (f_sig >> 13));
+        /* ...but make sure it stays a NaN */
+        if (ret == 0x7c00u)
+        {
+          ret++;
+        }
         return h_sgn + ret;
       }
       else
       {
-        /* signed inf */
-        return (uint16_t)(h_sgn + 0x7c00u);
+        /* signed inf */
+        return (uint16_t)(h_sgn + 0x7c00u);
+      }
+    }
+    else
+    {
+      /* overflow to signed inf */
+#if NPY_HALF_GENERATE_OVERFLOW
+      npy_set_floatstatus_overflow();
+#endif
+      return (uint16_t)(h_sgn + 0x7c00u);
+    }
+  }
+
+  /* Exponent underflow converts to a subnormal half or signed zero */
+  if (f_exp <= 0x38000000u)
+  {
+    /*
+     * Signed zeros, subnormal floats, and floats with small
+     * exponents all convert to signed zero half-floats.
+     */
+    if (f_exp < 0x33000000u)
+    {
+#if NPY_HALF_GENERATE_UNDERFLOW
+      /* If f != 0, it underflowed to 0 */
+      if ((f & 0x7fffffff) != 0)
+      {
+        npy_set_floatstatus_underflow();
+      }
+#endif
+      return h_sgn;
+    }
+    /* Make the subnormal significand */
+    f_exp >>= 23;
+    f_sig = (0x00800000u + (f & 0x007fffffu));
+#if NPY_HALF_GENERATE_UNDERFLOW
+    /* If it's not exactly represented, it underflowed */
+    if ((f_sig & (((uint32_t)1 << (126 - f_exp)) - 1)) != 0)
+    {
+      npy_set_floatstatus_underflow();
+    }
+#endif
+    /*
+     * Usually the significand is shifted by 13. For subnormals an
+     * additional shift needs to occur. This shift is one for the largest
+     * exponent giving a subnormal `f_exp = 0x38000000 >> 23 = 112`, which
+     * offsets the new first bit. At most the shift can be 1+10 bits.
+     */
+    f_sig >>= (113u - f_exp);
+    /* Handle rounding by adding 1 to the bit beyond half precision */
+#if NPY_HALF_ROUND_TIES_TO_EVEN
+    /*
+     * If the last bit in the half significand is 0 (already even), and
+     * the remaining bit pattern is 1000...0, then we do not add one
+     * to the bit after the half significand. However, the (113 - f_exp)
+     * shift can lose up to 11 bits, so the || checks them in the original.
+     * In all other cases, we can just add one.
+     */
+    if (((f_sig & 0x00003fffu) != 0x00001000u) || ((f & 0x000007ffu) != 0u))
+    {
+      f_sig += 0x00001000u;
+    }
+#else
+    f_sig += 0x00001000u;
+#endif
+    h_sig = (uint16_t)(f_sig >> 13);
+    /*
+     * If the rounding causes a bit to spill into h_exp, it will
+     * increment h_exp from zero to one and h_sig will be zero.
+     * This is the correct result.
+     */
+    return (uint16_t)(h_sgn + h_sig);
+  }
+
+  /* Regular case with no overflow or underflow */
+  h_exp = (uint16_t)((f_exp - 0x38000000u) >> 13);
+  /* Handle rounding by adding 1 to the bit beyond half precision */
+  f_sig = (f & 0x007fffffu);
+#if NPY_HALF_ROUND_TIES_TO_EVEN
+  /*
+   * If the last bit in the half significand is 0 (already even), and
+   * the remaining bit pattern is 1000...0, then we do not add one
+   * to the bit after the half significand.  In all other cases, we do.
+   */
+  if ((f_sig & 0x00003fffu) != 0x00001000u)
+  {
+    f_sig += 0x00001000u;
+  }
+#else
+  f_sig += 0x00001000u;
+#endif
+  h_sig = (uint16_t)(f_sig >> 13);
+  /*
+   * If the rounding causes a bit to spill into h_exp, it will
+   * increment h_exp by one and h_sig will be zero.  This is the
+   * correct result.  h_exp may increment to 15, at greatest, in
+   * which case the result overflows to a signed inf.
+   */
+#if NPY_HALF_GENERATE_OVERFLOW
+  h_sig += h_exp;
+  if (h_sig == 0x7c00u)
+  {
+    npy_set_floatstatus_overflow();
+  }
+  return (uint16_t)(h_sgn + h_sig);
+#else
+  return (uint16_t)(h_sgn + h_exp + h_sig);
+#endif
+}
+
+static uint16_t npy_float_to_half(float_t f)
+{
+  uint32_t bits = {0};
+
+  (void)memcpy(&bits, &f, sizeof(bits));
+
+  return npy_floatbits_to_halfbits(bits);
+}
+
+/**
+  * @brief  SFLP GBIAS value. The register value is expressed as half-precision
+  *         floating-point format: SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent
+  *          bits; F: 10 fraction bits).[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      GBIAS x/y/z val.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_sflp_game_gbias_set(const stmdev_ctx_t *ctx,
+                                       const st1vafe6ax_sflp_gbias_t *val)
+{
+  st1vafe6ax_sflp_data_rate_t sflp_odr = ST1VAFE6AX_SFLP_15Hz;
+  st1vafe6ax_emb_func_exec_status_t emb_func_sts = {0};
+  st1vafe6ax_data_ready_t drdy = {0};
+  st1vafe6ax_xl_full_scale_t xl_fs = ST1VAFE6AX_2g;
+  st1vafe6ax_ctrl10_t ctrl10 = {0};
+  uint8_t master_config = {0};
+  uint8_t emb_func_en_saved[2] = {0};
+  uint8_t conf_saved[2] = {0};
+  uint8_t reg_zero[2] = {0x0, 0x0};
+  uint16_t gbias_hf[3] = {0};
+  float_t k = 0.005f;
+  int16_t xl_data[3] = {0};
+  int32_t data_tmp = 0;
+  uint8_t *data_ptr = (uint8_t *)&data_tmp;
+  uint8_t i = 0, j = 0;
+  int32_t ret = 0;
+
+  ret = st1vafe6ax_sflp_data_rate_get(ctx, &sflp_odr);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  /* Calculate k factor */
+  switch (sflp_odr)
+  {
+    case ST1VAFE6AX_SFLP_15Hz:
+      k = 0.04f;
+      break;
+    case ST1VAFE6AX_SFLP_30Hz:
+      k = 0.02f;
+      break;
+    case ST1VAFE6AX_SFLP_60Hz:
+      k = 0.01f;
+      break;
+    case ST1VAFE6AX_SFLP_120Hz:
+      k = 0.005f;
+      break;
+    case ST1VAFE6AX_SFLP_240Hz:
+      k = 0.0025f;
+      break;
+    case ST1VAFE6AX_SFLP_480Hz:
+      k = 0.00125f;
+      break;
+    default:
+      k = 0.04f;
+      break;
+  }
+
+  /* compute gbias as half precision float in order to be put in embedded advanced feature register */
+  gbias_hf[0] = npy_float_to_half(val->gbias_x * (3.14159265358979323846f / 180.0f) / k);
+  gbias_hf[1] = npy_float_to_half(val->gbias_y * (3.14159265358979323846f / 180.0f) / k);
+  gbias_hf[2] = npy_float_to_half(val->gbias_z * (3.14159265358979323846f / 180.0f) / k);
+
+  /* Save sensor configuration and set high-performance mode (if the sensor is in power-down mode, turn it on) */
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, conf_saved, 2);
+  ret += st1vafe6ax_xl_mode_set(ctx, ST1VAFE6AX_XL_HIGH_PERFORMANCE_MD);
+  ret += st1vafe6ax_gy_mode_set(ctx, ST1VAFE6AX_GY_HIGH_PERFORMANCE_MD);
+
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  if ((conf_saved[0] & 0x0FU) == (uint8_t)ST1VAFE6AX_XL_ODR_OFF)
+  {
+    ret += st1vafe6ax_xl_data_rate_set(ctx, ST1VAFE6AX_XL_ODR_AT_120Hz);
+  }
+
+  /* disable algos */
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+
+  if (ret == 0)
+  {
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, emb_func_en_saved,
+                               2);
+  }
+  if (ret == 0)
+  {
+    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, reg_zero, 2);
+  }
+  if (ret == 0)
+  {
+    do
+    {
+      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EXEC_STATUS,
+                                 (uint8_t *)&emb_func_sts, 1);
+    } while (emb_func_sts.emb_func_endop != 1u);
+  }
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  // enable gbias setting
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+  ctrl10.emb_func_debug = 1;
+  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  /* enable algos */
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    emb_func_en_saved[0] |= 0x02u; /* force SFLP GAME en */
+    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, emb_func_en_saved,
+                                2);
+  }
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  ret += st1vafe6ax_xl_full_scale_get(ctx, &xl_fs);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  /* Read XL data */
+  do
+  {
+    ret += st1vafe6ax_flag_data_ready_get(ctx, &drdy);
+  } while (drdy.drdy_xl != 1u);
+  ret += st1vafe6ax_acceleration_raw_get(ctx, xl_data);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  /* force sflp initialization */
+  master_config = 0x40;
+  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &master_config,
+                              1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  for (i = 0; i < 3; i++)
+  {
+    j = 0;
+    data_tmp = (int32_t)xl_data[i];
+    data_tmp <<= (uint8_t)xl_fs; // shift based on current fs
+    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x02 + 3 * i), &data_ptr[j++], 1);
+    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x03 + 3 * i), &data_ptr[j++], 1);
+    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x04 + 3 * i), &data_ptr[j], 1);
+  }
+  for (i = 0; i < 3; i++)
+  {
+    j = 0;
+    data_tmp = 0;
+    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x0B + 3 * i), &data_ptr[j++], 1);
+    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x0C + 3 * i), &data_ptr[j++], 1);
+    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x0D + 3 * i), &data_ptr[j], 1);
+  }
+  master_config = 0x00;
+  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &master_config,
+                              1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  // wait end_op (and at least 30 us)
+  ret += cmd_list_mdelay(ctx, 1);
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    do
+    {
+      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EXEC_STATUS,
+                                 (uint8_t *)&emb_func_sts, 1);
+    } while (emb_func_sts.emb_func_endop != 1u);
+  }
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  /* write gbias in embedded advanced features registers */
+  ret += st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_SFLP_GAME_GBIASX_L,
+                                (uint8_t *)gbias_hf, 6);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  /* reload previous sensor configuration */
+  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL1, conf_saved, 2);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  // disable gbias setting
+  ctrl10.emb_func_debug = 0;
+  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+
+  return ret;
+}
+
+/**
+  * @brief  SFLP initial configuration [set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_sflp_configure(const stmdev_ctx_t *ctx)
+{
+  uint8_t val = 0x50;
+  int32_t ret = 0;
+
+  ret = st1vafe6ax_ln_pg_write(ctx, 0xD2, &val, 1);
+
+  return ret;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @defgroup  Finite State Machine (FSM)
+  * @brief     This section groups all the functions that manage the
+  *            state_machine.
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enables the control of the CTRL registers to FSM (FSM can change some configurations of the device autonomously).[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      PROTECT_CTRL_REGS, WRITE_CTRL_REG,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_permission_set(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_fsm_permission_t val)
+{
+  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+  if (ret == 0)
+  {
+    func_cfg_access.fsm_wr_ctrl_en = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Enables the control of the CTRL registers to FSM (FSM can change some configurations of the device autonomously).[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      PROTECT_CTRL_REGS, WRITE_CTRL_REG,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_permission_get(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_fsm_permission_t *val)
+{
+  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (func_cfg_access.fsm_wr_ctrl_en)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_PROTECT_CTRL_REGS;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_WRITE_CTRL_REG;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_PROTECT_CTRL_REGS;
+      break;
+  }
+  return ret;
+}
+
+/**
+  * @brief  Return the status of the CTRL registers permission (standard interface vs FSM).[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      0: all FSM regs are under std_if control, 1: some regs are under FSM control.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_permission_status(const stmdev_ctx_t *ctx,
+                                         st1vafe6ax_fsm_permission_status_t *val)
+{
+  st1vafe6ax_ctrl_status_t status = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL_STATUS, (uint8_t *)&status, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = (status.fsm_wr_ctrl_status == 0u) ? ST1VAFE6AX_STD_IF_CONTROL : ST1VAFE6AX_FSM_CONTROL;
+
+  return ret;
+}
+
+/**
+  * @brief  Enable Finite State Machine (FSM) feature.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enable Finite State Machine (FSM) feature.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_fsm_mode_t val)
+{
+  st1vafe6ax_emb_func_en_b_t emb_func_en_b = {0};
+  st1vafe6ax_fsm_enable_t fsm_enable = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
+  }
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_ENABLE, (uint8_t *)&fsm_enable, 1);
+  }
+  if ((val.fsm1_en | val.fsm2_en | val.fsm1_en | val.fsm1_en
+       | val.fsm1_en | val.fsm2_en | val.fsm1_en | val.fsm1_en) == PROPERTY_ENABLE)
+  {
+    emb_func_en_b.fsm_en = PROPERTY_ENABLE;
+  }
+  else
+  {
+    emb_func_en_b.fsm_en = PROPERTY_DISABLE;
+  }
+  if (ret == 0)
+  {
+    fsm_enable.fsm1_en = val.fsm1_en;
+    fsm_enable.fsm2_en = val.fsm2_en;
+    fsm_enable.fsm3_en = val.fsm3_en;
+    fsm_enable.fsm4_en = val.fsm4_en;
+    fsm_enable.fsm5_en = val.fsm5_en;
+    fsm_enable.fsm6_en = val.fsm6_en;
+    fsm_enable.fsm7_en = val.fsm7_en;
+    fsm_enable.fsm8_en = val.fsm8_en;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FSM_ENABLE, (uint8_t *)&fsm_enable, 1);
+  }
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Enable Finite State Machine (FSM) feature.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      Enable Finite State Machine (FSM) feature.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_fsm_mode_t *val)
+{
+  st1vafe6ax_fsm_enable_t fsm_enable = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_ENABLE, (uint8_t *)&fsm_enable, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  val->fsm1_en = fsm_enable.fsm1_en;
+  val->fsm2_en = fsm_enable.fsm2_en;
+  val->fsm3_en = fsm_enable.fsm3_en;
+  val->fsm4_en = fsm_enable.fsm4_en;
+  val->fsm5_en = fsm_enable.fsm5_en;
+  val->fsm6_en = fsm_enable.fsm6_en;
+  val->fsm7_en = fsm_enable.fsm7_en;
+  val->fsm8_en = fsm_enable.fsm8_en;
+
+  return ret;
+}
+
+/**
+  * @brief  FSM long counter status register. Long counter value is an unsigned integer value (16-bit format).[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM long counter status register. Long counter value is an unsigned integer value (16-bit format).
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_long_cnt_set(const stmdev_ctx_t *ctx, uint16_t val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  buff[1] = (uint8_t)(val / 256U);
+  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FSM_LONG_COUNTER_L, (uint8_t *)&buff[0], 2);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  FSM long counter status register. Long counter value is an unsigned integer value (16-bit format).[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM long counter status register. Long counter value is an unsigned integer value (16-bit format).
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_long_cnt_get(const stmdev_ctx_t *ctx, uint16_t *val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_LONG_COUNTER_L, &buff[0], 2);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+
+  return ret;
+}
+
+/**
+  * @brief  FSM output registers[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM output registers
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_out_get(const stmdev_ctx_t *ctx, st1vafe6ax_fsm_out_t *val)
+{
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_OUTS1, (uint8_t *)val, 8);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Finite State Machine Output Data Rate (ODR) configuration.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM_15Hz, FSM_30Hz, FSM_60Hz, FSM_120Hz, FSM_240Hz, FSM_480Hz, FSM_960Hz,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_data_rate_set(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_fsm_data_rate_t val)
+{
+  st1vafe6ax_fsm_odr_t fsm_odr = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_ODR, (uint8_t *)&fsm_odr, 1);
+  }
+
+  if (ret == 0)
+  {
+    fsm_odr.fsm_odr = (uint8_t)val & 0x07U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FSM_ODR, (uint8_t *)&fsm_odr, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  return ret;
+}
+
+/**
+  * @brief  Finite State Machine Output Data Rate (ODR) configuration.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM_15Hz, FSM_30Hz, FSM_60Hz, FSM_120Hz, FSM_240Hz, FSM_480Hz, FSM_960Hz,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_data_rate_get(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_fsm_data_rate_t *val)
+{
+  st1vafe6ax_fsm_odr_t fsm_odr = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_ODR, (uint8_t *)&fsm_odr, 1);
+  }
+
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  switch (fsm_odr.fsm_odr)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_FSM_15Hz;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_FSM_30Hz;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_FSM_60Hz;
+      break;
+
+    case 0x03:
+      *val = ST1VAFE6AX_FSM_120Hz;
+      break;
+
+    case 0x04:
+      *val = ST1VAFE6AX_FSM_240Hz;
+      break;
+
+    case 0x05:
+      *val = ST1VAFE6AX_FSM_480Hz;
+      break;
+
+    case 0x06:
+      *val = ST1VAFE6AX_FSM_960Hz;
+      break;
+
+    default:
+      *val = ST1VAFE6AX_FSM_15Hz;
+      break;
+  }
+  return ret;
+}
+
+/**
+  * @brief  FSM long counter timeout. The long counter timeout value is an unsigned integer value (16-bit format). When the long counter value reached this value, the FSM generates an interrupt.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM long counter timeout. The long counter timeout value is an unsigned integer value (16-bit format). When the long counter value reached this value, the FSM generates an interrupt.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_long_cnt_timeout_set(const stmdev_ctx_t *ctx, uint16_t val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  buff[1] = (uint8_t)(val / 256U);
+  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_FSM_LC_TIMEOUT_L, (uint8_t *)&buff[0], 2);
+
+  return ret;
+}
+
+/**
+  * @brief  FSM long counter timeout. The long counter timeout value is an unsigned integer value (16-bit format). When the long counter value reached this value, the FSM generates an interrupt.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM long counter timeout. The long counter timeout value is an unsigned integer value (16-bit format). When the long counter value reached this value, the FSM generates an interrupt.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_long_cnt_timeout_get(const stmdev_ctx_t *ctx, uint16_t *val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_LC_TIMEOUT_L, &buff[0], 2);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+
+  return ret;
+}
+
+/**
+  * @brief  FSM number of programs.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM number of programs.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_number_of_programs_set(const stmdev_ctx_t *ctx, uint8_t val)
+{
+  st1vafe6ax_fsm_programs_t fsm_programs = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_PROGRAMS, (uint8_t *)&fsm_programs, 1);
+  if (ret == 0)
+  {
+    fsm_programs.fsm_n_prog = val;
+    ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_FSM_PROGRAMS, (uint8_t *)&fsm_programs, 1);
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  FSM number of programs.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM number of programs.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_number_of_programs_get(const stmdev_ctx_t *ctx, uint8_t *val)
+{
+  st1vafe6ax_fsm_programs_t fsm_programs = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_PROGRAMS, (uint8_t *)&fsm_programs, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = fsm_programs.fsm_n_prog;
+
+
+  return ret;
+}
+
+/**
+  * @brief  FSM start address. First available address is 0x35C.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM start address. First available address is 0x35C.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_start_address_set(const stmdev_ctx_t *ctx, uint16_t val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  buff[1] = (uint8_t)(val / 256U);
+  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_FSM_START_ADD_L, (uint8_t *)&buff[0], 2);
+
+  return ret;
+}
+
+/**
+  * @brief  FSM start address. First available address is 0x35C.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      FSM start address. First available address is 0x35C.
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_fsm_start_address_get(const stmdev_ctx_t *ctx, uint16_t *val)
+{
+  uint8_t buff[2] = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_START_ADD_L, &buff[0], 2);
+  if (ret != 0)
+  {
+    return ret;
+  }
+
+  *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+
+  return ret;
+}
+
+/* FSM loader: CRC-16/CCITT */
+static uint16_t fsm_crc16(uint16_t crc, const uint8_t *data, uint16_t len)
+{
+  uint16_t i;
+  uint8_t b;
+
+  for (i = 0U; i < len; i++)
+  {
+    crc ^= (uint16_t)data[i] << 8;
+    for (b = 0U; b < 8U; b++)
+    {
+      crc = ((crc & 0x8000U) != 0U) ? (uint16_t)((crc << 1) ^ 0x1021U) : (uint16_t)(crc << 1);
+    }
+  }
+
+  return crc;
+}
+
+/*
+ * FSM loader: CRC of a program area read back inside a page read access.
+ * With running_ok the bytes updated by the device while the program runs
+ * (PP, TMASKx, TC, DEST, PAS, see fsm_prg_runtime()) are taken from the
+ * expected program.
+ */
+static int32_t fsm_prg_crc(const stmdev_ctx_t *ctx, uint16_t address,
+                           const st1vafe6ax_fsm_prg_t *prg, uint8_t running_ok,
+                           uint16_t *crc)
+{
+  uint8_t buff[ST1VAFE6AX_PG_CHUNK];
+  uint16_t done = 0U;
+  uint16_t num;
+  uint16_t k;
+  int32_t ret = 0;
+
+  *crc = 0xFFFFU;
+  while ((ret == 0) && (done < prg->len))
+  {
+    num = prg->len - done;
+    num = (num > ST1VAFE6AX_PG_CHUNK) ? ST1VAFE6AX_PG_CHUNK : num;
+    ret = ln_pg_xfer(ctx, address + done, buff, num, 0U);
+    for (k = 0U; (running_ok == 1U) && (k < num); k++)
+    {
+      if (fsm_prg_runtime(prg->data, (uint16_t)(done + k)) == 1U)
+      {
+        buff[k] = prg->data[done + k];
       }
     }
-    else
+    *crc = fsm_crc16(*crc, buff, num);
+    done += num;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Load up to 8 FSM programs, stored one after the other from the
+  *         start address, and enable them.[set]
+  *         Programs already on the device at their address (and the
+  *         number of programs / start address / long counter timeout if
+  *         unchanged) are not rewritten. Otherwise the FSMs are disabled,
+  *         the changed programs are written with page bursts, read back
+  *         and checked by CRC, and FSM_INIT is requested.
+  *
+  * @param  ctx        read / write interface definitions
+  * @param  prg        compiled programs (at least the 6 header bytes each)
+  * @param  num        number of programs, 1 to 8
+  * @param  start      FSM start address. First available address is 0x35C.
+  * @param  lc_timeout FSM long counter timeout
+  * @param  written    bitmask of the programs written, set on success
+  *                    (optional, can be NULL)
+  * @retval            interface status (MANDATORY: return 0 -> no Error),
+  *                    -1 also if the parameters are not valid or the
+  *                    readback CRC does not match
+  *
+  */
+int32_t st1vafe6ax_fsm_load(const stmdev_ctx_t *ctx, const st1vafe6ax_fsm_prg_t *prg,
+                            uint8_t num, uint16_t start, uint16_t lc_timeout,
+                            uint8_t *written)
+{
+  st1vafe6ax_emb_func_init_b_t emb_func_init_b = {0};
+  st1vafe6ax_fsm_mode_t fsm_mode = {0};
+  uint16_t address[8];
+  uint16_t crc = 0U;
+  uint32_t end = start;
+  uint8_t cfg_cur[5];
+  uint8_t cfg[5];
+  uint8_t stale = 0U;
+  uint8_t mask;
+  uint8_t save[2];
+  uint8_t i;
+  int32_t ret;
+
+  if ((prg == NULL) || (num == 0U) || (num > 8U) || (start < 0x35CU))
+  {
+    return -1;
+  }
+
+  for (i = 0U; i < num; i++)
+  {
+    if ((prg[i].data == NULL) || (prg[i].len < 6U))
     {
-      /* overflow to signed inf */
-#if NPY_HALF_GENERATE_OVERFLOW
-      npy_set_floatstatus_overflow();
-#endif
-      return (uint16_t)(h_sgn + 0x7c00u);
+      return -1;
     }
+    address[i] = (uint16_t)end;
+    end += prg[i].len;
   }
 
-  /* Exponent underflow converts to a subnormal half or signed zero */
-  if (f_exp <= 0x38000000u)
+  if (end > 0x1000U)
   {
-    /*
-     * Signed zeros, subnormal floats, and floats with small
-     * exponents all convert to signed zero half-floats.
-     */
-    if (f_exp < 0x33000000u)
+    return -1;
+  }
+
+  /* FSM_LC_TIMEOUT_L/H, FSM_PROGRAMS, FSM_START_ADD_L/H */
+  cfg[0] = (uint8_t)(lc_timeout & 0xFFU);
+  cfg[1] = (uint8_t)(lc_timeout >> 8);
+  cfg[2] = num;
+  cfg[3] = (uint8_t)(start & 0xFFU);
+  cfg[4] = (uint8_t)(start >> 8);
+
+  /* what is already on the device */
+  ret = ln_pg_begin(ctx, 0U, 1U, save);
+  if (ret != 0)
+  {
+    return ret;
+  }
+  ret = ln_pg_xfer(ctx, ST1VAFE6AX_FSM_LC_TIMEOUT_L, &cfg_cur[0], 3, 0U);
+  ret += ln_pg_xfer(ctx, ST1VAFE6AX_FSM_START_ADD_L, &cfg_cur[3], 2, 0U);
+  for (i = 0U; (ret == 0) && (i < num); i++)
+  {
+    ret = fsm_prg_crc(ctx, address[i], &prg[i], 1U, &crc);
+    if (crc != fsm_crc16(0xFFFFU, prg[i].data, prg[i].len))
     {
-#if NPY_HALF_GENERATE_UNDERFLOW
-      /* If f != 0, it underflowed to 0 */
-      if ((f & 0x7fffffff) != 0)
-      {
-        npy_set_floatstatus_underflow();
-      }
-#endif
-      return h_sgn;
+      stale |= (uint8_t)(1U << i);
     }
-    /* Make the subnormal significand */
-    f_exp >>= 23;
-    f_sig = (0x00800000u + (f & 0x007fffffu));
-#if NPY_HALF_GENERATE_UNDERFLOW
-    /* If it's not exactly represented, it underflowed */
-    if ((f_sig & (((uint32_t)1 << (126 - f_exp)) - 1)) != 0)
+  }
+  ret += ln_pg_end(ctx, save);
+
+  if ((ret == 0) && ((stale != 0U) || (memcmp(cfg, cfg_cur, sizeof(cfg)) != 0)))
+  {
+    /* programs can not be changed while running */
+    ret = st1vafe6ax_fsm_mode_set(ctx, fsm_mode);
+    if (ret == 0)
     {
-      npy_set_floatstatus_underflow();
+      ret = ln_pg_begin(ctx, 1U, 1U, save);
     }
-#endif
-    /*
-     * Usually the significand is shifted by 13. For subnormals an
-     * additional shift needs to occur. This shift is one for the largest
-     * exponent giving a subnormal `f_exp = 0x38000000 >> 23 = 112`, which
-     * offsets the new first bit. At most the shift can be 1+10 bits.
-     */
-    f_sig >>= (113u - f_exp);
-    /* Handle rounding by adding 1 to the bit beyond half precision */
-#if NPY_HALF_ROUND_TIES_TO_EVEN
-    /*
-     * If the last bit in the half significand is 0 (already even), and
-     * the remaining bit pattern is 1000...0, then we do not add one
-     * to the bit after the half significand. However, the (113 - f_exp)
-     * shift can lose up to 11 bits, so the || checks them in the original.
-     * In all other cases, we can just add one.
-     */
-    if (((f_sig & 0x00003fffu) != 0x00001000u) || ((f & 0x000007ffu) != 0u))
+    if (ret == 0)
     {
-      f_sig += 0x00001000u;
+      if (memcmp(&cfg[0], &cfg_cur[0], 3) != 0)
+      {
+        ret = ln_pg_xfer(ctx, ST1VAFE6AX_FSM_LC_TIMEOUT_L, &cfg[0], 3, 1U);
+      }
+      if ((ret == 0) && (memcmp(&cfg[3], &cfg_cur[3], 2) != 0))
+      {
+        ret = ln_pg_xfer(ctx, ST1VAFE6AX_FSM_START_ADD_L, &cfg[3], 2, 1U);
+      }
+      for (i = 0U; (ret == 0) && (i < num); i++)
+      {
+        if ((stale & (1U << i)) != 0U)
+        {
+          ret = ln_pg_xfer_const(ctx, address[i], prg[i].data, prg[i].len);
+        }
+      }
+      if (ret == 0)
+      {
+        emb_func_init_b.fsm_init = PROPERTY_ENABLE;
+        ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_INIT_B,
+                                   (uint8_t *)&emb_func_init_b, 1);
+      }
+      ret += ln_pg_end(ctx, save);
+    }
+
+    /* bulk readback of the programs written */
+    if ((ret == 0) && (stale != 0U))
+    {
+      ret = ln_pg_begin(ctx, 0U, 1U, save);
+      if (ret == 0)
+      {
+        for (i = 0U; (ret == 0) && (i < num); i++)
+        {
+          if ((stale & (1U << i)) != 0U)
+          {
+            ret = fsm_prg_crc(ctx, address[i], &prg[i], 0U, &crc);
+            ret = ((ret == 0) && (crc != fsm_crc16(0xFFFFU, prg[i].data, prg[i].len))) ? -1 : ret;
+          }
+        }
+        ret += ln_pg_end(ctx, save);
+      }
     }
-#else
-    f_sig += 0x00001000u;
-#endif
-    h_sig = (uint16_t)(f_sig >> 13);
-    /*
-     * If the rounding causes a bit to spill into h_exp, it will
-     * increment h_exp from zero to one and h_sig will be zero.
-     * This is the correct result.
-     */
-    return (uint16_t)(h_sgn + h_sig);
   }
 
-  /* Regular case with no overflow or underflow */
-  h_exp = (uint16_t)((f_exp - 0x38000000u) >> 13);
-  /* Handle rounding by adding 1 to the bit beyond half precision */
-  f_sig = (f & 0x007fffffu);
-#if NPY_HALF_ROUND_TIES_TO_EVEN
-  /*
-   * If the last bit in the half significand is 0 (already even), and
-   * the remaining bit pattern is 1000...0, then we do not add one
-   * to the bit after the half significand.  In all other cases, we do.
-   */
-  if ((f_sig & 0x00003fffu) != 0x00001000u)
+  if (ret == 0)
   {
-    f_sig += 0x00001000u;
+    mask = (uint8_t)((1U << num) - 1U);
+    bytecpy((uint8_t *)&fsm_mode, &mask);
+    ret = st1vafe6ax_fsm_mode_set(ctx, fsm_mode);
   }
-#else
-  f_sig += 0x00001000u;
-#endif
-  h_sig = (uint16_t)(f_sig >> 13);
-  /*
-   * If the rounding causes a bit to spill into h_exp, it will
-   * increment h_exp by one and h_sig will be zero.  This is the
-   * correct result.  h_exp may increment to 15, at greatest, in
-   * which case the result overflows to a signed inf.
-   */
-#if NPY_HALF_GENERATE_OVERFLOW
-  h_sig += h_exp;
-  if (h_sig == 0x7c00u)
+
+  if ((ret == 0) && (written != NULL))
   {
-    npy_set_floatstatus_overflow();
+    *written = stale;
   }
-  return (uint16_t)(h_sgn + h_sig);
-#else
-  return (uint16_t)(h_sgn + h_exp + h_sig);
-#endif
+
+  return ret;
 }
 
-static uint16_t npy_float_to_half(float_t f)
-{
-  uint32_t bits = {0};
+/**
+  * @}
+  *
+  */
+
+/**
+  * @addtogroup  Machine Learning Core
+  * @brief   This section group all the functions concerning the
+  *          usage of Machine Learning Core
+  * @{
+  *
+  */
+
+/**
+  * @brief  It enables Machine Learning Core feature (MLC). When the Machine Learning Core is enabled the Finite State Machine (FSM) programs are executed before executing the MLC algorithms.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      MLC_OFF, MLC_ON, MLC_BEFORE_FSM,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_mlc_set(const stmdev_ctx_t *ctx, st1vafe6ax_mlc_mode_t val)
+{
+  st1vafe6ax_emb_func_en_b_t emb_en_b = {0};
+  st1vafe6ax_emb_func_en_a_t emb_en_a = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_en_a, 1);
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_en_b, 1);
+
+    if (ret == 0)
+    {
+      switch (val)
+      {
+        case ST1VAFE6AX_MLC_OFF:
+          emb_en_a.mlc_before_fsm_en = 0;
+          emb_en_b.mlc_en = 0;
+          break;
+        case ST1VAFE6AX_MLC_ON:
+          emb_en_a.mlc_before_fsm_en = 0;
+          emb_en_b.mlc_en = 1;
+          break;
+        case ST1VAFE6AX_MLC_ON_BEFORE_FSM:
+          emb_en_a.mlc_before_fsm_en = 1;
+          emb_en_b.mlc_en = 0;
+          break;
+        default:
+          emb_en_a.mlc_before_fsm_en = 0;
+          emb_en_b.mlc_en = 0;
+          break;
+      }
+
+      ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_en_a, 1);
+      ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_en_b, 1);
+    }
+  }
 
-  (void)memcpy(&bits, &f, sizeof(bits));
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
 
-  return npy_floatbits_to_halfbits(bits);
+  return ret;
 }
 
 /**
-  * @brief  SFLP GBIAS value. The register value is expressed as half-precision
-  *         floating-point format: SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent
-  *          bits; F: 10 fraction bits).[set]
+  * @brief  It enables Machine Learning Core feature (MLC). When the Machine Learning Core is enabled the Finite State Machine (FSM) programs are executed before executing the MLC algorithms.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      GBIAS x/y/z val.
+  * @param  val      MLC_OFF, MLC_ON, MLC_BEFORE_FSM,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_sflp_game_gbias_set(const stmdev_ctx_t *ctx,
-                                       const st1vafe6ax_sflp_gbias_t *val)
+int32_t st1vafe6ax_mlc_get(const stmdev_ctx_t *ctx, st1vafe6ax_mlc_mode_t *val)
 {
-  st1vafe6ax_sflp_data_rate_t sflp_odr = ST1VAFE6AX_SFLP_15Hz;
-  st1vafe6ax_emb_func_exec_status_t emb_func_sts = {0};
-  st1vafe6ax_data_ready_t drdy = {0};
-  st1vafe6ax_xl_full_scale_t xl_fs = ST1VAFE6AX_2g;
-  st1vafe6ax_ctrl10_t ctrl10 = {0};
-  uint8_t master_config = {0};
-  uint8_t emb_func_en_saved[2] = {0};
-  uint8_t conf_saved[2] = {0};
-  uint8_t reg_zero[2] = {0x0, 0x0};
-  uint16_t gbias_hf[3] = {0};
-  float_t k = 0.005f;
-  int16_t xl_data[3] = {0};
-  int32_t data_tmp = 0;
-  uint8_t *data_ptr = (uint8_t *)&data_tmp;
-  uint8_t i = 0, j = 0;
-  int32_t ret = 0;
+  st1vafe6ax_emb_func_en_b_t emb_en_b = {0};
+  st1vafe6ax_emb_func_en_a_t emb_en_a = {0};
+  int32_t ret = {0};
 
-  ret = st1vafe6ax_sflp_data_rate_get(ctx, &sflp_odr);
-  if (ret != 0)
-  {
-    return ret;
-  }
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
 
-  /* Calculate k factor */
-  switch (sflp_odr)
+  if (ret == 0)
   {
-    case ST1VAFE6AX_SFLP_15Hz:
-      k = 0.04f;
-      break;
-    case ST1VAFE6AX_SFLP_30Hz:
-      k = 0.02f;
-      break;
-    case ST1VAFE6AX_SFLP_60Hz:
-      k = 0.01f;
-      break;
-    case ST1VAFE6AX_SFLP_120Hz:
-      k = 0.005f;
-      break;
-    case ST1VAFE6AX_SFLP_240Hz:
-      k = 0.0025f;
-      break;
-    case ST1VAFE6AX_SFLP_480Hz:
-      k = 0.00125f;
-      break;
-    default:
-      k = 0.04f;
-      break;
-  }
-
-  /* compute gbias as half precision float in order to be put in embedded advanced feature register */
-  gbias_hf[0] = npy_float_to_half(val->gbias_x * (3.14159265358979323846f / 180.0f) / k);
-  gbias_hf[1] = npy_float_to_half(val->gbias_y * (3.14159265358979323846f / 180.0f) / k);
-  gbias_hf[2] = npy_float_to_half(val->gbias_z * (3.14159265358979323846f / 180.0f) / k);
-
-  /* Save sensor configuration and set high-performance mode (if the sensor is in power-down mode, turn it on) */
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL1, conf_saved, 2);
-  ret += st1vafe6ax_xl_mode_set(ctx, ST1VAFE6AX_XL_HIGH_PERFORMANCE_MD);
-  ret += st1vafe6ax_gy_mode_set(ctx, ST1VAFE6AX_GY_HIGH_PERFORMANCE_MD);
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_en_a, 1);
+    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_en_b, 1);
 
-  if (ret != 0)
-  {
-    return ret;
+    if (ret == 0)
+    {
+      if (emb_en_a.mlc_before_fsm_en == 0U && emb_en_b.mlc_en == 0U)
+      {
+        *val = ST1VAFE6AX_MLC_OFF;
+      }
+      else if (emb_en_a.mlc_before_fsm_en == 0U && emb_en_b.mlc_en == 1U)
+      {
+        *val = ST1VAFE6AX_MLC_ON;
+      }
+      else if (emb_en_a.mlc_before_fsm_en == 1U)
+      {
+        *val = ST1VAFE6AX_MLC_ON_BEFORE_FSM;
+      }
+      else
+      {
+        /* Do nothing */
+      }
+    }
   }
 
-  if ((conf_saved[0] & 0x0FU) == (uint8_t)ST1VAFE6AX_XL_ODR_OFF)
-  {
-    ret += st1vafe6ax_xl_data_rate_set(ctx, ST1VAFE6AX_XL_ODR_AT_120Hz);
-  }
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
 
-  /* disable algos */
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  return ret;
+}
 
+/**
+  * @brief  Machine Learning Core Output Data Rate (ODR) configuration.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      MLC_15Hz, MLC_30Hz, MLC_60Hz, MLC_120Hz, MLC_240Hz, MLC_480Hz, MLC_960Hz,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_mlc_data_rate_set(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_mlc_data_rate_t val)
+{
+  st1vafe6ax_mlc_odr_t mlc_odr = {0};
+  int32_t ret = {0};
+
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
   if (ret == 0)
   {
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, emb_func_en_saved,
-                               2);
-  }
-  if (ret == 0)
-  {
-    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, reg_zero, 2);
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_ODR, (uint8_t *)&mlc_odr, 1);
   }
+
   if (ret == 0)
   {
-    do
-    {
-      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EXEC_STATUS,
-                                 (uint8_t *)&emb_func_sts, 1);
-    } while (emb_func_sts.emb_func_endop != 1u);
+    mlc_odr.mlc_odr = (uint8_t)val & 0x07U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_MLC_ODR, (uint8_t *)&mlc_odr, 1);
   }
+
   ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
 
-  if (ret != 0)
-  {
-    return ret;
-  }
+  return ret;
+}
 
-  // enable gbias setting
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-  ctrl10.emb_func_debug = 1;
-  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
+/**
+  * @brief  Machine Learning Core Output Data Rate (ODR) configuration.[get]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      MLC_15Hz, MLC_30Hz, MLC_60Hz, MLC_120Hz, MLC_240Hz, MLC_480Hz, MLC_960Hz,
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_mlc_data_rate_get(const stmdev_ctx_t *ctx,
+                                     st1vafe6ax_mlc_data_rate_t *val)
+{
+  st1vafe6ax_mlc_odr_t mlc_odr = {0};
+  int32_t ret = {0};
 
-  /* enable algos */
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
   if (ret == 0)
   {
-    emb_func_en_saved[0] |= 0x02u; /* force SFLP GAME en */
-    ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, emb_func_en_saved,
-                                2);
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_ODR, (uint8_t *)&mlc_odr, 1);
   }
+
   ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
 
-  ret += st1vafe6ax_xl_full_scale_get(ctx, &xl_fs);
   if (ret != 0)
   {
     return ret;
   }
 
-  /* Read XL data */
-  do
-  {
-    ret += st1vafe6ax_flag_data_ready_get(ctx, &drdy);
-  } while (drdy.drdy_xl != 1u);
-  ret += st1vafe6ax_acceleration_raw_get(ctx, xl_data);
-  if (ret != 0)
+  switch (mlc_odr.mlc_odr)
   {
-    return ret;
-  }
+    case 0x00:
+      *val = ST1VAFE6AX_MLC_15Hz;
+      break;
 
-  /* force sflp initialization */
-  master_config = 0x40;
-  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &master_config,
-                              1);
-  if (ret != 0)
-  {
-    return ret;
-  }
+    case 0x01:
+      *val = ST1VAFE6AX_MLC_30Hz;
+      break;
 
-  for (i = 0; i < 3; i++)
-  {
-    j = 0;
-    data_tmp = (int32_t)xl_data[i];
-    data_tmp <<= (uint8_t)xl_fs; // shift based on current fs
-    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x02 + 3 * i), &data_ptr[j++], 1);
-    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x03 + 3 * i), &data_ptr[j++], 1);
-    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x04 + 3 * i), &data_ptr[j], 1);
-  }
-  for (i = 0; i < 3; i++)
-  {
-    j = 0;
-    data_tmp = 0;
-    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x0B + 3 * i), &data_ptr[j++], 1);
-    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x0C + 3 * i), &data_ptr[j++], 1);
-    ret += st1vafe6ax_write_reg(ctx, (uint8_t)(0x0D + 3 * i), &data_ptr[j], 1);
-  }
-  master_config = 0x00;
-  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, &master_config,
-                              1);
-  if (ret != 0)
-  {
-    return ret;
-  }
+    case 0x02:
+      *val = ST1VAFE6AX_MLC_60Hz;
+      break;
 
-  // wait end_op (and at least 30 us)
-  ctx->mdelay(1);
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    do
-    {
-      ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EXEC_STATUS,
-                                 (uint8_t *)&emb_func_sts, 1);
-    } while (emb_func_sts.emb_func_endop != 1u);
-  }
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+    case 0x03:
+      *val = ST1VAFE6AX_MLC_120Hz;
+      break;
 
-  /* write gbias in embedded advanced features registers */
-  ret += st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_SFLP_GAME_GBIASX_L,
-                                (uint8_t *)gbias_hf, 6);
-  if (ret != 0)
-  {
-    return ret;
-  }
+    case 0x04:
+      *val = ST1VAFE6AX_MLC_240Hz;
+      break;
 
-  /* reload previous sensor configuration */
-  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL1, conf_saved, 2);
-  if (ret != 0)
-  {
-    return ret;
-  }
+    case 0x05:
+      *val = ST1VAFE6AX_MLC_480Hz;
+      break;
 
-  // disable gbias setting
-  ctrl10.emb_func_debug = 0;
-  ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+    case 0x06:
+      *val = ST1VAFE6AX_MLC_960Hz;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_MLC_15Hz;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  SFLP initial configuration [set]
+  * @brief  Output value of all MLC decision trees.[get]
   *
   * @param  ctx      read / write interface definitions
+  * @param  val      Output value of all MLC decision trees.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_sflp_configure(const stmdev_ctx_t *ctx)
+int32_t st1vafe6ax_mlc_out_get(const stmdev_ctx_t *ctx, st1vafe6ax_mlc_out_t *val)
 {
-  uint8_t val = 0x50;
-  int32_t ret = 0;
+  int32_t ret = {0};
 
-  ret = st1vafe6ax_ln_pg_write(ctx, 0xD2, &val, 1);
+  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC1_SRC, (uint8_t *)val, 4);
+  }
 
+  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
   return ret;
 }
 
 /**
-  * @}
-  *
-  */
-
-/**
-  * @defgroup  Finite State Machine (FSM)
-  * @brief     This section groups all the functions that manage the
-  *            state_machine.
-  * @{
-  *
-  */
-
-/**
-  * @brief  Enables the control of the CTRL registers to FSM (FSM can change some configurations of the device autonomously).[set]
+  * @brief  Bio sensor sensitivity value register for the Machine Learning Core.
+  *         This register corresponds to the conversion value of the Bio sensor.
+  *         The register value is expressed as half-precision floating-point format:
+  *         SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent bits; F: 10 fraction bits).[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      PROTECT_CTRL_REGS, WRITE_CTRL_REG,
+  * @param  val      Bio sensor sensitivity value register for the Machine Learning Core.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_permission_set(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_fsm_permission_t val)
+int32_t st1vafe6ax_mlc_bio_sensitivity_set(const stmdev_ctx_t *ctx, uint16_t val)
 {
-  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+  uint8_t buff[2] = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
-  if (ret == 0)
-  {
-    func_cfg_access.fsm_wr_ctrl_en = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
-  }
+  buff[1] = (uint8_t)(val / 256U);
+  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_MLC_BIO_SENSITIVITY_L, (uint8_t *)&buff[0], 2);
 
   return ret;
 }
 
 /**
-  * @brief  Enables the control of the CTRL registers to FSM (FSM can change some configurations of the device autonomously).[get]
+  * @brief  Bio sensor sensitivity value register for the Machine Learning Core.
+  *         This register corresponds to the conversion value of the Bio sensor.
+  *         The register value is expressed as half-precision floating-point format:
+  *         SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent bits; F: 10 fraction bits).[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      PROTECT_CTRL_REGS, WRITE_CTRL_REG,
+  * @param  val      Bio sensor sensitivity value register for the Machine Learning Core.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_permission_get(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_fsm_permission_t *val)
+int32_t st1vafe6ax_mlc_bio_sensitivity_get(const stmdev_ctx_t *ctx, uint16_t *val)
 {
-  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+  uint8_t buff[2] = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FUNC_CFG_ACCESS, (uint8_t *)&func_cfg_access, 1);
+  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_MLC_BIO_SENSITIVITY_L, &buff[0], 2);
+
   if (ret != 0)
   {
     return ret;
   }
 
-  switch (func_cfg_access.fsm_wr_ctrl_en)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_PROTECT_CTRL_REGS;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_WRITE_CTRL_REG;
-      break;
+  *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
 
-    default:
-      *val = ST1VAFE6AX_PROTECT_CTRL_REGS;
-      break;
-  }
   return ret;
 }
 
 /**
-  * @brief  Return the status of the CTRL registers permission (standard interface vs FSM).[get]
+  * @}
+  *
+  */
+
+/**
+  * @addtogroup  Accelerometer user offset correction
+  * @brief   This section group all the functions concerning the
+  *          usage of Accelerometer user offset correction
+  * @{
+  *
+  */
+
+/**
+  * @brief  Enables accelerometer user offset correction block; it is valid for the low-pass path.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      0: all FSM regs are under std_if control, 1: some regs are under FSM control.
+  * @param  val      Enables accelerometer user offset correction block; it is valid for the low-pass path.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_permission_status(const stmdev_ctx_t *ctx,
-                                         st1vafe6ax_fsm_permission_status_t *val)
+int32_t st1vafe6ax_xl_offset_on_out_set(const stmdev_ctx_t *ctx, uint8_t val)
 {
-  st1vafe6ax_ctrl_status_t status = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL_STATUS, (uint8_t *)&status, 1);
-  if (ret != 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  if (ret == 0)
   {
-    return ret;
+    ctrl9.usr_off_on_out = val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   }
 
-  *val = (status.fsm_wr_ctrl_status == 0u) ? ST1VAFE6AX_STD_IF_CONTROL : ST1VAFE6AX_FSM_CONTROL;
-
   return ret;
 }
 
 /**
-  * @brief  Enable Finite State Machine (FSM) feature.[set]
+  * @brief  Enables accelerometer user offset correction block; it is valid for the low-pass path.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enable Finite State Machine (FSM) feature.
+  * @param  val      Enables accelerometer user offset correction block; it is valid for the low-pass path.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_mode_set(const stmdev_ctx_t *ctx, st1vafe6ax_fsm_mode_t val)
+int32_t st1vafe6ax_xl_offset_on_out_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_emb_func_en_b_t emb_func_en_b = {0};
-  st1vafe6ax_fsm_enable_t fsm_enable = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
-  }
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_ENABLE, (uint8_t *)&fsm_enable, 1);
-  }
-  if ((val.fsm1_en | val.fsm2_en | val.fsm1_en | val.fsm1_en
-       | val.fsm1_en | val.fsm2_en | val.fsm1_en | val.fsm1_en) == PROPERTY_ENABLE)
-  {
-    emb_func_en_b.fsm_en = PROPERTY_ENABLE;
-  }
-  else
-  {
-    emb_func_en_b.fsm_en = PROPERTY_DISABLE;
-  }
-  if (ret == 0)
-  {
-    fsm_enable.fsm1_en = val.fsm1_en;
-    fsm_enable.fsm2_en = val.fsm2_en;
-    fsm_enable.fsm3_en = val.fsm3_en;
-    fsm_enable.fsm4_en = val.fsm4_en;
-    fsm_enable.fsm5_en = val.fsm5_en;
-    fsm_enable.fsm6_en = val.fsm6_en;
-    fsm_enable.fsm7_en = val.fsm7_en;
-    fsm_enable.fsm8_en = val.fsm8_en;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FSM_ENABLE, (uint8_t *)&fsm_enable, 1);
-  }
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  if (ret != 0)
   {
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_func_en_b, 1);
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  *val = ctrl9.usr_off_on_out;
 
   return ret;
 }
 
 /**
-  * @brief  Enable Finite State Machine (FSM) feature.[get]
+  * @brief  Accelerometer user offset correction values in mg.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Enable Finite State Machine (FSM) feature.
+  * @param  val      Accelerometer user offset correction values in mg.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_mode_get(const stmdev_ctx_t *ctx, st1vafe6ax_fsm_mode_t *val)
+int32_t st1vafe6ax_xl_offset_mg_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_offset_mg_t val)
 {
-  st1vafe6ax_fsm_enable_t fsm_enable = {0};
+  st1vafe6ax_z_ofs_usr_t z_ofs_usr = {0};
+  st1vafe6ax_y_ofs_usr_t y_ofs_usr = {0};
+  st1vafe6ax_x_ofs_usr_t x_ofs_usr = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
+  float_t tmp = 0.0f;
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_Z_OFS_USR, (uint8_t *)&z_ofs_usr, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_Y_OFS_USR, (uint8_t *)&y_ofs_usr, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_X_OFS_USR, (uint8_t *)&x_ofs_usr, 1);
+
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_ENABLE, (uint8_t *)&fsm_enable, 1);
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  if ((val.x_mg < (0.0078125f * 127.0f)) && (val.x_mg > (0.0078125f * -127.0f)) &&
+      (val.y_mg < (0.0078125f * 127.0f)) && (val.y_mg > (0.0078125f * -127.0f)) &&
+      (val.z_mg < (0.0078125f * 127.0f)) && (val.z_mg > (0.0078125f * -127.0f)))
+  {
+    ctrl9.usr_off_w = 0;
+
+    tmp = val.z_mg / 0.0078125f;
+    z_ofs_usr.z_ofs_usr = (uint8_t)tmp;
+
+    tmp = val.y_mg / 0.0078125f;
+    y_ofs_usr.y_ofs_usr = (uint8_t)tmp;
+
+    tmp = val.x_mg / 0.0078125f;
+    x_ofs_usr.x_ofs_usr = (uint8_t)tmp;
+  }
+  else if ((val.x_mg < (0.125f * 127.0f)) && (val.x_mg > (0.125f * -127.0f)) &&
+           (val.y_mg < (0.125f * 127.0f)) && (val.y_mg > (0.125f * -127.0f)) &&
+           (val.z_mg < (0.125f * 127.0f)) && (val.z_mg > (0.125f * -127.0f)))
+  {
+    ctrl9.usr_off_w = 1;
+
+    tmp = val.z_mg / 0.125f;
+    z_ofs_usr.z_ofs_usr = (uint8_t)tmp;
+
+    tmp = val.y_mg / 0.125f;
+    y_ofs_usr.y_ofs_usr = (uint8_t)tmp;
+
+    tmp = val.x_mg / 0.125f;
+    x_ofs_usr.x_ofs_usr = (uint8_t)tmp;
+  }
+  else // out of limit
+  {
+    ctrl9.usr_off_w = 1;
+    z_ofs_usr.z_ofs_usr = 0xFFU;
+    y_ofs_usr.y_ofs_usr = 0xFFU;
+    x_ofs_usr.x_ofs_usr = 0xFFU;
+  }
 
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_Z_OFS_USR, (uint8_t *)&z_ofs_usr, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_Y_OFS_USR, (uint8_t *)&y_ofs_usr, 1);
+  if (ret != 0)
+  {
+    return ret;
+  }
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_X_OFS_USR, (uint8_t *)&x_ofs_usr, 1);
   if (ret != 0)
   {
     return ret;
   }
-
-  val->fsm1_en = fsm_enable.fsm1_en;
-  val->fsm2_en = fsm_enable.fsm2_en;
-  val->fsm3_en = fsm_enable.fsm3_en;
-  val->fsm4_en = fsm_enable.fsm4_en;
-  val->fsm5_en = fsm_enable.fsm5_en;
-  val->fsm6_en = fsm_enable.fsm6_en;
-  val->fsm7_en = fsm_enable.fsm7_en;
-  val->fsm8_en = fsm_enable.fsm8_en;
-
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
   return ret;
 }
 
 /**
-  * @brief  FSM long counter status register. Long counter value is an unsigned integer value (16-bit format).[set]
+  * @brief  Accelerometer user offset correction values in mg.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FSM long counter status register. Long counter value is an unsigned integer value (16-bit format).
+  * @param  val      Accelerometer user offset correction values in mg.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_long_cnt_set(const stmdev_ctx_t *ctx, uint16_t val)
+int32_t st1vafe6ax_xl_offset_mg_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_offset_mg_t *val)
 {
-  uint8_t buff[2] = {0};
+  st1vafe6ax_z_ofs_usr_t z_ofs_usr = {0};
+  st1vafe6ax_y_ofs_usr_t y_ofs_usr = {0};
+  st1vafe6ax_x_ofs_usr_t x_ofs_usr = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
   int32_t ret = {0};
 
-  buff[1] = (uint8_t)(val / 256U);
-  buff[0] = (uint8_t)(val - (buff[1] * 256U));
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_Z_OFS_USR, (uint8_t *)&z_ofs_usr, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_Y_OFS_USR, (uint8_t *)&y_ofs_usr, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_X_OFS_USR, (uint8_t *)&x_ofs_usr, 1);
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  if (ret != 0)
   {
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FSM_LONG_COUNTER_L, (uint8_t *)&buff[0], 2);
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  if (ctrl9.usr_off_w == PROPERTY_DISABLE)
+  {
+    val->z_mg = ((float_t)z_ofs_usr.z_ofs_usr * 0.0078125f);
+    val->y_mg = ((float_t)y_ofs_usr.y_ofs_usr * 0.0078125f);
+    val->x_mg = ((float_t)x_ofs_usr.x_ofs_usr * 0.0078125f);
+  }
+  else
+  {
+    val->z_mg = ((float_t)z_ofs_usr.z_ofs_usr * 0.125f);
+    val->y_mg = ((float_t)y_ofs_usr.y_ofs_usr * 0.125f);
+    val->x_mg = ((float_t)x_ofs_usr.x_ofs_usr * 0.125f);
+  }
 
   return ret;
 }
 
 /**
-  * @brief  FSM long counter status register. Long counter value is an unsigned integer value (16-bit format).[get]
+  * @brief  Accelerometer user offset correction values in ug, integer
+  *         version of st1vafe6ax_xl_offset_mg_set() (same weights).[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FSM long counter status register. Long counter value is an unsigned integer value (16-bit format).
+  * @param  val      Accelerometer user offset correction values in ug.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_long_cnt_get(const stmdev_ctx_t *ctx, uint16_t *val)
+int32_t st1vafe6ax_xl_offset_ug_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_offset_ug_t val)
 {
-  uint8_t buff[2] = {0};
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  int32_t ofs[3] = {val.z_ug, val.y_ug, val.x_ug};
+  uint8_t buff[3] = {0};
+  uint8_t i;
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_LONG_COUNTER_L, &buff[0], 2);
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  /* weights: 7.8125 ug (125 / 16) with usr_off_w = 0, 125 ug otherwise */
+  if ((ofs[0] < 993) && (ofs[0] > -993) && (ofs[1] < 993) && (ofs[1] > -993) &&
+      (ofs[2] < 993) && (ofs[2] > -993))
+  {
+    ctrl9.usr_off_w = 0;
+    for (i = 0U; i < 3U; i++)
+    {
+      buff[i] = (uint8_t)((ofs[i] * 16) / 125);
+    }
+  }
+  else if ((ofs[0] < 15875) && (ofs[0] > -15875) && (ofs[1] < 15875) &&
+           (ofs[1] > -15875) && (ofs[2] < 15875) && (ofs[2] > -15875))
+  {
+    ctrl9.usr_off_w = 1;
+    for (i = 0U; i < 3U; i++)
+    {
+      buff[i] = (uint8_t)(ofs[i] / 125);
+    }
+  }
+  else // out of limit
+  {
+    ctrl9.usr_off_w = 1;
+    buff[0] = 0xFFU;
+    buff[1] = 0xFFU;
+    buff[2] = 0xFFU;
+  }
 
+  /* Z_OFS_USR, Y_OFS_USR, X_OFS_USR are consecutive */
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_Z_OFS_USR, buff, 3);
   if (ret != 0)
   {
     return ret;
   }
-
-  *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
 
   return ret;
 }
 
 /**
-  * @brief  FSM output registers[get]
+  * @brief  Accelerometer user offset correction values in ug.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FSM output registers
+  * @param  val      Accelerometer user offset correction values in ug,
+  *                  rounded toward zero with usr_off_w = 0.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_out_get(const stmdev_ctx_t *ctx, st1vafe6ax_fsm_out_t *val)
+int32_t st1vafe6ax_xl_offset_ug_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_offset_ug_t *val)
 {
+  st1vafe6ax_ctrl9_t ctrl9 = {0};
+  uint8_t buff[3] = {0};
+  int32_t ofs[3];
+  uint8_t i;
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_Z_OFS_USR, buff, 3);
+
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_OUTS1, (uint8_t *)val, 8);
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  for (i = 0U; i < 3U; i++)
+  {
+    ofs[i] = (buff[i] < 0x80U) ? (int32_t)buff[i] : ((int32_t)buff[i] - 256);
+    ofs[i] = (ctrl9.usr_off_w == PROPERTY_DISABLE) ? ((ofs[i] * 125) / 16) : (ofs[i] * 125);
+  }
+
+  val->z_ug = ofs[0];
+  val->y_ug = ofs[1];
+  val->x_ug = ofs[2];
 
   return ret;
 }
 
 /**
-  * @brief  Finite State Machine Output Data Rate (ODR) configuration.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      FSM_15Hz, FSM_30Hz, FSM_60Hz, FSM_120Hz, FSM_240Hz, FSM_480Hz, FSM_960Hz,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @}
   *
   */
-int32_t st1vafe6ax_fsm_data_rate_set(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_fsm_data_rate_t val)
-{
-  st1vafe6ax_fsm_odr_t fsm_odr = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_ODR, (uint8_t *)&fsm_odr, 1);
-  }
-
-  if (ret == 0)
-  {
-    fsm_odr.fsm_odr = (uint8_t)val & 0x07U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_FSM_ODR, (uint8_t *)&fsm_odr, 1);
-  }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
-  return ret;
-}
+/**
+  * @addtogroup  AH_BIO
+  * @brief   This section group all the functions concerning the
+  *          usage of AH_BIO
+  * @{
+  *
+  */
 
 /**
-  * @brief  Finite State Machine Output Data Rate (ODR) configuration.[get]
+  * @brief  Enables AH_BIO chain. When this bit is set to ‘1’, the AH_BIO buffers are
+  *         connected to the AH1/Bio1 and AH1/Bio2 pins. Before setting this bit to 1,
+  *         the accelerometer and gyroscope sensor have to be configured in power-down mode.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FSM_15Hz, FSM_30Hz, FSM_60Hz, FSM_120Hz, FSM_240Hz, FSM_480Hz, FSM_960Hz,
+  * @param  val      1: Enables AH_BIO chain, 0: Disable the AH_BIO chain
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_data_rate_get(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_fsm_data_rate_t *val)
+int32_t st1vafe6ax_ah_bio_mode_set(const stmdev_ctx_t *ctx,
+                                   st1vafe6ax_ah_bio_mode_t val)
 {
-  st1vafe6ax_fsm_odr_t fsm_odr = {0};
+  st1vafe6ax_ctrl10_t ctrl10 = {0};
+  st1vafe6ax_ctrl7_t ctrl7 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_FSM_ODR, (uint8_t *)&fsm_odr, 1);
-  }
-
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
 
-  if (ret != 0)
+  if (ret == 0)
   {
-    return ret;
+    if ((val.ah_bio1_en | val.ah_bio2_en) == PROPERTY_ENABLE)
+    {
+      ctrl7.ah_bio_en = PROPERTY_ENABLE;
+    }
+    else
+    {
+      ctrl7.ah_bio_en = PROPERTY_DISABLE;
+    }
+    ctrl7.ah_bio1_en = val.ah_bio1_en;
+    ctrl7.ah_bio2_en = val.ah_bio2_en;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
   }
-
-  switch (fsm_odr.fsm_odr)
+  if (ret == 0)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_FSM_15Hz;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_FSM_30Hz;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_FSM_60Hz;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_FSM_120Hz;
-      break;
-
-    case 0x04:
-      *val = ST1VAFE6AX_FSM_240Hz;
-      break;
-
-    case 0x05:
-      *val = ST1VAFE6AX_FSM_480Hz;
-      break;
-
-    case 0x06:
-      *val = ST1VAFE6AX_FSM_960Hz;
-      break;
-
-    default:
-      *val = ST1VAFE6AX_FSM_15Hz;
-      break;
+    ctrl10.ah_bio_sw = val.swaps;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
   }
   return ret;
 }
 
 /**
-  * @brief  FSM long counter timeout. The long counter timeout value is an unsigned integer value (16-bit format). When the long counter value reached this value, the FSM generates an interrupt.[set]
+  * @brief  Enables AH_BIO chain. When this bit is set to ‘1’, the AH_BIO buffers are
+  *         connected to the AH1/Bio1 and AH1/Bio2 pins. Before setting this bit to 1,
+  *         the accelerometer and gyroscope sensor have to be configured in power-down mode.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FSM long counter timeout. The long counter timeout value is an unsigned integer value (16-bit format). When the long counter value reached this value, the FSM generates an interrupt.
+  * @param  val      1: Enables AH_BIO chain, 0: Disable the AH_BIO chain
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_long_cnt_timeout_set(const stmdev_ctx_t *ctx, uint16_t val)
+int32_t st1vafe6ax_ah_bio_mode_get(const stmdev_ctx_t *ctx,
+                                   st1vafe6ax_ah_bio_mode_t *val)
 {
-  uint8_t buff[2] = {0};
+  st1vafe6ax_ctrl10_t ctrl10 = {0};
+  st1vafe6ax_ctrl7_t ctrl7 = {0};
   int32_t ret = {0};
 
-  buff[1] = (uint8_t)(val / 256U);
-  buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_FSM_LC_TIMEOUT_L, (uint8_t *)&buff[0], 2);
-
-  return ret;
-}
-
-/**
-  * @brief  FSM long counter timeout. The long counter timeout value is an unsigned integer value (16-bit format). When the long counter value reached this value, the FSM generates an interrupt.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      FSM long counter timeout. The long counter timeout value is an unsigned integer value (16-bit format). When the long counter value reached this value, the FSM generates an interrupt.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_fsm_long_cnt_timeout_get(const stmdev_ctx_t *ctx, uint16_t *val)
-{
-  uint8_t buff[2] = {0};
-  int32_t ret = {0};
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
 
-  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_LC_TIMEOUT_L, &buff[0], 2);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  val->ah_bio1_en = ctrl7.ah_bio1_en;
+  val->ah_bio2_en = ctrl7.ah_bio2_en;
+  val->swaps = ctrl10.ah_bio_sw;
 
   return ret;
 }
 
 /**
-  * @brief  FSM number of programs.[set]
+  * @brief  Configures the equivalent input impedance of the AH_BIO buffers.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FSM number of programs.
+  * @param  val      2400MOhm, 730MOhm, 300MOhm, 235MOhm,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_number_of_programs_set(const stmdev_ctx_t *ctx, uint8_t val)
+int32_t st1vafe6ax_ah_bio_zin_set(const stmdev_ctx_t *ctx,
+                                  st1vafe6ax_ah_bio_zin_t val)
 {
-  st1vafe6ax_fsm_programs_t fsm_programs = {0};
+  st1vafe6ax_ctrl7_t ctrl7 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_PROGRAMS, (uint8_t *)&fsm_programs, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
   if (ret == 0)
   {
-    fsm_programs.fsm_n_prog = val;
-    ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_FSM_PROGRAMS, (uint8_t *)&fsm_programs, 1);
+    ctrl7.ah_bio_c_zin = (uint8_t)val & 0x03U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
   }
 
   return ret;
 }
 
 /**
-  * @brief  FSM number of programs.[get]
+  * @brief  Configures the equivalent input impedance of the AH_BIO buffers.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FSM number of programs.
+  * @param  val      2400MOhm, 730MOhm, 300MOhm, 235MOhm,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_number_of_programs_get(const stmdev_ctx_t *ctx, uint8_t *val)
+int32_t st1vafe6ax_ah_bio_zin_get(const stmdev_ctx_t *ctx,
+                                  st1vafe6ax_ah_bio_zin_t *val)
 {
-  st1vafe6ax_fsm_programs_t fsm_programs = {0};
+  st1vafe6ax_ctrl7_t ctrl7 = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_PROGRAMS, (uint8_t *)&fsm_programs, 1);
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = fsm_programs.fsm_n_prog;
+  switch (ctrl7.ah_bio_c_zin)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_2400MOhm;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_730MOhm;
+      break;
+
+    case 0x02:
+      *val = ST1VAFE6AX_300MOhm;
+      break;
 
+    case 0x03:
+      *val = ST1VAFE6AX_235MOhm;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_2400MOhm;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  FSM start address. First available address is 0x35C.[set]
+  * @brief  Bio sensor sensitivity value register for the Finite State Machine.
+  *         This register corresponds to the conversion value of the Bio sensor.
+  *         The register value is expressed as half-precision floating-point format:
+  *         SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent bits; F: 10 fraction bits).[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FSM start address. First available address is 0x35C.
+  * @param  val      Bio sensor sensitivity value register for the Finite State Machine.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_start_address_set(const stmdev_ctx_t *ctx, uint16_t val)
+int32_t st1vafe6ax_fsm_bio_sensitivity_set(const stmdev_ctx_t *ctx, uint16_t val)
 {
   uint8_t buff[2] = {0};
   int32_t ret = {0};
 
   buff[1] = (uint8_t)(val / 256U);
   buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_FSM_START_ADD_L, (uint8_t *)&buff[0], 2);
+  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_FSM_BIO_SENSITIVITY_L, (uint8_t *)&buff[0], 2);
 
   return ret;
 }
 
 /**
-  * @brief  FSM start address. First available address is 0x35C.[get]
+  * @brief  Bio sensor sensitivity value register for the Finite State Machine.
+  *         This register corresponds to the conversion value of the Bio sensor.
+  *         The register value is expressed as half-precision floating-point format:
+  *         SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent bits; F: 10 fraction bits).[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      FSM start address. First available address is 0x35C.
+  * @param  val      Bio sensor sensitivity value register for the Finite State Machine.
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_fsm_start_address_get(const stmdev_ctx_t *ctx, uint16_t *val)
+int32_t st1vafe6ax_fsm_bio_sensitivity_get(const stmdev_ctx_t *ctx, uint16_t *val)
 {
   uint8_t buff[2] = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_START_ADD_L, &buff[0], 2);
+  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_BIO_SENSITIVITY_L, &buff[0], 2);
   if (ret != 0)
   {
     return ret;
@@ -7769,277 +12294,368 @@ int32_t st1vafe6ax_fsm_start_address_get(const stmdev_ctx_t *ctx, uint16_t *val)
   */
 
 /**
-  * @addtogroup  Machine Learning Core
+  * @addtogroup  SenseWire (I3C)
   * @brief   This section group all the functions concerning the
-  *          usage of Machine Learning Core
+  *          usage of SenseWire (I3C)
   * @{
   *
   */
 
 /**
-  * @brief  It enables Machine Learning Core feature (MLC). When the Machine Learning Core is enabled the Finite State Machine (FSM) programs are executed before executing the MLC algorithms.[set]
+  * @brief  Selects the action the device will perform after "Reset whole chip" I3C pattern.[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      MLC_OFF, MLC_ON, MLC_BEFORE_FSM,
+  * @param  val      SW_RST_DYN_ADDRESS_RST, GLOBAL_RST_,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_mlc_set(const stmdev_ctx_t *ctx, st1vafe6ax_mlc_mode_t val)
+int32_t st1vafe6ax_i3c_reset_mode_set(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_i3c_reset_mode_t val)
 {
-  st1vafe6ax_emb_func_en_b_t emb_en_b = {0};
-  st1vafe6ax_emb_func_en_a_t emb_en_a = {0};
+  st1vafe6ax_pin_ctrl_t pin_ctrl = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
   if (ret == 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_en_a, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_en_b, 1);
-
-    if (ret == 0)
-    {
-      switch (val)
-      {
-        case ST1VAFE6AX_MLC_OFF:
-          emb_en_a.mlc_before_fsm_en = 0;
-          emb_en_b.mlc_en = 0;
-          break;
-        case ST1VAFE6AX_MLC_ON:
-          emb_en_a.mlc_before_fsm_en = 0;
-          emb_en_b.mlc_en = 1;
-          break;
-        case ST1VAFE6AX_MLC_ON_BEFORE_FSM:
-          emb_en_a.mlc_before_fsm_en = 1;
-          emb_en_b.mlc_en = 0;
-          break;
-        default:
-          emb_en_a.mlc_before_fsm_en = 0;
-          emb_en_b.mlc_en = 0;
-          break;
-      }
-
-      ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_en_a, 1);
-      ret += st1vafe6ax_write_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_en_b, 1);
-    }
+    pin_ctrl.ibhr_por_en = (uint8_t)val & 0x01U;
+    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
   return ret;
 }
 
 /**
-  * @brief  It enables Machine Learning Core feature (MLC). When the Machine Learning Core is enabled the Finite State Machine (FSM) programs are executed before executing the MLC algorithms.[get]
+  * @brief  Selects the action the device will perform after "Reset whole chip" I3C pattern.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      MLC_OFF, MLC_ON, MLC_BEFORE_FSM,
+  * @param  val      SW_RST_DYN_ADDRESS_RST, GLOBAL_RST_,
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_mlc_get(const stmdev_ctx_t *ctx, st1vafe6ax_mlc_mode_t *val)
+int32_t st1vafe6ax_i3c_reset_mode_get(const stmdev_ctx_t *ctx,
+                                      st1vafe6ax_i3c_reset_mode_t *val)
 {
-  st1vafe6ax_emb_func_en_b_t emb_en_b = {0};
-  st1vafe6ax_emb_func_en_a_t emb_en_a = {0};
+  st1vafe6ax_pin_ctrl_t pin_ctrl = {0};
   int32_t ret = {0};
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-
-  if (ret == 0)
+  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
+  if (ret != 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_A, (uint8_t *)&emb_en_a, 1);
-    ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_EMB_FUNC_EN_B, (uint8_t *)&emb_en_b, 1);
-
-    if (ret == 0)
-    {
-      if (emb_en_a.mlc_before_fsm_en == 0U && emb_en_b.mlc_en == 0U)
-      {
-        *val = ST1VAFE6AX_MLC_OFF;
-      }
-      else if (emb_en_a.mlc_before_fsm_en == 0U && emb_en_b.mlc_en == 1U)
-      {
-        *val = ST1VAFE6AX_MLC_ON;
-      }
-      else if (emb_en_a.mlc_before_fsm_en == 1U)
-      {
-        *val = ST1VAFE6AX_MLC_ON_BEFORE_FSM;
-      }
-      else
-      {
-        /* Do nothing */
-      }
-    }
+    return ret;
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  switch (pin_ctrl.ibhr_por_en)
+  {
+    case 0x00:
+      *val = ST1VAFE6AX_SW_RST_DYN_ADDRESS_RST;
+      break;
+
+    case 0x01:
+      *val = ST1VAFE6AX_I3C_GLOBAL_RST;
+      break;
 
+    default:
+      *val = ST1VAFE6AX_SW_RST_DYN_ADDRESS_RST;
+      break;
+  }
   return ret;
 }
 
 /**
-  * @brief  Machine Learning Core Output Data Rate (ODR) configuration.[set]
+  * @}
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      MLC_15Hz, MLC_30Hz, MLC_60Hz, MLC_120Hz, MLC_240Hz, MLC_480Hz, MLC_960Hz,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  */
+
+/**
+  * @defgroup  Interrupt dispatcher
+  * @brief     Call the handlers registered per ST1VAFE6AX_EVENT_* when an
+  *            interrupt pin fires, reading only the source registers of
+  *            the events routed on that pin.
+  * @{
   *
   */
-int32_t st1vafe6ax_mlc_data_rate_set(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_mlc_data_rate_t val)
+
+#define DISPATCH_FIFO   (ST1VAFE6AX_EVENT_FIFO_TH | ST1VAFE6AX_EVENT_FIFO_OVR | \
+                         ST1VAFE6AX_EVENT_FIFO_FULL | ST1VAFE6AX_EVENT_FIFO_BDR)
+#define DISPATCH_DRDY   (ST1VAFE6AX_EVENT_DRDY_XL | ST1VAFE6AX_EVENT_DRDY_GY | \
+                         ST1VAFE6AX_EVENT_DRDY_TEMP | ST1VAFE6AX_EVENT_DRDY_AH_BIO | \
+                         ST1VAFE6AX_EVENT_TIMESTAMP)
+#define DISPATCH_WU     (ST1VAFE6AX_EVENT_WAKE_UP | ST1VAFE6AX_EVENT_FREE_FALL | \
+                         ST1VAFE6AX_EVENT_SLEEP_CHANGE | ST1VAFE6AX_EVENT_SLEEP_STATE)
+#define DISPATCH_TAP    (ST1VAFE6AX_EVENT_SINGLE_TAP | ST1VAFE6AX_EVENT_DOUBLE_TAP)
+#define DISPATCH_EMB    (ST1VAFE6AX_EVENT_STEP_DET | ST1VAFE6AX_EVENT_TILT | \
+                         ST1VAFE6AX_EVENT_SIG_MOT | ST1VAFE6AX_EVENT_FSM_LC)
+#define DISPATCH_FSM    0x00FF0000UL
+#define DISPATCH_MLC    0x0F000000UL
+
+/*
+ * dispatch: events flagged in the FIFO_STATUS1 ... STATUS_REG (status) and
+ * WAKE_UP_SRC ... MLC_STATUS_MAINPAGE (src) windows.
+ */
+static uint64_t dispatch_decode(const uint8_t *status, const uint8_t *src)
 {
-  st1vafe6ax_mlc_odr_t mlc_odr = {0};
-  int32_t ret = {0};
+  st1vafe6ax_emb_func_status_mainpage_t emb_func_status_mainpage;
+  st1vafe6ax_fifo_status2_t fifo_status2;
+  st1vafe6ax_wake_up_src_t wake_up_src;
+  st1vafe6ax_status_reg_t status_reg;
+  st1vafe6ax_tap_src_t tap_src;
+  st1vafe6ax_d6d_src_t d6d_src;
+  uint64_t ev = 0U;
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
-  {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_ODR, (uint8_t *)&mlc_odr, 1);
-  }
+  bytecpy((uint8_t *)&fifo_status2, &status[1]);
+  bytecpy((uint8_t *)&status_reg, &status[3]);
+  bytecpy((uint8_t *)&wake_up_src, &src[0]);
+  bytecpy((uint8_t *)&tap_src, &src[1]);
+  bytecpy((uint8_t *)&d6d_src, &src[2]);
+  bytecpy((uint8_t *)&emb_func_status_mainpage, &src[4]);
 
-  if (ret == 0)
-  {
-    mlc_odr.mlc_odr = (uint8_t)val & 0x07U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_MLC_ODR, (uint8_t *)&mlc_odr, 1);
-  }
+  ev |= (status_reg.xlda != 0U) ? ST1VAFE6AX_EVENT_DRDY_XL : 0U;
+  ev |= (status_reg.gda != 0U) ? ST1VAFE6AX_EVENT_DRDY_GY : 0U;
+  ev |= (status_reg.tda != 0U) ? ST1VAFE6AX_EVENT_DRDY_TEMP : 0U;
+  ev |= (status_reg.ah_bioda != 0U) ? ST1VAFE6AX_EVENT_DRDY_AH_BIO : 0U;
+  ev |= (status_reg.timestamp_endcount != 0U) ? ST1VAFE6AX_EVENT_TIMESTAMP : 0U;
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+  ev |= (fifo_status2.fifo_wtm_ia != 0U) ? ST1VAFE6AX_EVENT_FIFO_TH : 0U;
+  ev |= (fifo_status2.fifo_ovr_ia != 0U) ? ST1VAFE6AX_EVENT_FIFO_OVR : 0U;
+  ev |= (fifo_status2.fifo_full_ia != 0U) ? ST1VAFE6AX_EVENT_FIFO_FULL : 0U;
+  ev |= (fifo_status2.counter_bdr_ia != 0U) ? ST1VAFE6AX_EVENT_FIFO_BDR : 0U;
 
-  return ret;
+  ev |= (wake_up_src.wu_ia != 0U) ? ST1VAFE6AX_EVENT_WAKE_UP : 0U;
+  ev |= (wake_up_src.ff_ia != 0U) ? ST1VAFE6AX_EVENT_FREE_FALL : 0U;
+  ev |= (wake_up_src.sleep_change_ia != 0U) ? ST1VAFE6AX_EVENT_SLEEP_CHANGE : 0U;
+  ev |= (wake_up_src.sleep_state != 0U) ? ST1VAFE6AX_EVENT_SLEEP_STATE : 0U;
+  ev |= (tap_src.single_tap != 0U) ? ST1VAFE6AX_EVENT_SINGLE_TAP : 0U;
+  ev |= (tap_src.double_tap != 0U) ? ST1VAFE6AX_EVENT_DOUBLE_TAP : 0U;
+  ev |= (d6d_src.d6d_ia != 0U) ? ST1VAFE6AX_EVENT_SIX_D : 0U;
+
+  ev |= (emb_func_status_mainpage.is_step_det != 0U) ? ST1VAFE6AX_EVENT_STEP_DET : 0U;
+  ev |= (emb_func_status_mainpage.is_tilt != 0U) ? ST1VAFE6AX_EVENT_TILT : 0U;
+  ev |= (emb_func_status_mainpage.is_sigmot != 0U) ? ST1VAFE6AX_EVENT_SIG_MOT : 0U;
+  ev |= (emb_func_status_mainpage.is_fsm_lc != 0U) ? ST1VAFE6AX_EVENT_FSM_LC : 0U;
+
+  /* FSM_STATUS_MAINPAGE, MLC_STATUS_MAINPAGE: one bit per program */
+  ev |= (uint64_t)src[5] << 16;
+  ev |= ((uint64_t)src[6] & 0x0FU) << 24;
+
+  return ev;
 }
 
-/**
-  * @brief  Machine Learning Core Output Data Rate (ODR) configuration.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      MLC_15Hz, MLC_30Hz, MLC_60Hz, MLC_120Hz, MLC_240Hz, MLC_480Hz, MLC_960Hz,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_mlc_data_rate_get(const stmdev_ctx_t *ctx,
-                                     st1vafe6ax_mlc_data_rate_t *val)
+/* dispatch: payload of a single event, out holds FSM_OUTS1..8, MLC1..4_SRC */
+static uint16_t dispatch_payload(uint64_t event, const uint8_t *status,
+                                 const uint8_t *src, const uint8_t *out)
 {
-  st1vafe6ax_mlc_odr_t mlc_odr = {0};
-  int32_t ret = {0};
+  uint16_t payload = 0U;
+  uint8_t i;
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
-  if (ret == 0)
+  if ((event & DISPATCH_FSM) != 0U)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC_ODR, (uint8_t *)&mlc_odr, 1);
+    for (i = 0U; (event >> (16U + i)) != 1U; i++) {}
+    payload = out[i];
   }
-
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
-
-  if (ret != 0)
+  else if ((event & DISPATCH_MLC) != 0U)
   {
-    return ret;
+    for (i = 0U; (event >> (24U + i)) != 1U; i++) {}
+    payload = out[8U + i];
   }
-
-  switch (mlc_odr.mlc_odr)
+  else if ((event & DISPATCH_FIFO) != 0U)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_MLC_15Hz;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_MLC_30Hz;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_MLC_60Hz;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_MLC_120Hz;
-      break;
-
-    case 0x04:
-      *val = ST1VAFE6AX_MLC_240Hz;
-      break;
-
-    case 0x05:
-      *val = ST1VAFE6AX_MLC_480Hz;
-      break;
+    payload = (uint16_t)status[0] | (((uint16_t)status[1] & 0x01U) << 8);
+  }
+  else if ((event & DISPATCH_DRDY) != 0U)
+  {
+    payload = status[3];
+  }
+  else if ((event & DISPATCH_WU) != 0U)
+  {
+    payload = src[0];
+  }
+  else if ((event & DISPATCH_TAP) != 0U)
+  {
+    payload = src[1];
+  }
+  else if ((event & ST1VAFE6AX_EVENT_SIX_D) != 0U)
+  {
+    payload = src[2];
+  }
+  else if ((event & DISPATCH_EMB) != 0U)
+  {
+    payload = src[4];
+  }
+  else
+  {
+    payload = 0U;
+  }
 
-    case 0x06:
-      *val = ST1VAFE6AX_MLC_960Hz;
-      break;
+  return payload;
+}
 
-    default:
-      *val = ST1VAFE6AX_MLC_15Hz;
-      break;
-  }
-  return ret;
+/**
+  * @brief  Initialize the interrupt dispatcher: no handlers registered,
+  *         routing of int1 and int2 pins read from the device.[set]
+  *
+  * @param  ctx      read / write interface definitions
+  * @param  val      dispatcher to initialize
+  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_dispatch_init(const stmdev_ctx_t *ctx, st1vafe6ax_dispatch_t *val)
+{
+  (void)memset(val, 0, sizeof(st1vafe6ax_dispatch_t));
+
+  return st1vafe6ax_dispatch_route_update(ctx, val);
 }
 
 /**
-  * @brief  Output value of all MLC decision trees.[get]
+  * @brief  Read again the routing of int1 and int2 pins, to be called when
+  *         it is changed after st1vafe6ax_dispatch_init().[set]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Output value of all MLC decision trees.
+  * @param  val      dispatcher to update
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_mlc_out_get(const stmdev_ctx_t *ctx, st1vafe6ax_mlc_out_t *val)
+int32_t st1vafe6ax_dispatch_route_update(const stmdev_ctx_t *ctx,
+                                         st1vafe6ax_dispatch_t *val)
 {
-  int32_t ret = {0};
+  int32_t ret;
 
-  ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+  ret = st1vafe6ax_pin_int1_route_mask_get(ctx, &val->route[0]);
   if (ret == 0)
   {
-    ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_MLC1_SRC, (uint8_t *)val, 4);
+    ret = st1vafe6ax_pin_int2_route_mask_get(ctx, &val->route[1]);
   }
 
-  ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
   return ret;
 }
 
 /**
-  * @brief  Bio sensor sensitivity value register for the Machine Learning Core.
-  *         This register corresponds to the conversion value of the Bio sensor.
-  *         The register value is expressed as half-precision floating-point format:
-  *         SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent bits; F: 10 fraction bits).[set]
+  * @brief  Register a handler, called once per pending event of events
+  *         with the event payload.[set]
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Bio sensor sensitivity value register for the Machine Learning Core.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  val      dispatcher
+  * @param  events   bitmask of ST1VAFE6AX_EVENT_* handled
+  * @param  cb       handler
+  * @param  user     passed back to the handler
+  * @retval          0 -> ok, -1 -> ST1VAFE6AX_DISPATCH_MAX handlers already set
   *
   */
-int32_t st1vafe6ax_mlc_bio_sensitivity_set(const stmdev_ctx_t *ctx, uint16_t val)
+int32_t st1vafe6ax_dispatch_handler_set(st1vafe6ax_dispatch_t *val, uint64_t events,
+                                        st1vafe6ax_event_cb_t cb, void *user)
 {
-  uint8_t buff[2] = {0};
-  int32_t ret = {0};
+  if (val->num >= ST1VAFE6AX_DISPATCH_MAX)
+  {
+    return -1;
+  }
 
-  buff[1] = (uint8_t)(val / 256U);
-  buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_MLC_BIO_SENSITIVITY_L, (uint8_t *)&buff[0], 2);
+  val->handler[val->num].events = events;
+  val->handler[val->num].cb = cb;
+  val->handler[val->num].user = user;
+  val->num++;
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Bio sensor sensitivity value register for the Machine Learning Core.
-  *         This register corresponds to the conversion value of the Bio sensor.
-  *         The register value is expressed as half-precision floating-point format:
-  *         SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent bits; F: 10 fraction bits).[get]
+  * @brief  Serve an interrupt: the source registers of the events routed
+  *         on the pin and handled are read (embedded bank only for the
+  *         FSM outputs / MLC sources of pending events), then the handlers
+  *         are called. The main bank must be selected.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Bio sensor sensitivity value register for the Machine Learning Core.
+  * @param  val      dispatcher
+  * @param  pin      1 -> int1, 2 -> int2, 0 -> all handled events (polling)
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_mlc_bio_sensitivity_get(const stmdev_ctx_t *ctx, uint16_t *val)
+int32_t st1vafe6ax_dispatch_run(const stmdev_ctx_t *ctx,
+                                const st1vafe6ax_dispatch_t *val, uint8_t pin)
 {
-  uint8_t buff[2] = {0};
-  int32_t ret = {0};
+  uint8_t status[4] = {0};
+  uint8_t src[7] = {0};
+  uint8_t out[12] = {0};
+  uint8_t req_status = 0U;
+  uint8_t req_src = 0U;
+  uint64_t handled = 0U;
+  uint64_t pending;
+  uint64_t event;
+  uint8_t fsm_req;
+  uint8_t mlc_req;
+  uint8_t i;
+  int32_t ret = 0;
 
-  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_MLC_BIO_SENSITIVITY_L, &buff[0], 2);
+  if (pin > 2U)
+  {
+    return -1;
+  }
+
+  for (i = 0U; i < val->num; i++)
+  {
+    handled |= val->handler[i].events;
+  }
+  if (pin != 0U)
+  {
+    handled &= val->route[pin - 1U];
+  }
+
+  /* FIFO_STATUS1, FIFO_STATUS2, -, STATUS_REG */
+  req_status |= ((handled & DISPATCH_FIFO) != 0U) ? 0x03U : 0x00U;
+  req_status |= ((handled & DISPATCH_DRDY) != 0U) ? 0x08U : 0x00U;
+
+  /* WAKE_UP_SRC, TAP_SRC, D6D_SRC, -, EMB_FUNC/FSM/MLC_STATUS_MAINPAGE */
+  req_src |= ((handled & DISPATCH_WU) != 0U) ? 0x01U : 0x00U;
+  req_src |= ((handled & DISPATCH_TAP) != 0U) ? 0x02U : 0x00U;
+  req_src |= ((handled & ST1VAFE6AX_EVENT_SIX_D) != 0U) ? 0x04U : 0x00U;
+  req_src |= ((handled & DISPATCH_EMB) != 0U) ? 0x10U : 0x00U;
+  req_src |= ((handled & DISPATCH_FSM) != 0U) ? 0x20U : 0x00U;
+  req_src |= ((handled & DISPATCH_MLC) != 0U) ? 0x40U : 0x00U;
 
+  ret = all_sources_read_runs(ctx, ST1VAFE6AX_FIFO_STATUS1, req_status, 0x00U, status, 4);
+  if (ret == 0)
+  {
+    ret = all_sources_read_runs(ctx, ST1VAFE6AX_WAKE_UP_SRC, req_src, 0x08U, src, 7);
+  }
   if (ret != 0)
   {
     return ret;
   }
 
-  *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  pending = dispatch_decode(status, src) & handled;
+
+  /* FSM_OUTSx / MLCx_SRC of the pending programs, with one bank switch */
+  fsm_req = (uint8_t)((pending & DISPATCH_FSM) >> 16);
+  mlc_req = (uint8_t)((pending & DISPATCH_MLC) >> 24);
+
+  if ((fsm_req | mlc_req) != 0U)
+  {
+    ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+    if (ret == 0)
+    {
+      ret = all_sources_read_runs(ctx, ST1VAFE6AX_FSM_OUTS1, fsm_req, 0xFFU, &out[0], 8);
+    }
+    if (ret == 0)
+    {
+      ret = all_sources_read_runs(ctx, ST1VAFE6AX_MLC1_SRC, mlc_req, 0x0FU, &out[8], 4);
+    }
+    ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+
+    if (ret != 0)
+    {
+      return ret;
+    }
+  }
+
+  for (i = 0U; i < val->num; i++)
+  {
+    for (event = 1U; event != 0U; event <<= 1)
+    {
+      if ((pending & val->handler[i].events & event) != 0U)
+      {
+        val->handler[i].cb(ctx, event, dispatch_payload(event, status, src, out),
+                           val->handler[i].user);
+      }
+    }
+  }
 
   return ret;
 }
@@ -8050,466 +12666,495 @@ int32_t st1vafe6ax_mlc_bio_sensitivity_get(const stmdev_ctx_t *ctx, uint16_t *va
   */
 
 /**
-  * @addtogroup  Accelerometer user offset correction
-  * @brief   This section group all the functions concerning the
-  *          usage of Accelerometer user offset correction
+  * @defgroup  Asynchronous interface
+  * @brief     Non blocking versions of the most used APIs, based on the
+  *            optional transport set with st1vafe6ax_async_transport_set().
+  *            One operation at a time can be in progress on a device, and
+  *            the blocking APIs must not be used on it until the operation
+  *            callback is called. Not allowed inside a memory bank session.
   * @{
   *
   */
 
-/**
-  * @brief  Enables accelerometer user offset correction block; it is valid for the low-pass path.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Enables accelerometer user offset correction block; it is valid for the low-pass path.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_xl_offset_on_out_set(const stmdev_ctx_t *ctx, uint8_t val)
+#define ASYNC_OP_FIFO_STATUS                     0x1U
+#define ASYNC_OP_FIFO_BURST                      0x2U
+#define ASYNC_OP_GY_RAW                          0x3U
+#define ASYNC_OP_XL_RAW                          0x4U
+#define ASYNC_OP_ALL_SOURCES                     0x5U
+
+/* Prepare a read: registers kept in the shadow do not need a transfer */
+static void async_read(st1vafe6ax_priv_t *priv, uint8_t reg, uint8_t *buf,
+                       uint16_t len)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_async_t *as = &priv->async;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
-  if (ret == 0)
+  if (shadow_lookup(priv, reg, buf, len) == 1U)
   {
-    ctrl9.usr_off_on_out = val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
+    return;
   }
 
-  return ret;
+  as->xfer.dir = ST1VAFE6AX_XFER_READ;
+  as->xfer.reg = reg;
+  as->xfer.buf = buf;
+  as->xfer.len = len;
+  as->pending = 1U;
 }
 
-/**
-  * @brief  Enables accelerometer user offset correction block; it is valid for the low-pass path.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Enables accelerometer user offset correction block; it is valid for the low-pass path.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_xl_offset_on_out_get(const stmdev_ctx_t *ctx, uint8_t *val)
+static void async_write(st1vafe6ax_priv_t *priv, uint8_t reg, uint8_t *buf,
+                        uint16_t len)
 {
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_async_t *as = &priv->async;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
-  if (ret != 0)
+  as->xfer.dir = ST1VAFE6AX_XFER_WRITE;
+  as->xfer.reg = reg;
+  as->xfer.buf = buf;
+  as->xfer.len = len;
+  as->pending = 1U;
+}
+
+/* Select the memory bank, no transfer if already selected */
+static void async_bank(st1vafe6ax_priv_t *priv, st1vafe6ax_mem_bank_t val)
+{
+  st1vafe6ax_async_t *as = &priv->async;
+  st1vafe6ax_func_cfg_access_t func_cfg_access = {0};
+
+  bytecpy((uint8_t *)&func_cfg_access, &as->save[1]);
+  if (func_cfg_access.emb_func_reg_access == ((uint8_t)val & 0x01U))
   {
-    return ret;
+    return;
   }
 
-  *val = ctrl9.usr_off_on_out;
-
-  return ret;
+  func_cfg_access.emb_func_reg_access = (uint8_t)val & 0x01U;
+  bytecpy(&as->save[1], (uint8_t *)&func_cfg_access);
+  async_write(priv, ST1VAFE6AX_FUNC_CFG_ACCESS, &as->save[1], 1);
 }
 
-/**
-  * @brief  Accelerometer user offset correction values in mg.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Accelerometer user offset correction values in mg.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_xl_offset_mg_set(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_xl_offset_mg_t val)
+/* st1vafe6ax_all_sources_get(), one transfer per step */
+static uint8_t async_all_sources_step(st1vafe6ax_priv_t *priv)
 {
-  st1vafe6ax_z_ofs_usr_t z_ofs_usr = {0};
-  st1vafe6ax_y_ofs_usr_t y_ofs_usr = {0};
-  st1vafe6ax_x_ofs_usr_t x_ofs_usr = {0};
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
-  int32_t ret = {0};
-  float_t tmp = 0.0f;
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_Z_OFS_USR, (uint8_t *)&z_ofs_usr, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_Y_OFS_USR, (uint8_t *)&y_ofs_usr, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_X_OFS_USR, (uint8_t *)&x_ofs_usr, 1);
+  st1vafe6ax_async_t *as = &priv->async;
+  st1vafe6ax_all_sources_t *val = (st1vafe6ax_all_sources_t *)as->out;
+  st1vafe6ax_functions_enable_t functions_enable = {0};
+  uint8_t done = 0U;
 
-  if (ret != 0)
+  switch (as->step)
   {
-    return ret;
-  }
+    case 0:
+      async_read(priv, ST1VAFE6AX_FUNCTIONS_ENABLE, &as->save[0], 1);
+      break;
 
-  if ((val.x_mg < (0.0078125f * 127.0f)) && (val.x_mg > (0.0078125f * -127.0f)) &&
-      (val.y_mg < (0.0078125f * 127.0f)) && (val.y_mg > (0.0078125f * -127.0f)) &&
-      (val.z_mg < (0.0078125f * 127.0f)) && (val.z_mg > (0.0078125f * -127.0f)))
-  {
-    ctrl9.usr_off_w = 0;
+    case 1:
+      bytecpy((uint8_t *)&functions_enable, &as->save[0]);
+      functions_enable.dis_rst_lir_all_int = PROPERTY_ENABLE;
+      bytecpy(&as->buff[0], (uint8_t *)&functions_enable);
+      async_write(priv, ST1VAFE6AX_FUNCTIONS_ENABLE, &as->buff[0], 1);
+      break;
 
-    tmp = val.z_mg / 0.0078125f;
-    z_ofs_usr.z_ofs_usr = (uint8_t)tmp;
+    case 2:
+      async_read(priv, ST1VAFE6AX_FIFO_STATUS1, &as->buff[0], 4);
+      break;
 
-    tmp = val.y_mg / 0.0078125f;
-    y_ofs_usr.y_ofs_usr = (uint8_t)tmp;
+    case 3:
+      all_sources_status_decode(as->buff, val);
+      bytecpy((uint8_t *)&functions_enable, &as->save[0]);
+      functions_enable.dis_rst_lir_all_int = PROPERTY_DISABLE;
+      bytecpy(&as->buff[0], (uint8_t *)&functions_enable);
+      async_write(priv, ST1VAFE6AX_FUNCTIONS_ENABLE, &as->buff[0], 1);
+      break;
 
-    tmp = val.x_mg / 0.0078125f;
-    x_ofs_usr.x_ofs_usr = (uint8_t)tmp;
-  }
-  else if ((val.x_mg < (0.125f * 127.0f)) && (val.x_mg > (0.125f * -127.0f)) &&
-           (val.y_mg < (0.125f * 127.0f)) && (val.y_mg > (0.125f * -127.0f)) &&
-           (val.z_mg < (0.125f * 127.0f)) && (val.z_mg > (0.125f * -127.0f)))
-  {
-    ctrl9.usr_off_w = 1;
+    case 4:
+      async_read(priv, ST1VAFE6AX_WAKE_UP_SRC, &as->buff[0], 7);
+      break;
 
-    tmp = val.z_mg / 0.125f;
-    z_ofs_usr.z_ofs_usr = (uint8_t)tmp;
+    case 5:
+      all_sources_src_decode(as->buff, val);
+      async_read(priv, ST1VAFE6AX_FUNC_CFG_ACCESS, &as->save[1], 1);
+      break;
 
-    tmp = val.y_mg / 0.125f;
-    y_ofs_usr.y_ofs_usr = (uint8_t)tmp;
+    case 6:
+      async_bank(priv, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+      break;
 
-    tmp = val.x_mg / 0.125f;
-    x_ofs_usr.x_ofs_usr = (uint8_t)tmp;
-  }
-  else // out of limit
-  {
-    ctrl9.usr_off_w = 1;
-    z_ofs_usr.z_ofs_usr = 0xFFU;
-    y_ofs_usr.y_ofs_usr = 0xFFU;
-    x_ofs_usr.x_ofs_usr = 0xFFU;
-  }
+    case 7:
+      async_read(priv, ST1VAFE6AX_EMB_FUNC_EXEC_STATUS, &as->buff[0], 1);
+      break;
 
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_Z_OFS_USR, (uint8_t *)&z_ofs_usr, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_Y_OFS_USR, (uint8_t *)&y_ofs_usr, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_X_OFS_USR, (uint8_t *)&x_ofs_usr, 1);
-  if (ret != 0)
-  {
-    return ret;
+    case 8:
+      async_read(priv, ST1VAFE6AX_EMB_FUNC_SRC, &as->buff[1], 1);
+      break;
+
+    case 9:
+      async_bank(priv, ST1VAFE6AX_MAIN_MEM_BANK);
+      break;
+
+    default:
+      all_sources_emb_decode(&as->buff[0], &as->buff[1], val);
+      done = 1U;
+      break;
   }
-  ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
-  return ret;
+
+  return done;
 }
 
-/**
-  * @brief  Accelerometer user offset correction values in mg.[get]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Accelerometer user offset correction values in mg.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_xl_offset_mg_get(const stmdev_ctx_t *ctx,
-                                    st1vafe6ax_xl_offset_mg_t *val)
+/*
+ * Consume the result of the previous step and prepare the next transfer
+ * (as->pending), return 1 when the operation is over.
+ */
+static uint8_t async_step(st1vafe6ax_priv_t *priv)
 {
-  st1vafe6ax_z_ofs_usr_t z_ofs_usr = {0};
-  st1vafe6ax_y_ofs_usr_t y_ofs_usr = {0};
-  st1vafe6ax_x_ofs_usr_t x_ofs_usr = {0};
-  st1vafe6ax_ctrl9_t ctrl9 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_async_t *as = &priv->async;
+  int16_t *raw = (int16_t *)as->out;
+  uint16_t num;
+  uint8_t done = 0U;
+
+  switch (as->op)
+  {
+    case ASYNC_OP_FIFO_STATUS:
+      if (as->step == 0U)
+      {
+        async_read(priv, ST1VAFE6AX_FIFO_STATUS1, &as->buff[0], 2);
+      }
+      else
+      {
+        fifo_status_decode(as->buff, (st1vafe6ax_fifo_status_t *)as->out);
+        done = 1U;
+      }
+      break;
+
+    case ASYNC_OP_FIFO_BURST:
+      if (as->step == 0U)
+      {
+        async_read(priv, ST1VAFE6AX_FIFO_STATUS1, &as->buff[0], 2);
+      }
+      else if (as->step == 1U)
+      {
+        num = (uint16_t)(as->buff[0] | ((uint16_t)as->buff[1] << 8)) & 0x1FFU;
+        as->max_words = (num < as->max_words) ? num : as->max_words;
+        if (as->max_words == 0U)
+        {
+          done = 1U;
+        }
+        else
+        {
+          async_read(priv, ST1VAFE6AX_FIFO_DATA_OUT_TAG, (uint8_t *)as->out,
+                     (uint16_t)(as->max_words * 7U));
+        }
+      }
+      else
+      {
+        st1vafe6ax_fifo_out_raw_decode((uint8_t *)as->out, as->max_words,
+                                       (st1vafe6ax_fifo_out_raw_t *)as->out);
+        *as->n_read = as->max_words;
+        done = 1U;
+      }
+      break;
+
+    case ASYNC_OP_GY_RAW:
+      if (as->step == 0U)
+      {
+        async_read(priv, ST1VAFE6AX_OUTX_L_G, &as->buff[0], 6);
+      }
+      else
+      {
+        raw[0] = (int16_t)(as->buff[0] | ((uint16_t)as->buff[1] << 8));
+        raw[1] = (int16_t)(as->buff[2] | ((uint16_t)as->buff[3] << 8));
+        raw[2] = (int16_t)(as->buff[4] | ((uint16_t)as->buff[5] << 8));
+        done = 1U;
+      }
+      break;
+
+    case ASYNC_OP_XL_RAW:
+      if (as->step == 0U)
+      {
+        async_read(priv, ST1VAFE6AX_OUTZ_L_A, &as->buff[0], 6);
+      }
+      else
+      {
+        raw[2] = (int16_t)(as->buff[0] | ((uint16_t)as->buff[1] << 8));
+        raw[1] = (int16_t)(as->buff[2] | ((uint16_t)as->buff[3] << 8));
+        raw[0] = (int16_t)(as->buff[4] | ((uint16_t)as->buff[5] << 8));
+        done = 1U;
+      }
+      break;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL9, (uint8_t *)&ctrl9, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_Z_OFS_USR, (uint8_t *)&z_ofs_usr, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_Y_OFS_USR, (uint8_t *)&y_ofs_usr, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_X_OFS_USR, (uint8_t *)&x_ofs_usr, 1);
+    case ASYNC_OP_ALL_SOURCES:
+      done = async_all_sources_step(priv);
+      break;
 
-  if (ret != 0)
-  {
-    return ret;
+    default:
+      done = 1U;
+      break;
   }
 
-  if (ctrl9.usr_off_w == PROPERTY_DISABLE)
+  as->step++;
+
+  return done;
+}
+
+/*
+ * Run the operation until a transfer is submitted or the operation is
+ * over. A transport that completes the transfer inside submit() re-enters
+ * here through st1vafe6ax_async_complete(), so after a successful submit
+ * the state must not be touched anymore.
+ */
+static void async_run(const stmdev_ctx_t *ctx, st1vafe6ax_priv_t *priv, int32_t ret)
+{
+  st1vafe6ax_async_t *as = &priv->async;
+  st1vafe6ax_async_cb_t cb;
+  uint8_t done = 0U;
+
+  while ((ret == 0) && (done == 0U))
   {
-    val->z_mg = ((float_t)z_ofs_usr.z_ofs_usr * 0.0078125f);
-    val->y_mg = ((float_t)y_ofs_usr.y_ofs_usr * 0.0078125f);
-    val->x_mg = ((float_t)x_ofs_usr.x_ofs_usr * 0.0078125f);
+    as->pending = 0U;
+    done = async_step(priv);
+    if (as->pending != 0U)
+    {
+      ret = ST1VAFE6AX_BUS_SUBMIT(ctx, as->submit, &as->xfer);
+      if (ret == 0)
+      {
+        return;
+      }
+    }
   }
-  else
+
+  cb = as->cb;
+  as->busy = 0U;
+  if (cb != NULL)
   {
-    val->z_mg = ((float_t)z_ofs_usr.z_ofs_usr * 0.125f);
-    val->y_mg = ((float_t)y_ofs_usr.y_ofs_usr * 0.125f);
-    val->x_mg = ((float_t)x_ofs_usr.x_ofs_usr * 0.125f);
+    cb(ctx, ret, as->user);
   }
-
-  return ret;
 }
 
-/**
-  * @}
-  *
-  */
-
-/**
-  * @addtogroup  AH_BIO
-  * @brief   This section group all the functions concerning the
-  *          usage of AH_BIO
-  * @{
-  *
-  */
-
-/**
-  * @brief  Enables AH_BIO chain. When this bit is set to ‘1’, the AH_BIO buffers are
-  *         connected to the AH1/Bio1 and AH1/Bio2 pins. Before setting this bit to 1,
-  *         the accelerometer and gyroscope sensor have to be configured in power-down mode.[set]
-  *
-  * @param  ctx      read / write interface definitions
-  * @param  val      1: Enables AH_BIO chain, 0: Disable the AH_BIO chain
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
-  *
-  */
-int32_t st1vafe6ax_ah_bio_mode_set(const stmdev_ctx_t *ctx,
-                                   st1vafe6ax_ah_bio_mode_t val)
+static int32_t async_start(const stmdev_ctx_t *ctx, uint8_t op, void *out,
+                           st1vafe6ax_async_cb_t cb, void *user)
 {
-  st1vafe6ax_ctrl10_t ctrl10 = {0};
-  st1vafe6ax_ctrl7_t ctrl7 = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+  st1vafe6ax_priv_t *priv;
+  st1vafe6ax_async_t *as;
 
-  if (ret == 0)
+  if ((ctx == NULL) || (ctx->priv_data == NULL))
   {
-    if ((val.ah_bio1_en | val.ah_bio2_en) == PROPERTY_ENABLE)
-    {
-      ctrl7.ah_bio_en = PROPERTY_ENABLE;
-    }
-    else
-    {
-      ctrl7.ah_bio_en = PROPERTY_DISABLE;
-    }
-    ctrl7.ah_bio1_en = val.ah_bio1_en;
-    ctrl7.ah_bio2_en = val.ah_bio2_en;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+    return -1;
   }
-  if (ret == 0)
+
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  as = &priv->async;
+  if ((as->submit == NULL) || (as->busy != 0U) || (priv->bank_depth != 0U) ||
+      (priv->cmd_list != NULL))
   {
-    ctrl10.ah_bio_sw = val.swaps;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+    return -1;
   }
-  return ret;
+
+  as->busy = 1U;
+  as->op = op;
+  as->step = 0U;
+  as->out = out;
+  as->cb = cb;
+  as->user = user;
+
+  async_run(ctx, priv, 0);
+
+  return 0;
 }
 
 /**
-  * @brief  Enables AH_BIO chain. When this bit is set to ‘1’, the AH_BIO buffers are
-  *         connected to the AH1/Bio1 and AH1/Bio2 pins. Before setting this bit to 1,
-  *         the accelerometer and gyroscope sensor have to be configured in power-down mode.[get]
+  * @brief  Asynchronous transport.[set]
+  *         submit(handle, xfer) must start the transfer described by xfer
+  *         and return 0, then call st1vafe6ax_async_complete() when it is
+  *         over (also from inside submit() itself). If submit() returns an
+  *         error, st1vafe6ax_async_complete() must not be called.
+  *         Requires stmdev_ctx_t.priv_data to point to st1vafe6ax_priv_t.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      1: Enables AH_BIO chain, 0: Disable the AH_BIO chain
+  * @param  submit   platform submit function, NULL to disable
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ah_bio_mode_get(const stmdev_ctx_t *ctx,
-                                   st1vafe6ax_ah_bio_mode_t *val)
+int32_t st1vafe6ax_async_transport_set(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_xfer_submit_t submit)
 {
-  st1vafe6ax_ctrl10_t ctrl10 = {0};
-  st1vafe6ax_ctrl7_t ctrl7 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
-  ret += st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL10, (uint8_t *)&ctrl10, 1);
+  if ((ctx == NULL) || (ctx->priv_data == NULL))
+  {
+    return -1;
+  }
 
-  if (ret != 0)
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if (priv->async.busy != 0U)
   {
-    return ret;
+    return -1;
   }
 
-  val->ah_bio1_en = ctrl7.ah_bio1_en;
-  val->ah_bio2_en = ctrl7.ah_bio2_en;
-  val->swaps = ctrl10.ah_bio_sw;
+  priv->async.submit = submit;
 
-  return ret;
+  return 0;
 }
 
 /**
-  * @brief  Configures the equivalent input impedance of the AH_BIO buffers.[set]
+  * @brief  Asynchronous operation in progress.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      2400MOhm, 730MOhm, 300MOhm, 235MOhm,
+  * @param  val      1 if an operation is in progress
   * @retval          interface status (MANDATORY: return 0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ah_bio_zin_set(const stmdev_ctx_t *ctx,
-                                  st1vafe6ax_ah_bio_zin_t val)
+int32_t st1vafe6ax_async_busy_get(const stmdev_ctx_t *ctx, uint8_t *val)
 {
-  st1vafe6ax_ctrl7_t ctrl7 = {0};
-  int32_t ret = {0};
+  const st1vafe6ax_priv_t *priv;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
-  if (ret == 0)
+  if (ctx == NULL)
   {
-    ctrl7.ah_bio_c_zin = (uint8_t)val & 0x03U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
+    return -1;
   }
 
-  return ret;
+  priv = (const st1vafe6ax_priv_t *)ctx->priv_data;
+  *val = ((priv != NULL) && (priv->async.busy != 0U)) ? 1U : 0U;
+
+  return 0;
 }
 
 /**
-  * @brief  Configures the equivalent input impedance of the AH_BIO buffers.[get]
+  * @brief  Completion of the transfer last submitted, to be called by the
+  *         platform (e.g. from the DMA transfer complete interrupt).
+  *         The next transfer is submitted or, if the operation is over,
+  *         the operation callback is called from here.
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      2400MOhm, 730MOhm, 300MOhm, 235MOhm,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  status   transfer status (0 -> no Error)
   *
   */
-int32_t st1vafe6ax_ah_bio_zin_get(const stmdev_ctx_t *ctx,
-                                  st1vafe6ax_ah_bio_zin_t *val)
+void st1vafe6ax_async_complete(const stmdev_ctx_t *ctx, int32_t status)
 {
-  st1vafe6ax_ctrl7_t ctrl7 = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv;
+  st1vafe6ax_async_t *as;
 
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_CTRL7, (uint8_t *)&ctrl7, 1);
-  if (ret != 0)
+  if ((ctx == NULL) || (ctx->priv_data == NULL))
   {
-    return ret;
+    return;
   }
 
-  switch (ctrl7.ah_bio_c_zin)
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  as = &priv->async;
+  if (as->busy == 0U)
   {
-    case 0x00:
-      *val = ST1VAFE6AX_2400MOhm;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_730MOhm;
-      break;
-
-    case 0x02:
-      *val = ST1VAFE6AX_300MOhm;
-      break;
-
-    case 0x03:
-      *val = ST1VAFE6AX_235MOhm;
-      break;
+    return;
+  }
 
-    default:
-      *val = ST1VAFE6AX_2400MOhm;
-      break;
+  if (status == 0)
+  {
+    /* same bookkeeping as st1vafe6ax_read_reg / st1vafe6ax_write_reg */
+    shadow_update(priv, as->xfer.reg, as->xfer.buf, as->xfer.len);
   }
-  return ret;
+
+  async_run(ctx, priv, status);
 }
 
 /**
-  * @brief  Bio sensor sensitivity value register for the Finite State Machine.
-  *         This register corresponds to the conversion value of the Bio sensor.
-  *         The register value is expressed as half-precision floating-point format:
-  *         SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent bits; F: 10 fraction bits).[set]
+  * @brief  Status of FIFO, non blocking.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      Bio sensor sensitivity value register for the Finite State Machine.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  val      Status of FIFO, valid when cb is called with ret == 0
+  * @param  cb       called at the end of the operation (may be NULL)
+  * @param  user     passed to cb
+  * @retval          0 -> operation started, the result is given to cb
   *
   */
-int32_t st1vafe6ax_fsm_bio_sensitivity_set(const stmdev_ctx_t *ctx, uint16_t val)
+int32_t st1vafe6ax_fifo_status_get_async(const stmdev_ctx_t *ctx,
+                                         st1vafe6ax_fifo_status_t *val,
+                                         st1vafe6ax_async_cb_t cb, void *user)
 {
-  uint8_t buff[2] = {0};
-  int32_t ret = {0};
-
-  buff[1] = (uint8_t)(val / 256U);
-  buff[0] = (uint8_t)(val - (buff[1] * 256U));
-  ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_FSM_BIO_SENSITIVITY_L, (uint8_t *)&buff[0], 2);
-
-  return ret;
+  return async_start(ctx, ASYNC_OP_FIFO_STATUS, val, cb, user);
 }
 
 /**
-  * @brief  Bio sensor sensitivity value register for the Finite State Machine.
-  *         This register corresponds to the conversion value of the Bio sensor.
-  *         The register value is expressed as half-precision floating-point format:
-  *         SEEEEEFFFFFFFFFF (S: 1 sign bit; E: 5 exponent bits; F: 10 fraction bits).[get]
+  * @brief  FIFO data output, non blocking version of
+  *         st1vafe6ax_fifo_out_raw_burst_get().[get]
   *
-  * @param  ctx      read / write interface definitions
-  * @param  val      Bio sensor sensitivity value register for the Finite State Machine.
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  ctx        read / write interface definitions
+  * @param  val        array of st1vafe6ax_fifo_out_raw_t, also used as
+  *                    raw buffer for the bus transfer
+  * @param  max_words  number of elements of val
+  * @param  n_read     number of words read from FIFO, valid when cb is called
+  * @param  cb         called at the end of the operation (may be NULL)
+  * @param  user       passed to cb
+  * @retval            0 -> operation started, the result is given to cb
   *
   */
-int32_t st1vafe6ax_fsm_bio_sensitivity_get(const stmdev_ctx_t *ctx, uint16_t *val)
+int32_t st1vafe6ax_fifo_out_raw_burst_get_async(const stmdev_ctx_t *ctx,
+                                                st1vafe6ax_fifo_out_raw_t *val,
+                                                uint16_t max_words, uint16_t *n_read,
+                                                st1vafe6ax_async_cb_t cb, void *user)
 {
-  uint8_t buff[2] = {0};
-  int32_t ret = {0};
+  st1vafe6ax_priv_t *priv;
 
-  ret = st1vafe6ax_ln_pg_read(ctx, ST1VAFE6AX_FSM_BIO_SENSITIVITY_L, &buff[0], 2);
-  if (ret != 0)
+  *n_read = 0;
+
+  if ((ctx == NULL) || (ctx->priv_data == NULL))
   {
-    return ret;
+    return -1;
   }
 
-  *val = (uint16_t)(buff[0] | ((uint16_t)buff[1] << 8));
+  priv = (st1vafe6ax_priv_t *)ctx->priv_data;
+  if (priv->async.busy != 0U)
+  {
+    return -1;
+  }
 
-  return ret;
+  priv->async.max_words = max_words;
+  priv->async.n_read = n_read;
+
+  return async_start(ctx, ASYNC_OP_FIFO_BURST, val, cb, user);
 }
 
 /**
-  * @}
+  * @brief  Angular rate sensor, non blocking.[get]
   *
-  */
-
-/**
-  * @addtogroup  SenseWire (I3C)
-  * @brief   This section group all the functions concerning the
-  *          usage of SenseWire (I3C)
-  * @{
+  * @param  ctx      read / write interface definitions
+  * @param  val      Angular rate sensor, valid when cb is called
+  * @param  cb       called at the end of the operation (may be NULL)
+  * @param  user     passed to cb
+  * @retval          0 -> operation started, the result is given to cb
   *
   */
+int32_t st1vafe6ax_angular_rate_raw_get_async(const stmdev_ctx_t *ctx, int16_t *val,
+                                              st1vafe6ax_async_cb_t cb, void *user)
+{
+  return async_start(ctx, ASYNC_OP_GY_RAW, val, cb, user);
+}
 
 /**
-  * @brief  Selects the action the device will perform after "Reset whole chip" I3C pattern.[set]
+  * @brief  Linear acceleration sensor, non blocking.[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      SW_RST_DYN_ADDRESS_RST, GLOBAL_RST_,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  val      Linear acceleration sensor, valid when cb is called
+  * @param  cb       called at the end of the operation (may be NULL)
+  * @param  user     passed to cb
+  * @retval          0 -> operation started, the result is given to cb
   *
   */
-int32_t st1vafe6ax_i3c_reset_mode_set(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_i3c_reset_mode_t val)
+int32_t st1vafe6ax_acceleration_raw_get_async(const stmdev_ctx_t *ctx, int16_t *val,
+                                              st1vafe6ax_async_cb_t cb, void *user)
 {
-  st1vafe6ax_pin_ctrl_t pin_ctrl = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
-  if (ret == 0)
-  {
-    pin_ctrl.ibhr_por_en = (uint8_t)val & 0x01U;
-    ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
-  }
-
-  return ret;
+  return async_start(ctx, ASYNC_OP_XL_RAW, val, cb, user);
 }
 
 /**
-  * @brief  Selects the action the device will perform after "Reset whole chip" I3C pattern.[get]
+  * @brief  Get the status of all the interrupt sources, non blocking
+  *         version of st1vafe6ax_all_sources_get().[get]
   *
   * @param  ctx      read / write interface definitions
-  * @param  val      SW_RST_DYN_ADDRESS_RST, GLOBAL_RST_,
-  * @retval          interface status (MANDATORY: return 0 -> no Error)
+  * @param  val      status of all the interrupt sources, valid when cb is
+  *                  called with ret == 0
+  * @param  cb       called at the end of the operation (may be NULL)
+  * @param  user     passed to cb
+  * @retval          0 -> operation started, the result is given to cb
   *
   */
-int32_t st1vafe6ax_i3c_reset_mode_get(const stmdev_ctx_t *ctx,
-                                      st1vafe6ax_i3c_reset_mode_t *val)
+int32_t st1vafe6ax_all_sources_get_async(const stmdev_ctx_t *ctx,
+                                         st1vafe6ax_all_sources_t *val,
+                                         st1vafe6ax_async_cb_t cb, void *user)
 {
-  st1vafe6ax_pin_ctrl_t pin_ctrl = {0};
-  int32_t ret = {0};
-
-  ret = st1vafe6ax_read_reg(ctx, ST1VAFE6AX_PIN_CTRL, (uint8_t *)&pin_ctrl, 1);
-  if (ret != 0)
-  {
-    return ret;
-  }
-
-  switch (pin_ctrl.ibhr_por_en)
-  {
-    case 0x00:
-      *val = ST1VAFE6AX_SW_RST_DYN_ADDRESS_RST;
-      break;
-
-    case 0x01:
-      *val = ST1VAFE6AX_I3C_GLOBAL_RST;
-      break;
-
-    default:
-      *val = ST1VAFE6AX_SW_RST_DYN_ADDRESS_RST;
-      break;
-  }
-  return ret;
+  return async_start(ctx, ASYNC_OP_ALL_SOURCES, val, cb, user);
 }
 
 /**
@@ -8517,8 +13162,3 @@ int32_t st1vafe6ax_i3c_reset_mode_get(const stmdev_ctx_t *ctx,
   *
   */
 
-/**
-  * @}
-  *
-  */
-
@@ -2567,6 +2567,180 @@ int32_t st1vafe6ax_write_reg(const stmdev_ctx_t *ctx, uint8_t reg,
                              uint8_t *data,
                              uint16_t len);
 
+/*
+ * Optional driver private data. When stmdev_ctx_t.priv_data points to a
+ * zero-initialized st1vafe6ax_priv_t the driver tracks the selected memory
+ * bank, so that st1vafe6ax_mem_bank_set() does not access the bus when the
+ * bank does not change; the other optional features are turned on through
+ * their own APIs.
+ * The private data is only handled by the default (__weak) implementation
+ * of st1vafe6ax_read_reg / st1vafe6ax_write_reg.
+ *
+ * Register shadow: write-through copy of the main bank control registers
+ * (FUNC_CFG_ACCESS, PIN_CTRL, IF_CFG, FIFO_CTRL1..4, COUNTER_BDR_REG1/2,
+ * INT1/2_CTRL, CTRL1..10, FUNCTIONS_ENABLE, INACTIVITY_DUR..MD2_CFG,
+ * EMB_FUNC_CFG, X/Y/Z_OFS_USR). Reads of these registers are served locally,
+ * so the read-modify-write setters cost a single bus write.
+ * The embedded bank interrupt routes (EMB_FUNC_INTx, FSM_INTx, MLC_INTx,
+ * PEDO_CMD_REG) seen by st1vafe6ax_pin_int1/2_route_set() are kept as well:
+ * a route change that does not touch them does not select the embedded bank.
+ * A write of CTRL3.boot, CTRL3.sw_reset or FUNC_CFG_ACCESS.sw_por drops the
+ * whole shadow. Call st1vafe6ax_shadow_invalidate() (or _sync()) whenever
+ * the device registers are changed without going through this driver, and
+ * do not keep the shadow enabled while FUNC_CFG_ACCESS.fsm_wr_ctrl_en is set.
+ */
+#define ST1VAFE6AX_SHADOW_SIZE                   0x80U
+
+/*
+ * Optional asynchronous transport (see st1vafe6ax_async_transport_set()).
+ * The driver hands a transfer descriptor to the platform submit function,
+ * which only starts the transfer (e.g. SPI + DMA) and returns. When the
+ * transfer is over, the platform calls st1vafe6ax_async_complete(), usually
+ * from the DMA interrupt: the driver then submits the next transfer of the
+ * operation or, at the end, calls the application callback.
+ * The descriptor and its buffer stay valid until completion.
+ */
+#define ST1VAFE6AX_XFER_READ                     0x0U
+#define ST1VAFE6AX_XFER_WRITE                    0x1U
+
+typedef struct
+{
+  uint8_t dir;        /* ST1VAFE6AX_XFER_READ / ST1VAFE6AX_XFER_WRITE */
+  uint8_t reg;
+  uint16_t len;
+  uint8_t *buf;
+} st1vafe6ax_xfer_t;
+
+typedef int32_t (*st1vafe6ax_xfer_submit_t)(void *handle,
+                                            const st1vafe6ax_xfer_t *xfer);
+typedef void (*st1vafe6ax_async_cb_t)(const stmdev_ctx_t *ctx, int32_t ret,
+                                      void *user);
+
+typedef struct
+{
+  st1vafe6ax_xfer_submit_t submit;
+  st1vafe6ax_async_cb_t cb;
+  void *user;
+  void *out;
+  uint16_t *n_read;
+  uint16_t max_words;
+  st1vafe6ax_xfer_t xfer;
+  uint8_t busy;
+  uint8_t pending;
+  uint8_t op;
+  uint8_t step;
+  uint8_t save[2];
+  uint8_t buff[8];
+} st1vafe6ax_async_t;
+
+/*
+ * Command list (see st1vafe6ax_cmd_list_begin()). Register writes are
+ * recorded in buf, in the order they are made, as entries
+ * { FUNC_CFG_ACCESS, reg, len, data[len] }.
+ */
+typedef struct
+{
+  uint8_t *buf;
+  uint16_t size;
+  uint16_t used;
+  uint16_t last;        /* offset of the last entry, 0xFFFF if none */
+  uint16_t n_write;     /* st1vafe6ax_write_reg() calls recorded */
+  uint16_t n_cmd;       /* bus writes needed to execute them */
+  uint16_t n_flush;     /* list executed before its end (full, reads, delays) */
+  uint8_t bank;         /* FUNC_CFG_ACCESS at the end of the list */
+  uint8_t bus_bank;     /* FUNC_CFG_ACCESS on the device */
+  uint8_t volatile_wr;  /* reset / page / init writes recorded */
+  uint8_t no_inc;       /* CTRL3.IF_INC cleared: no multi-byte entries */
+} st1vafe6ax_cmd_list_t;
+
+/*
+ * Read coalescing scope (see st1vafe6ax_read_coalesce_begin()). A read of a
+ * configuration register fetches the whole group of neighbouring
+ * configuration registers with one burst; the following reads of the group
+ * are served from here until the end of the scope.
+ */
+typedef struct
+{
+  uint8_t valid[2][ST1VAFE6AX_SHADOW_SIZE / 8U];  /* main, embedded bank */
+  uint8_t data[2][ST1VAFE6AX_SHADOW_SIZE];
+  uint16_t n_read;      /* register reads inside the groups */
+  uint16_t n_bus;       /* bus transactions done for them */
+  uint16_t n_saved;     /* bus transactions saved */
+} st1vafe6ax_read_coalesce_t;
+
+typedef struct
+{
+  uint8_t bank_depth;
+  uint8_t bank_req;
+  uint8_t shadow_en;
+  uint8_t shadow_valid[ST1VAFE6AX_SHADOW_SIZE / 8U];
+  uint8_t shadow[ST1VAFE6AX_SHADOW_SIZE];
+  uint8_t route_valid;  /* bit 0: route[0], bit 1: route[1], bit 2: route_pedo */
+  uint8_t route[2][3];  /* EMB_FUNC_INTx, FSM_INTx, MLC_INTx of INT1, INT2 */
+  uint8_t route_pedo;   /* PEDO_CMD_REG */
+  st1vafe6ax_async_t async;
+  st1vafe6ax_cmd_list_t *cmd_list;
+  st1vafe6ax_read_coalesce_t *rd_coalesce;
+} st1vafe6ax_priv_t;
+
+int32_t st1vafe6ax_shadow_set(const stmdev_ctx_t *ctx, uint8_t val);
+int32_t st1vafe6ax_shadow_get(const stmdev_ctx_t *ctx, uint8_t *val);
+int32_t st1vafe6ax_shadow_invalidate(const stmdev_ctx_t *ctx);
+int32_t st1vafe6ax_shadow_sync(const stmdev_ctx_t *ctx);
+
+int32_t st1vafe6ax_cmd_list_begin(const stmdev_ctx_t *ctx,
+                                  st1vafe6ax_cmd_list_t *list,
+                                  uint8_t *buf, uint16_t size);
+int32_t st1vafe6ax_cmd_list_end(const stmdev_ctx_t *ctx);
+int32_t st1vafe6ax_cmd_list_submit(const stmdev_ctx_t *ctx,
+                                   const st1vafe6ax_cmd_list_t *list);
+
+int32_t st1vafe6ax_read_coalesce_begin(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_read_coalesce_t *rc);
+int32_t st1vafe6ax_read_coalesce_end(const stmdev_ctx_t *ctx);
+
+#if defined(ST1VAFE6AX_INSTRUMENTATION)
+/*
+ * Bus cost instrumentation (compiled only if ST1VAFE6AX_INSTRUMENTATION is
+ * defined). Each call of a public API from the application is wrapped (see
+ * the end of this file) and the transport calls it issues are accounted to
+ * it. The asynchronous transfers chained by st1vafe6ax_async_complete() are
+ * accounted to st1vafe6ax_async_complete; transport calls outside any API
+ * (direct st1vafe6ax_read_reg() / st1vafe6ax_write_reg() calls) go to
+ * entry 0. Not thread safe.
+ */
+#ifndef ST1VAFE6AX_INSTR_MAX
+#define ST1VAFE6AX_INSTR_MAX                     64U
+#endif /* ST1VAFE6AX_INSTR_MAX */
+
+/* Monotonic time in ns, used to measure the transport callbacks */
+typedef uint64_t (*st1vafe6ax_instr_clock_t)(void);
+
+typedef struct
+{
+  const char *name;
+  uint32_t calls;
+  uint32_t xfers;       /* transport calls */
+  uint32_t bytes;
+  uint32_t bank_switch; /* FUNC_CFG_ACCESS writes changing the bank */
+  uint64_t cb_ns;       /* time spent in the transport callbacks */
+} st1vafe6ax_instr_entry_t;
+
+typedef struct
+{
+  st1vafe6ax_instr_entry_t entry[ST1VAFE6AX_INSTR_MAX];
+  uint16_t num;
+} st1vafe6ax_instr_t;
+
+void st1vafe6ax_instr_enter(const char *name);
+int32_t st1vafe6ax_instr_leave(int32_t ret);
+void st1vafe6ax_instr_clock_set(st1vafe6ax_instr_clock_t clock);
+void st1vafe6ax_instr_snapshot(st1vafe6ax_instr_t *val);
+void st1vafe6ax_instr_reset(void);
+int32_t st1vafe6ax_instr_dump(const st1vafe6ax_instr_t *val, char *buf,
+                              uint32_t size);
+#endif /* ST1VAFE6AX_INSTRUMENTATION */
+
 float_t st1vafe6ax_from_sflp_to_mg(int16_t lsb);
 float_t st1vafe6ax_from_fs2_to_mg(int16_t lsb);
 float_t st1vafe6ax_from_fs4_to_mg(int16_t lsb);
@@ -2586,6 +2760,25 @@ uint64_t st1vafe6ax_from_lsb_to_nsec(uint32_t lsb);
 
 float_t st1vafe6ax_from_lsb_to_mv(int16_t lsb);
 
+int32_t st1vafe6ax_from_sflp_to_ug(int16_t lsb);
+int32_t st1vafe6ax_from_fs2_to_ug(int16_t lsb);
+int32_t st1vafe6ax_from_fs4_to_ug(int16_t lsb);
+int32_t st1vafe6ax_from_fs8_to_ug(int16_t lsb);
+int32_t st1vafe6ax_from_fs16_to_ug(int16_t lsb);
+
+int64_t st1vafe6ax_from_fs125_to_udps(int16_t lsb);
+int64_t st1vafe6ax_from_fs250_to_udps(int16_t lsb);
+int64_t st1vafe6ax_from_fs500_to_udps(int16_t lsb);
+int64_t st1vafe6ax_from_fs1000_to_udps(int16_t lsb);
+int64_t st1vafe6ax_from_fs2000_to_udps(int16_t lsb);
+int64_t st1vafe6ax_from_fs4000_to_udps(int16_t lsb);
+
+int32_t st1vafe6ax_from_lsb_to_mdegc(int16_t lsb);
+
+uint64_t st1vafe6ax_from_lsb_to_nsec_cal(uint64_t lsb, int8_t freq_fine);
+
+int32_t st1vafe6ax_from_lsb_to_uv(int16_t lsb);
+
 typedef enum
 {
   ST1VAFE6AX_READY                               = 0x0,
@@ -2604,6 +2797,9 @@ typedef enum
 int32_t st1vafe6ax_mem_bank_set(const stmdev_ctx_t *ctx, st1vafe6ax_mem_bank_t val);
 int32_t st1vafe6ax_mem_bank_get(const stmdev_ctx_t *ctx,
                                 st1vafe6ax_mem_bank_t *val);
+int32_t st1vafe6ax_mem_bank_session_enter(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_mem_bank_t val);
+int32_t st1vafe6ax_mem_bank_session_exit(const stmdev_ctx_t *ctx);
 
 int32_t st1vafe6ax_device_id_get(const stmdev_ctx_t *ctx, uint8_t *val);
 
@@ -2707,6 +2903,26 @@ int32_t st1vafe6ax_xl_full_scale_set(const stmdev_ctx_t *ctx,
 int32_t st1vafe6ax_xl_full_scale_get(const stmdev_ctx_t *ctx,
                                      st1vafe6ax_xl_full_scale_t *val);
 
+int32_t st1vafe6ax_from_xl_lsb_to_mg_array(st1vafe6ax_xl_full_scale_t fs,
+                                           const int16_t *lsb, float_t *mg,
+                                           uint32_t num);
+int32_t st1vafe6ax_from_gy_lsb_to_mdps_array(st1vafe6ax_gy_full_scale_t fs,
+                                             const int16_t *lsb, float_t *mdps,
+                                             uint32_t num);
+void st1vafe6ax_from_lsb_to_celsius_array(const int16_t *lsb, float_t *celsius,
+                                          uint32_t num);
+void st1vafe6ax_from_lsb_to_mv_array(const int16_t *lsb, float_t *mv, uint32_t num);
+
+int32_t st1vafe6ax_from_xl_lsb_to_ug_array(st1vafe6ax_xl_full_scale_t fs,
+                                           const int16_t *lsb, int32_t *ug,
+                                           uint32_t num);
+int32_t st1vafe6ax_from_gy_lsb_to_udps_array(st1vafe6ax_gy_full_scale_t fs,
+                                             const int16_t *lsb, int64_t *udps,
+                                             uint32_t num);
+void st1vafe6ax_from_lsb_to_mdegc_array(const int16_t *lsb, int32_t *mdegc,
+                                        uint32_t num);
+void st1vafe6ax_from_lsb_to_uv_array(const int16_t *lsb, int32_t *uv, uint32_t num);
+
 int32_t st1vafe6ax_xl_dual_channel_set(const stmdev_ctx_t *ctx, uint8_t val);
 int32_t st1vafe6ax_xl_dual_channel_get(const stmdev_ctx_t *ctx, uint8_t *val);
 
@@ -2792,6 +3008,67 @@ typedef struct
 int32_t st1vafe6ax_all_sources_get(const stmdev_ctx_t *ctx,
                                    st1vafe6ax_all_sources_t *val);
 
+#define ST1VAFE6AX_EVENT_DRDY_XL                 0x00000001UL
+#define ST1VAFE6AX_EVENT_DRDY_GY                 0x00000002UL
+#define ST1VAFE6AX_EVENT_DRDY_TEMP               0x00000004UL
+#define ST1VAFE6AX_EVENT_DRDY_AH_BIO             0x00000008UL
+#define ST1VAFE6AX_EVENT_FIFO_TH                 0x00000010UL
+#define ST1VAFE6AX_EVENT_FIFO_OVR                0x00000020UL
+#define ST1VAFE6AX_EVENT_FIFO_FULL               0x00000040UL
+#define ST1VAFE6AX_EVENT_FIFO_BDR                0x00000080UL
+#define ST1VAFE6AX_EVENT_FREE_FALL               0x00000100UL
+#define ST1VAFE6AX_EVENT_WAKE_UP                 0x00000200UL
+#define ST1VAFE6AX_EVENT_SINGLE_TAP              0x00000400UL
+#define ST1VAFE6AX_EVENT_DOUBLE_TAP              0x00000800UL
+#define ST1VAFE6AX_EVENT_SIX_D                   0x00001000UL
+#define ST1VAFE6AX_EVENT_SLEEP_CHANGE            0x00002000UL
+#define ST1VAFE6AX_EVENT_STEP_DET                0x00004000UL
+#define ST1VAFE6AX_EVENT_TILT                    0x00008000UL
+#define ST1VAFE6AX_EVENT_FSM(n)                  (0x00010000UL << ((n) - 1U)) /* n = 1..8 */
+#define ST1VAFE6AX_EVENT_MLC(n)                  (0x01000000UL << ((n) - 1U)) /* n = 1..4 */
+#define ST1VAFE6AX_EVENT_SIG_MOT                 0x10000000UL
+#define ST1VAFE6AX_EVENT_FSM_LC                  0x20000000UL
+#define ST1VAFE6AX_EVENT_TIMESTAMP               0x40000000UL
+#define ST1VAFE6AX_EVENT_SLEEP_STATE             0x80000000UL
+/* uint64_t bitmask only (all sources / interrupt routing) */
+#define ST1VAFE6AX_EVENT_STEP_COUNT_INC          0x0000000100000000ULL
+#define ST1VAFE6AX_EVENT_STEP_COUNT_OVERFLOW     0x0000000200000000ULL
+#define ST1VAFE6AX_EVENT_STEP_ON_DELTA_TIME      0x0000000400000000ULL
+#define ST1VAFE6AX_EVENT_EMB_FUNC_STAND_BY       0x0000000800000000ULL
+#define ST1VAFE6AX_EVENT_EMB_FUNC_TIME_EXCEED    0x0000001000000000ULL
+#define ST1VAFE6AX_EVENT_GY_SETTLING             0x0000002000000000ULL
+#define ST1VAFE6AX_EVENT_DEN_FLAG                0x0000004000000000ULL
+#define ST1VAFE6AX_EVENT_WAKE_UP_X               0x0000008000000000ULL
+#define ST1VAFE6AX_EVENT_WAKE_UP_Y               0x0000010000000000ULL
+#define ST1VAFE6AX_EVENT_WAKE_UP_Z               0x0000020000000000ULL
+#define ST1VAFE6AX_EVENT_TAP_X                   0x0000040000000000ULL
+#define ST1VAFE6AX_EVENT_TAP_Y                   0x0000080000000000ULL
+#define ST1VAFE6AX_EVENT_TAP_Z                   0x0000100000000000ULL
+#define ST1VAFE6AX_EVENT_TAP_SIGN                0x0000200000000000ULL
+#define ST1VAFE6AX_EVENT_SIX_D_XL                0x0000400000000000ULL
+#define ST1VAFE6AX_EVENT_SIX_D_XH                0x0000800000000000ULL
+#define ST1VAFE6AX_EVENT_SIX_D_YL                0x0001000000000000ULL
+#define ST1VAFE6AX_EVENT_SIX_D_YH                0x0002000000000000ULL
+#define ST1VAFE6AX_EVENT_SIX_D_ZL                0x0004000000000000ULL
+#define ST1VAFE6AX_EVENT_SIX_D_ZH                0x0008000000000000ULL
+int32_t st1vafe6ax_event_poll_get(const stmdev_ctx_t *ctx, uint32_t *val);
+
+#define ST1VAFE6AX_SRC_FIFO                      0x01U /* FIFO flags */
+#define ST1VAFE6AX_SRC_DRDY                      0x02U /* data ready, timestamp */
+#define ST1VAFE6AX_SRC_INT                       0x04U /* free-fall, wake-up, 6D (ALL_INT_SRC) */
+#define ST1VAFE6AX_SRC_WAKE_UP                   0x08U /* wake-up axes, sleep */
+#define ST1VAFE6AX_SRC_TAP                       0x10U
+#define ST1VAFE6AX_SRC_SIX_D                     0x20U
+#define ST1VAFE6AX_SRC_EMB                       0x40U /* embedded functions, FSM, MLC (main page) */
+#define ST1VAFE6AX_SRC_EMB_EXT                   0x80U /* step counter, exec status (embedded bank) */
+#define ST1VAFE6AX_SRC_ALL                       0xFFU
+int32_t st1vafe6ax_all_sources_sel_get(const stmdev_ctx_t *ctx, uint8_t groups,
+                                       st1vafe6ax_all_sources_t *val);
+
+uint64_t st1vafe6ax_all_sources_to_mask(const st1vafe6ax_all_sources_t *val);
+void st1vafe6ax_all_sources_from_mask(uint64_t mask, st1vafe6ax_all_sources_t *val);
+int32_t st1vafe6ax_all_sources_mask_get(const stmdev_ctx_t *ctx, uint64_t *val);
+
 typedef struct
 {
   uint8_t drdy_xl                       : 1;
@@ -2816,9 +3093,13 @@ int32_t st1vafe6ax_ah_bio_raw_get(const stmdev_ctx_t *ctx, int16_t *val);
 int32_t st1vafe6ax_odr_cal_reg_get(const stmdev_ctx_t *ctx, int8_t *val);
 
 int32_t st1vafe6ax_ln_pg_write(const stmdev_ctx_t *ctx, uint16_t address,
-                               uint8_t *buf, uint8_t len);
+                               uint8_t *buf, uint16_t len);
 int32_t st1vafe6ax_ln_pg_read(const stmdev_ctx_t *ctx, uint16_t address,
-                              uint8_t *buf, uint8_t len);
+                              uint8_t *buf, uint16_t len);
+
+#define ST1VAFE6AX_UCF_VERIFY                    0x01U
+int32_t st1vafe6ax_ucf_load(const stmdev_ctx_t *ctx, const ucf_line_t *lines,
+                            uint32_t num, uint8_t flags);
 
 int32_t st1vafe6ax_timestamp_set(const stmdev_ctx_t *ctx, uint8_t val);
 int32_t st1vafe6ax_timestamp_get(const stmdev_ctx_t *ctx, uint8_t *val);
@@ -3037,6 +3318,13 @@ int32_t st1vafe6ax_pin_int2_route_set(const stmdev_ctx_t *ctx,
 int32_t st1vafe6ax_pin_int2_route_get(const stmdev_ctx_t *ctx,
                                       st1vafe6ax_pin_int_route_t *val);
 
+uint64_t st1vafe6ax_pin_int_route_to_mask(const st1vafe6ax_pin_int_route_t *val);
+void st1vafe6ax_pin_int_route_from_mask(uint64_t mask, st1vafe6ax_pin_int_route_t *val);
+int32_t st1vafe6ax_pin_int1_route_mask_set(const stmdev_ctx_t *ctx, uint64_t val);
+int32_t st1vafe6ax_pin_int1_route_mask_get(const stmdev_ctx_t *ctx, uint64_t *val);
+int32_t st1vafe6ax_pin_int2_route_mask_set(const stmdev_ctx_t *ctx, uint64_t val);
+int32_t st1vafe6ax_pin_int2_route_mask_get(const stmdev_ctx_t *ctx, uint64_t *val);
+
 int32_t st1vafe6ax_pin_int_en_when_i2c_set(const stmdev_ctx_t *ctx, uint8_t val);
 int32_t st1vafe6ax_pin_int_en_when_i2c_get(const stmdev_ctx_t *ctx, uint8_t *val);
 
@@ -3379,6 +3667,105 @@ typedef struct
 } st1vafe6ax_fifo_out_raw_t;
 int32_t st1vafe6ax_fifo_out_raw_get(const stmdev_ctx_t *ctx,
                                     st1vafe6ax_fifo_out_raw_t *val);
+int32_t st1vafe6ax_fifo_out_raw_burst_get(const stmdev_ctx_t *ctx,
+                                          st1vafe6ax_fifo_out_raw_t *val,
+                                          uint16_t max_words, uint16_t *n_read);
+void st1vafe6ax_fifo_out_raw_decode(const uint8_t *buff, uint16_t num,
+                                    st1vafe6ax_fifo_out_raw_t *val);
+
+typedef enum
+{
+  ST1VAFE6AX_FIFO_DCMP_XL                        = 0x0,
+  ST1VAFE6AX_FIFO_DCMP_GY                        = 0x1,
+} st1vafe6ax_fifo_dcmp_sensor_t;
+
+typedef struct
+{
+  int16_t data[3];
+  uint8_t valid;
+} st1vafe6ax_fifo_dcmp_stream_t;
+
+typedef struct
+{
+  st1vafe6ax_fifo_dcmp_stream_t xl;
+  st1vafe6ax_fifo_dcmp_stream_t gy;
+  uint32_t slot;
+  uint8_t cnt;
+  uint8_t cnt_valid;
+} st1vafe6ax_fifo_dcmp_t;
+
+typedef struct
+{
+  st1vafe6ax_fifo_dcmp_sensor_t sensor;
+  uint32_t slot;
+  int16_t data[3];
+} st1vafe6ax_fifo_dcmp_sample_t;
+
+void st1vafe6ax_fifo_dcmp_reset(st1vafe6ax_fifo_dcmp_t *dcmp);
+uint8_t st1vafe6ax_fifo_dcmp_process(st1vafe6ax_fifo_dcmp_t *dcmp,
+                                     const st1vafe6ax_fifo_out_raw_t *val,
+                                     st1vafe6ax_fifo_dcmp_sample_t *out);
+
+typedef struct
+{
+  uint64_t ts_hi;
+  uint64_t ts_prev;
+  uint64_t ts_last;
+  uint32_t slot_prev;
+  uint32_t slot_last;
+  uint32_t raw;
+  uint32_t period;
+  uint32_t period_nom;
+  uint8_t anchors;
+  int8_t freq_fine;
+} st1vafe6ax_fifo_ts_t;
+
+void st1vafe6ax_fifo_ts_init(st1vafe6ax_fifo_ts_t *fts, st1vafe6ax_fifo_xl_batch_t bdr,
+                             int8_t freq_fine);
+void st1vafe6ax_fifo_ts_anchor(st1vafe6ax_fifo_ts_t *fts, uint32_t slot,
+                               const st1vafe6ax_fifo_out_raw_t *val);
+uint64_t st1vafe6ax_fifo_ts_slot_to_lsb(const st1vafe6ax_fifo_ts_t *fts, uint32_t slot);
+uint64_t st1vafe6ax_fifo_ts_lsb_to_nsec(const st1vafe6ax_fifo_ts_t *fts, uint64_t lsb);
+void st1vafe6ax_fifo_ts_slots_to_nsec(const st1vafe6ax_fifo_ts_t *fts,
+                                      const uint32_t *slot, uint64_t *nsec,
+                                      uint16_t num);
+
+typedef struct
+{
+  int16_t *x;
+  int16_t *y;
+  int16_t *z;
+  uint64_t *ts;
+  uint16_t cap;
+  uint16_t len;
+  uint16_t ts_pend;
+} st1vafe6ax_fifo_axis_buf_t;
+
+typedef struct
+{
+  int16_t *data;
+  uint64_t *ts;
+  uint16_t cap;
+  uint16_t len;
+  uint16_t ts_pend;
+} st1vafe6ax_fifo_chan_buf_t;
+
+typedef struct
+{
+  st1vafe6ax_fifo_axis_buf_t xl;
+  st1vafe6ax_fifo_axis_buf_t gy;
+  st1vafe6ax_fifo_chan_buf_t ah_bio;
+  st1vafe6ax_fifo_chan_buf_t temp;
+  st1vafe6ax_fifo_dcmp_t *dcmp;
+  st1vafe6ax_fifo_ts_t *fts;
+} st1vafe6ax_fifo_demux_t;
+
+void st1vafe6ax_fifo_demux_init(st1vafe6ax_fifo_demux_t *dmx,
+                                st1vafe6ax_fifo_dcmp_t *dcmp,
+                                st1vafe6ax_fifo_ts_t *fts);
+void st1vafe6ax_fifo_demux_clear(st1vafe6ax_fifo_demux_t *dmx);
+uint16_t st1vafe6ax_fifo_demux(st1vafe6ax_fifo_demux_t *dmx,
+                               const st1vafe6ax_fifo_out_raw_t *val, uint16_t num);
 
 int32_t st1vafe6ax_fifo_stpcnt_batch_set(const stmdev_ctx_t *ctx, uint8_t val);
 int32_t st1vafe6ax_fifo_stpcnt_batch_get(const stmdev_ctx_t *ctx, uint8_t *val);
@@ -3517,6 +3904,15 @@ int32_t st1vafe6ax_fsm_number_of_programs_get(const stmdev_ctx_t *ctx, uint8_t *
 int32_t st1vafe6ax_fsm_start_address_set(const stmdev_ctx_t *ctx, uint16_t val);
 int32_t st1vafe6ax_fsm_start_address_get(const stmdev_ctx_t *ctx, uint16_t *val);
 
+typedef struct
+{
+  const uint8_t *data;
+  uint16_t len;
+} st1vafe6ax_fsm_prg_t;
+int32_t st1vafe6ax_fsm_load(const stmdev_ctx_t *ctx, const st1vafe6ax_fsm_prg_t *prg,
+                            uint8_t num, uint16_t start, uint16_t lc_timeout,
+                            uint8_t *written);
+
 typedef enum
 {
   ST1VAFE6AX_MLC_OFF                             = 0x0,
@@ -3567,6 +3963,17 @@ int32_t st1vafe6ax_xl_offset_mg_set(const stmdev_ctx_t *ctx,
 int32_t st1vafe6ax_xl_offset_mg_get(const stmdev_ctx_t *ctx,
                                     st1vafe6ax_xl_offset_mg_t *val);
 
+typedef struct
+{
+  int32_t z_ug;
+  int32_t y_ug;
+  int32_t x_ug;
+} st1vafe6ax_xl_offset_ug_t;
+int32_t st1vafe6ax_xl_offset_ug_set(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_offset_ug_t val);
+int32_t st1vafe6ax_xl_offset_ug_get(const stmdev_ctx_t *ctx,
+                                    st1vafe6ax_xl_offset_ug_t *val);
+
 typedef struct
 {
   uint8_t ah_bio1_en                    : 1;
@@ -3603,6 +4010,561 @@ int32_t st1vafe6ax_i3c_reset_mode_set(const stmdev_ctx_t *ctx,
 int32_t st1vafe6ax_i3c_reset_mode_get(const stmdev_ctx_t *ctx,
                                       st1vafe6ax_i3c_reset_mode_t *val);
 
+/*
+ * Interrupt dispatcher: payload passed to the handler of each event
+ *  - FSM(n) / MLC(n)                  : FSM_OUTSn / MLCn_SRC
+ *  - FIFO_*                           : FIFO level (FIFO_STATUS1/2 diff_fifo)
+ *  - DRDY_*, TIMESTAMP                : STATUS_REG
+ *  - WAKE_UP, FREE_FALL, SLEEP_*      : WAKE_UP_SRC
+ *  - SINGLE_TAP, DOUBLE_TAP           : TAP_SRC
+ *  - SIX_D                            : D6D_SRC
+ *  - STEP_DET, TILT, SIG_MOT, FSM_LC  : EMB_FUNC_STATUS_MAINPAGE
+ */
+#define ST1VAFE6AX_DISPATCH_MAX                  8U
+
+typedef void (*st1vafe6ax_event_cb_t)(const stmdev_ctx_t *ctx, uint64_t event,
+                                      uint16_t payload, void *user);
+
+typedef struct
+{
+  uint64_t events;
+  st1vafe6ax_event_cb_t cb;
+  void *user;
+} st1vafe6ax_event_handler_t;
+
+typedef struct
+{
+  uint64_t route[2];
+  st1vafe6ax_event_handler_t handler[ST1VAFE6AX_DISPATCH_MAX];
+  uint8_t num;
+} st1vafe6ax_dispatch_t;
+int32_t st1vafe6ax_dispatch_init(const stmdev_ctx_t *ctx, st1vafe6ax_dispatch_t *val);
+int32_t st1vafe6ax_dispatch_route_update(const stmdev_ctx_t *ctx,
+                                         st1vafe6ax_dispatch_t *val);
+int32_t st1vafe6ax_dispatch_handler_set(st1vafe6ax_dispatch_t *val, uint64_t events,
+                                        st1vafe6ax_event_cb_t cb, void *user);
+int32_t st1vafe6ax_dispatch_run(const stmdev_ctx_t *ctx,
+                                const st1vafe6ax_dispatch_t *val, uint8_t pin);
+
+int32_t st1vafe6ax_async_transport_set(const stmdev_ctx_t *ctx,
+                                       st1vafe6ax_xfer_submit_t submit);
+int32_t st1vafe6ax_async_busy_get(const stmdev_ctx_t *ctx, uint8_t *val);
+void st1vafe6ax_async_complete(const stmdev_ctx_t *ctx, int32_t status);
+
+int32_t st1vafe6ax_fifo_status_get_async(const stmdev_ctx_t *ctx,
+                                         st1vafe6ax_fifo_status_t *val,
+                                         st1vafe6ax_async_cb_t cb, void *user);
+int32_t st1vafe6ax_fifo_out_raw_burst_get_async(const stmdev_ctx_t *ctx,
+                                                st1vafe6ax_fifo_out_raw_t *val,
+                                                uint16_t max_words, uint16_t *n_read,
+                                                st1vafe6ax_async_cb_t cb, void *user);
+int32_t st1vafe6ax_angular_rate_raw_get_async(const stmdev_ctx_t *ctx, int16_t *val,
+                                              st1vafe6ax_async_cb_t cb, void *user);
+int32_t st1vafe6ax_acceleration_raw_get_async(const stmdev_ctx_t *ctx, int16_t *val,
+                                              st1vafe6ax_async_cb_t cb, void *user);
+int32_t st1vafe6ax_all_sources_get_async(const stmdev_ctx_t *ctx,
+                                         st1vafe6ax_all_sources_t *val,
+                                         st1vafe6ax_async_cb_t cb, void *user);
+
+#if defined(ST1VAFE6AX_INSTRUMENTATION) && !defined(ST1VAFE6AX_INSTR_NO_WRAP)
+/*
+ * Instrumentation: the public APIs called by the application are wrapped so
+ * that the transport calls they issue are accounted to them (the driver
+ * itself is built with ST1VAFE6AX_INSTR_NO_WRAP). st1vafe6ax_read_reg and
+ * st1vafe6ax_write_reg are not wrapped, so that the application can still
+ * provide its own definition of these __weak functions: their direct calls
+ * go to entry 0.
+ */
+#define ST1VAFE6AX_INSTR_CALL(fn, ...) \
+  (st1vafe6ax_instr_enter(#fn), st1vafe6ax_instr_leave((fn)(__VA_ARGS__)))
+
+#define st1vafe6ax_shadow_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_shadow_set, __VA_ARGS__)
+#define st1vafe6ax_shadow_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_shadow_get, __VA_ARGS__)
+#define st1vafe6ax_shadow_invalidate(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_shadow_invalidate, __VA_ARGS__)
+#define st1vafe6ax_shadow_sync(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_shadow_sync, __VA_ARGS__)
+#define st1vafe6ax_cmd_list_begin(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_cmd_list_begin, __VA_ARGS__)
+#define st1vafe6ax_cmd_list_end(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_cmd_list_end, __VA_ARGS__)
+#define st1vafe6ax_cmd_list_submit(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_cmd_list_submit, __VA_ARGS__)
+#define st1vafe6ax_read_coalesce_begin(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_read_coalesce_begin, __VA_ARGS__)
+#define st1vafe6ax_read_coalesce_end(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_read_coalesce_end, __VA_ARGS__)
+#define st1vafe6ax_reset_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_reset_set, __VA_ARGS__)
+#define st1vafe6ax_reset_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_reset_get, __VA_ARGS__)
+#define st1vafe6ax_mem_bank_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mem_bank_set, __VA_ARGS__)
+#define st1vafe6ax_mem_bank_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mem_bank_get, __VA_ARGS__)
+#define st1vafe6ax_mem_bank_session_enter(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mem_bank_session_enter, __VA_ARGS__)
+#define st1vafe6ax_mem_bank_session_exit(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mem_bank_session_exit, __VA_ARGS__)
+#define st1vafe6ax_device_id_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_device_id_get, __VA_ARGS__)
+#define st1vafe6ax_xl_data_rate_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_data_rate_set, __VA_ARGS__)
+#define st1vafe6ax_xl_data_rate_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_data_rate_get, __VA_ARGS__)
+#define st1vafe6ax_xl_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_mode_set, __VA_ARGS__)
+#define st1vafe6ax_xl_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_mode_get, __VA_ARGS__)
+#define st1vafe6ax_gy_data_rate_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_gy_data_rate_set, __VA_ARGS__)
+#define st1vafe6ax_gy_data_rate_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_gy_data_rate_get, __VA_ARGS__)
+#define st1vafe6ax_gy_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_gy_mode_set, __VA_ARGS__)
+#define st1vafe6ax_gy_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_gy_mode_get, __VA_ARGS__)
+#define st1vafe6ax_auto_increment_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_auto_increment_set, __VA_ARGS__)
+#define st1vafe6ax_auto_increment_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_auto_increment_get, __VA_ARGS__)
+#define st1vafe6ax_block_data_update_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_block_data_update_set, __VA_ARGS__)
+#define st1vafe6ax_block_data_update_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_block_data_update_get, __VA_ARGS__)
+#define st1vafe6ax_data_ready_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_data_ready_mode_set, __VA_ARGS__)
+#define st1vafe6ax_data_ready_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_data_ready_mode_get, __VA_ARGS__)
+#define st1vafe6ax_gy_full_scale_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_gy_full_scale_set, __VA_ARGS__)
+#define st1vafe6ax_gy_full_scale_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_gy_full_scale_get, __VA_ARGS__)
+#define st1vafe6ax_xl_full_scale_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_full_scale_set, __VA_ARGS__)
+#define st1vafe6ax_xl_full_scale_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_full_scale_get, __VA_ARGS__)
+#define st1vafe6ax_xl_dual_channel_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_dual_channel_set, __VA_ARGS__)
+#define st1vafe6ax_xl_dual_channel_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_dual_channel_get, __VA_ARGS__)
+#define st1vafe6ax_xl_self_test_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_self_test_set, __VA_ARGS__)
+#define st1vafe6ax_xl_self_test_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_self_test_get, __VA_ARGS__)
+#define st1vafe6ax_gy_self_test_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_gy_self_test_set, __VA_ARGS__)
+#define st1vafe6ax_gy_self_test_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_gy_self_test_get, __VA_ARGS__)
+#define st1vafe6ax_all_sources_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_all_sources_get, __VA_ARGS__)
+#define st1vafe6ax_event_poll_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_event_poll_get, __VA_ARGS__)
+#define st1vafe6ax_all_sources_sel_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_all_sources_sel_get, __VA_ARGS__)
+#define st1vafe6ax_all_sources_mask_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_all_sources_mask_get, __VA_ARGS__)
+#define st1vafe6ax_flag_data_ready_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_flag_data_ready_get, __VA_ARGS__)
+#define st1vafe6ax_temperature_raw_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_temperature_raw_get, __VA_ARGS__)
+#define st1vafe6ax_angular_rate_raw_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_angular_rate_raw_get, __VA_ARGS__)
+#define st1vafe6ax_acceleration_raw_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_acceleration_raw_get, __VA_ARGS__)
+#define st1vafe6ax_dual_acceleration_raw_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_dual_acceleration_raw_get, __VA_ARGS__)
+#define st1vafe6ax_ah_bio_raw_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ah_bio_raw_get, __VA_ARGS__)
+#define st1vafe6ax_odr_cal_reg_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_odr_cal_reg_get, __VA_ARGS__)
+#define st1vafe6ax_ln_pg_write(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ln_pg_write, __VA_ARGS__)
+#define st1vafe6ax_ln_pg_read(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ln_pg_read, __VA_ARGS__)
+#define st1vafe6ax_ucf_load(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ucf_load, __VA_ARGS__)
+#define st1vafe6ax_timestamp_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_timestamp_set, __VA_ARGS__)
+#define st1vafe6ax_timestamp_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_timestamp_get, __VA_ARGS__)
+#define st1vafe6ax_timestamp_raw_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_timestamp_raw_get, __VA_ARGS__)
+#define st1vafe6ax_filt_anti_spike_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_anti_spike_set, __VA_ARGS__)
+#define st1vafe6ax_filt_anti_spike_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_anti_spike_get, __VA_ARGS__)
+#define st1vafe6ax_filt_settling_mask_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_settling_mask_set, __VA_ARGS__)
+#define st1vafe6ax_filt_settling_mask_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_settling_mask_get, __VA_ARGS__)
+#define st1vafe6ax_filt_gy_lp1_bandwidth_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_gy_lp1_bandwidth_set, __VA_ARGS__)
+#define st1vafe6ax_filt_gy_lp1_bandwidth_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_gy_lp1_bandwidth_get, __VA_ARGS__)
+#define st1vafe6ax_filt_gy_lp1_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_gy_lp1_set, __VA_ARGS__)
+#define st1vafe6ax_filt_gy_lp1_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_gy_lp1_get, __VA_ARGS__)
+#define st1vafe6ax_filt_ah_bio_conf_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_ah_bio_conf_set, __VA_ARGS__)
+#define st1vafe6ax_filt_ah_bio_conf_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_ah_bio_conf_get, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_lp2_bandwidth_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_lp2_bandwidth_set, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_lp2_bandwidth_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_lp2_bandwidth_get, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_lp2_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_lp2_set, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_lp2_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_lp2_get, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_hp_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_hp_set, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_hp_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_hp_get, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_fast_settling_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_fast_settling_set, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_fast_settling_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_fast_settling_get, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_hp_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_hp_mode_set, __VA_ARGS__)
+#define st1vafe6ax_filt_xl_hp_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_xl_hp_mode_get, __VA_ARGS__)
+#define st1vafe6ax_filt_wkup_act_feed_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_wkup_act_feed_set, __VA_ARGS__)
+#define st1vafe6ax_filt_wkup_act_feed_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_wkup_act_feed_get, __VA_ARGS__)
+#define st1vafe6ax_mask_trigger_xl_settl_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mask_trigger_xl_settl_set, __VA_ARGS__)
+#define st1vafe6ax_mask_trigger_xl_settl_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mask_trigger_xl_settl_get, __VA_ARGS__)
+#define st1vafe6ax_filt_sixd_feed_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_sixd_feed_set, __VA_ARGS__)
+#define st1vafe6ax_filt_sixd_feed_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_filt_sixd_feed_get, __VA_ARGS__)
+#define st1vafe6ax_ui_sdo_pull_up_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ui_sdo_pull_up_set, __VA_ARGS__)
+#define st1vafe6ax_ui_sdo_pull_up_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ui_sdo_pull_up_get, __VA_ARGS__)
+#define st1vafe6ax_ui_i2c_i3c_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ui_i2c_i3c_mode_set, __VA_ARGS__)
+#define st1vafe6ax_ui_i2c_i3c_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ui_i2c_i3c_mode_get, __VA_ARGS__)
+#define st1vafe6ax_spi_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_spi_mode_set, __VA_ARGS__)
+#define st1vafe6ax_spi_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_spi_mode_get, __VA_ARGS__)
+#define st1vafe6ax_ui_sda_pull_up_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ui_sda_pull_up_set, __VA_ARGS__)
+#define st1vafe6ax_ui_sda_pull_up_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ui_sda_pull_up_get, __VA_ARGS__)
+#define st1vafe6ax_i3c_ibi_time_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_i3c_ibi_time_set, __VA_ARGS__)
+#define st1vafe6ax_i3c_ibi_time_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_i3c_ibi_time_get, __VA_ARGS__)
+#define st1vafe6ax_int_pin_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_int_pin_mode_set, __VA_ARGS__)
+#define st1vafe6ax_int_pin_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_int_pin_mode_get, __VA_ARGS__)
+#define st1vafe6ax_pin_polarity_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_polarity_set, __VA_ARGS__)
+#define st1vafe6ax_pin_polarity_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_polarity_get, __VA_ARGS__)
+#define st1vafe6ax_pin_int1_route_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int1_route_set, __VA_ARGS__)
+#define st1vafe6ax_pin_int1_route_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int1_route_get, __VA_ARGS__)
+#define st1vafe6ax_pin_int2_route_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int2_route_set, __VA_ARGS__)
+#define st1vafe6ax_pin_int2_route_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int2_route_get, __VA_ARGS__)
+#define st1vafe6ax_pin_int1_route_mask_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int1_route_mask_set, __VA_ARGS__)
+#define st1vafe6ax_pin_int1_route_mask_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int1_route_mask_get, __VA_ARGS__)
+#define st1vafe6ax_pin_int2_route_mask_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int2_route_mask_set, __VA_ARGS__)
+#define st1vafe6ax_pin_int2_route_mask_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int2_route_mask_get, __VA_ARGS__)
+#define st1vafe6ax_pin_int_en_when_i2c_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int_en_when_i2c_set, __VA_ARGS__)
+#define st1vafe6ax_pin_int_en_when_i2c_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_pin_int_en_when_i2c_get, __VA_ARGS__)
+#define st1vafe6ax_int_notification_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_int_notification_set, __VA_ARGS__)
+#define st1vafe6ax_int_notification_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_int_notification_get, __VA_ARGS__)
+#define st1vafe6ax_act_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_mode_set, __VA_ARGS__)
+#define st1vafe6ax_act_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_mode_get, __VA_ARGS__)
+#define st1vafe6ax_act_from_sleep_to_act_dur_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_from_sleep_to_act_dur_set, __VA_ARGS__)
+#define st1vafe6ax_act_from_sleep_to_act_dur_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_from_sleep_to_act_dur_get, __VA_ARGS__)
+#define st1vafe6ax_act_sleep_xl_odr_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_sleep_xl_odr_set, __VA_ARGS__)
+#define st1vafe6ax_act_sleep_xl_odr_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_sleep_xl_odr_get, __VA_ARGS__)
+#define st1vafe6ax_act_thresholds_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_thresholds_set, __VA_ARGS__)
+#define st1vafe6ax_act_thresholds_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_thresholds_get, __VA_ARGS__)
+#define st1vafe6ax_act_wkup_time_windows_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_wkup_time_windows_set, __VA_ARGS__)
+#define st1vafe6ax_act_wkup_time_windows_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_act_wkup_time_windows_get, __VA_ARGS__)
+#define st1vafe6ax_tap_detection_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_detection_set, __VA_ARGS__)
+#define st1vafe6ax_tap_detection_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_detection_get, __VA_ARGS__)
+#define st1vafe6ax_tap_thresholds_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_thresholds_set, __VA_ARGS__)
+#define st1vafe6ax_tap_thresholds_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_thresholds_get, __VA_ARGS__)
+#define st1vafe6ax_tap_axis_priority_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_axis_priority_set, __VA_ARGS__)
+#define st1vafe6ax_tap_axis_priority_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_axis_priority_get, __VA_ARGS__)
+#define st1vafe6ax_tap_time_windows_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_time_windows_set, __VA_ARGS__)
+#define st1vafe6ax_tap_time_windows_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_time_windows_get, __VA_ARGS__)
+#define st1vafe6ax_tap_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_mode_set, __VA_ARGS__)
+#define st1vafe6ax_tap_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tap_mode_get, __VA_ARGS__)
+#define st1vafe6ax_6d_threshold_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_6d_threshold_set, __VA_ARGS__)
+#define st1vafe6ax_6d_threshold_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_6d_threshold_get, __VA_ARGS__)
+#define st1vafe6ax_ff_time_windows_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ff_time_windows_set, __VA_ARGS__)
+#define st1vafe6ax_ff_time_windows_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ff_time_windows_get, __VA_ARGS__)
+#define st1vafe6ax_ff_thresholds_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ff_thresholds_set, __VA_ARGS__)
+#define st1vafe6ax_ff_thresholds_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ff_thresholds_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_watermark_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_watermark_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_watermark_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_watermark_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_xl_dual_fsm_batch_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_xl_dual_fsm_batch_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_xl_dual_fsm_batch_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_xl_dual_fsm_batch_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_compress_algo_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_compress_algo_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_compress_algo_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_compress_algo_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_virtual_sens_odr_chg_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_virtual_sens_odr_chg_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_virtual_sens_odr_chg_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_virtual_sens_odr_chg_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_compress_algo_real_time_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_compress_algo_real_time_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_compress_algo_real_time_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_compress_algo_real_time_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_stop_on_wtm_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_stop_on_wtm_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_stop_on_wtm_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_stop_on_wtm_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_xl_batch_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_xl_batch_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_xl_batch_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_xl_batch_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_gy_batch_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_gy_batch_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_gy_batch_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_gy_batch_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_mode_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_mode_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_temp_batch_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_temp_batch_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_temp_batch_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_temp_batch_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_timestamp_batch_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_timestamp_batch_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_timestamp_batch_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_timestamp_batch_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_batch_counter_threshold_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_batch_counter_threshold_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_batch_counter_threshold_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_batch_counter_threshold_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_batch_ah_bio_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_batch_ah_bio_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_batch_ah_bio_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_batch_ah_bio_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_batch_cnt_event_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_batch_cnt_event_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_batch_cnt_event_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_batch_cnt_event_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_sflp_batch_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_sflp_batch_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_sflp_batch_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_sflp_batch_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_status_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_status_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_out_raw_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_out_raw_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_out_raw_burst_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_out_raw_burst_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_stpcnt_batch_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_stpcnt_batch_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_stpcnt_batch_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_stpcnt_batch_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_mlc_batch_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_mlc_batch_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_mlc_batch_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_mlc_batch_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_mlc_filt_batch_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_mlc_filt_batch_set, __VA_ARGS__)
+#define st1vafe6ax_fifo_mlc_filt_batch_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_mlc_filt_batch_get, __VA_ARGS__)
+#define st1vafe6ax_stpcnt_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_stpcnt_mode_set, __VA_ARGS__)
+#define st1vafe6ax_stpcnt_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_stpcnt_mode_get, __VA_ARGS__)
+#define st1vafe6ax_stpcnt_steps_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_stpcnt_steps_get, __VA_ARGS__)
+#define st1vafe6ax_stpcnt_rst_step_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_stpcnt_rst_step_set, __VA_ARGS__)
+#define st1vafe6ax_stpcnt_rst_step_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_stpcnt_rst_step_get, __VA_ARGS__)
+#define st1vafe6ax_stpcnt_debounce_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_stpcnt_debounce_set, __VA_ARGS__)
+#define st1vafe6ax_stpcnt_debounce_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_stpcnt_debounce_get, __VA_ARGS__)
+#define st1vafe6ax_stpcnt_period_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_stpcnt_period_set, __VA_ARGS__)
+#define st1vafe6ax_stpcnt_period_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_stpcnt_period_get, __VA_ARGS__)
+#define st1vafe6ax_sigmot_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_sigmot_mode_set, __VA_ARGS__)
+#define st1vafe6ax_sigmot_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_sigmot_mode_get, __VA_ARGS__)
+#define st1vafe6ax_tilt_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tilt_mode_set, __VA_ARGS__)
+#define st1vafe6ax_tilt_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_tilt_mode_get, __VA_ARGS__)
+#define st1vafe6ax_sflp_game_rotation_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_sflp_game_rotation_set, __VA_ARGS__)
+#define st1vafe6ax_sflp_game_rotation_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_sflp_game_rotation_get, __VA_ARGS__)
+#define st1vafe6ax_sflp_game_gbias_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_sflp_game_gbias_set, __VA_ARGS__)
+#define st1vafe6ax_sflp_configure(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_sflp_configure, __VA_ARGS__)
+#define st1vafe6ax_sflp_data_rate_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_sflp_data_rate_set, __VA_ARGS__)
+#define st1vafe6ax_sflp_data_rate_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_sflp_data_rate_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_permission_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_permission_set, __VA_ARGS__)
+#define st1vafe6ax_fsm_permission_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_permission_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_permission_status(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_permission_status, __VA_ARGS__)
+#define st1vafe6ax_fsm_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_mode_set, __VA_ARGS__)
+#define st1vafe6ax_fsm_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_mode_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_long_cnt_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_long_cnt_set, __VA_ARGS__)
+#define st1vafe6ax_fsm_long_cnt_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_long_cnt_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_out_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_out_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_data_rate_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_data_rate_set, __VA_ARGS__)
+#define st1vafe6ax_fsm_data_rate_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_data_rate_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_long_cnt_timeout_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_long_cnt_timeout_set, __VA_ARGS__)
+#define st1vafe6ax_fsm_long_cnt_timeout_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_long_cnt_timeout_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_number_of_programs_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_number_of_programs_set, __VA_ARGS__)
+#define st1vafe6ax_fsm_number_of_programs_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_number_of_programs_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_start_address_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_start_address_set, __VA_ARGS__)
+#define st1vafe6ax_fsm_start_address_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_start_address_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_load(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_load, __VA_ARGS__)
+#define st1vafe6ax_mlc_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mlc_set, __VA_ARGS__)
+#define st1vafe6ax_mlc_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mlc_get, __VA_ARGS__)
+#define st1vafe6ax_mlc_data_rate_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mlc_data_rate_set, __VA_ARGS__)
+#define st1vafe6ax_mlc_data_rate_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mlc_data_rate_get, __VA_ARGS__)
+#define st1vafe6ax_mlc_out_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mlc_out_get, __VA_ARGS__)
+#define st1vafe6ax_mlc_bio_sensitivity_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mlc_bio_sensitivity_set, __VA_ARGS__)
+#define st1vafe6ax_mlc_bio_sensitivity_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_mlc_bio_sensitivity_get, __VA_ARGS__)
+#define st1vafe6ax_xl_offset_on_out_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_offset_on_out_set, __VA_ARGS__)
+#define st1vafe6ax_xl_offset_on_out_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_offset_on_out_get, __VA_ARGS__)
+#define st1vafe6ax_xl_offset_mg_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_offset_mg_set, __VA_ARGS__)
+#define st1vafe6ax_xl_offset_mg_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_offset_mg_get, __VA_ARGS__)
+#define st1vafe6ax_xl_offset_ug_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_offset_ug_set, __VA_ARGS__)
+#define st1vafe6ax_xl_offset_ug_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_xl_offset_ug_get, __VA_ARGS__)
+#define st1vafe6ax_ah_bio_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ah_bio_mode_set, __VA_ARGS__)
+#define st1vafe6ax_ah_bio_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ah_bio_mode_get, __VA_ARGS__)
+#define st1vafe6ax_ah_bio_zin_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ah_bio_zin_set, __VA_ARGS__)
+#define st1vafe6ax_ah_bio_zin_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_ah_bio_zin_get, __VA_ARGS__)
+#define st1vafe6ax_fsm_bio_sensitivity_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_bio_sensitivity_set, __VA_ARGS__)
+#define st1vafe6ax_fsm_bio_sensitivity_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fsm_bio_sensitivity_get, __VA_ARGS__)
+#define st1vafe6ax_i3c_reset_mode_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_i3c_reset_mode_set, __VA_ARGS__)
+#define st1vafe6ax_i3c_reset_mode_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_i3c_reset_mode_get, __VA_ARGS__)
+#define st1vafe6ax_dispatch_init(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_dispatch_init, __VA_ARGS__)
+#define st1vafe6ax_dispatch_route_update(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_dispatch_route_update, __VA_ARGS__)
+#define st1vafe6ax_dispatch_run(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_dispatch_run, __VA_ARGS__)
+#define st1vafe6ax_async_transport_set(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_async_transport_set, __VA_ARGS__)
+#define st1vafe6ax_async_busy_get(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_async_busy_get, __VA_ARGS__)
+#define st1vafe6ax_fifo_status_get_async(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_status_get_async, __VA_ARGS__)
+#define st1vafe6ax_fifo_out_raw_burst_get_async(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_fifo_out_raw_burst_get_async, __VA_ARGS__)
+#define st1vafe6ax_angular_rate_raw_get_async(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_angular_rate_raw_get_async, __VA_ARGS__)
+#define st1vafe6ax_acceleration_raw_get_async(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_acceleration_raw_get_async, __VA_ARGS__)
+#define st1vafe6ax_all_sources_get_async(...) \
+  ST1VAFE6AX_INSTR_CALL(st1vafe6ax_all_sources_get_async, __VA_ARGS__)
+#define st1vafe6ax_async_complete(...) \
+  (st1vafe6ax_instr_enter("st1vafe6ax_async_complete"), \
+   (st1vafe6ax_async_complete)(__VA_ARGS__), (void)st1vafe6ax_instr_leave(0))
+#endif /* ST1VAFE6AX_INSTRUMENTATION */
+
 /**
   * @}
   *
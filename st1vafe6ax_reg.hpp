@@ -0,0 +1,253 @@
+/**
+  ******************************************************************************
+  * @file    st1vafe6ax_reg.hpp
+  * @author  Sensors Software Solution Team
+  * @brief   Header-only C++ layer on top of the st1vafe6ax_reg.c driver,
+  *          with the full scale selected at compile time.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef ST1VAFE6AX_REGS_HPP
+#define ST1VAFE6AX_REGS_HPP
+
+/* Includes ------------------------------------------------------------------*/
+#include "st1vafe6ax_reg.h"
+
+/** @addtogroup ST1VAFE6AX
+  * @{
+  *
+  */
+
+namespace st1vafe6ax
+{
+
+/** @defgroup  Sensitivity traits
+  * @brief     Sensitivity of each full scale, usable in constant
+  *            expressions. Values are the same used by the st1vafe6ax_from_*
+  *            C functions, which remain the reference implementation.
+  * @{
+  *
+  */
+
+template <st1vafe6ax_xl_full_scale_t FS> struct xl_sensitivity;
+
+template <> struct xl_sensitivity<ST1VAFE6AX_2g>
+{
+  static constexpr float_t mg = 0.061f;
+  static constexpr int32_t ug = 61;
+};
+
+template <> struct xl_sensitivity<ST1VAFE6AX_4g>
+{
+  static constexpr float_t mg = 0.122f;
+  static constexpr int32_t ug = 122;
+};
+
+template <> struct xl_sensitivity<ST1VAFE6AX_8g>
+{
+  static constexpr float_t mg = 0.244f;
+  static constexpr int32_t ug = 244;
+};
+
+template <st1vafe6ax_gy_full_scale_t FS> struct gy_sensitivity;
+
+template <> struct gy_sensitivity<ST1VAFE6AX_125dps>
+{
+  static constexpr float_t mdps = 4.375f;
+  static constexpr int32_t udps = 4375;
+};
+
+template <> struct gy_sensitivity<ST1VAFE6AX_250dps>
+{
+  static constexpr float_t mdps = 8.750f;
+  static constexpr int32_t udps = 8750;
+};
+
+template <> struct gy_sensitivity<ST1VAFE6AX_500dps>
+{
+  static constexpr float_t mdps = 17.50f;
+  static constexpr int32_t udps = 17500;
+};
+
+template <> struct gy_sensitivity<ST1VAFE6AX_1000dps>
+{
+  static constexpr float_t mdps = 35.0f;
+  static constexpr int32_t udps = 35000;
+};
+
+template <> struct gy_sensitivity<ST1VAFE6AX_2000dps>
+{
+  static constexpr float_t mdps = 70.0f;
+  static constexpr int32_t udps = 70000;
+};
+
+template <> struct gy_sensitivity<ST1VAFE6AX_4000dps>
+{
+  static constexpr float_t mdps = 140.0f;
+  static constexpr int32_t udps = 140000;
+};
+
+/* float and fixed-point sensitivities of a full scale must agree */
+template <typename T> constexpr bool sensitivity_match(float_t f, T i)
+{
+  return static_cast<T>((f * 1000.0f) + 0.5f) == i;
+}
+
+static_assert(sensitivity_match(xl_sensitivity<ST1VAFE6AX_2g>::mg,
+                                xl_sensitivity<ST1VAFE6AX_2g>::ug), "2g");
+static_assert(sensitivity_match(xl_sensitivity<ST1VAFE6AX_4g>::mg,
+                                xl_sensitivity<ST1VAFE6AX_4g>::ug), "4g");
+static_assert(sensitivity_match(xl_sensitivity<ST1VAFE6AX_8g>::mg,
+                                xl_sensitivity<ST1VAFE6AX_8g>::ug), "8g");
+static_assert(sensitivity_match(gy_sensitivity<ST1VAFE6AX_125dps>::mdps,
+                                gy_sensitivity<ST1VAFE6AX_125dps>::udps), "125dps");
+static_assert(sensitivity_match(gy_sensitivity<ST1VAFE6AX_250dps>::mdps,
+                                gy_sensitivity<ST1VAFE6AX_250dps>::udps), "250dps");
+static_assert(sensitivity_match(gy_sensitivity<ST1VAFE6AX_500dps>::mdps,
+                                gy_sensitivity<ST1VAFE6AX_500dps>::udps), "500dps");
+static_assert(sensitivity_match(gy_sensitivity<ST1VAFE6AX_1000dps>::mdps,
+                                gy_sensitivity<ST1VAFE6AX_1000dps>::udps), "1000dps");
+static_assert(sensitivity_match(gy_sensitivity<ST1VAFE6AX_2000dps>::mdps,
+                                gy_sensitivity<ST1VAFE6AX_2000dps>::udps), "2000dps");
+static_assert(sensitivity_match(gy_sensitivity<ST1VAFE6AX_4000dps>::mdps,
+                                gy_sensitivity<ST1VAFE6AX_4000dps>::udps), "4000dps");
+
+/**
+  * @}
+  *
+  */
+
+/** @defgroup  Conversions
+  * @brief     Inline / constexpr conversions, same expressions as the
+  *            st1vafe6ax_from_* C functions.
+  * @{
+  *
+  */
+
+template <st1vafe6ax_xl_full_scale_t FS>
+constexpr float_t xl_to_mg(int16_t lsb)
+{
+  return static_cast<float_t>(lsb) * xl_sensitivity<FS>::mg;
+}
+
+template <st1vafe6ax_xl_full_scale_t FS>
+constexpr int32_t xl_to_ug(int16_t lsb)
+{
+  return static_cast<int32_t>(lsb) * xl_sensitivity<FS>::ug;
+}
+
+template <st1vafe6ax_gy_full_scale_t FS>
+constexpr float_t gy_to_mdps(int16_t lsb)
+{
+  return static_cast<float_t>(lsb) * gy_sensitivity<FS>::mdps;
+}
+
+template <st1vafe6ax_gy_full_scale_t FS>
+constexpr int64_t gy_to_udps(int16_t lsb)
+{
+  return static_cast<int64_t>(lsb) * gy_sensitivity<FS>::udps;
+}
+
+constexpr float_t sflp_to_mg(int16_t lsb)
+{
+  return static_cast<float_t>(lsb) * 0.061f;
+}
+
+constexpr float_t lsb_to_celsius(int16_t lsb)
+{
+  return (static_cast<float_t>(lsb) / 256.0f) + 25.0f;
+}
+
+constexpr float_t lsb_to_mv(int16_t lsb)
+{
+  return static_cast<float_t>(lsb) / 78.0f;
+}
+
+constexpr uint64_t lsb_to_nsec(uint32_t lsb)
+{
+  return static_cast<uint64_t>(lsb) * 21750u;
+}
+
+template <st1vafe6ax_xl_full_scale_t FS>
+inline void xl_to_mg(const int16_t *lsb, float_t *mg, uint32_t num)
+{
+  for (uint32_t i = 0U; i < num; i++)
+  {
+    mg[i] = xl_to_mg<FS>(lsb[i]);
+  }
+}
+
+template <st1vafe6ax_gy_full_scale_t FS>
+inline void gy_to_mdps(const int16_t *lsb, float_t *mdps, uint32_t num)
+{
+  for (uint32_t i = 0U; i < num; i++)
+  {
+    mdps[i] = gy_to_mdps<FS>(lsb[i]);
+  }
+}
+
+/**
+  * @}
+  *
+  */
+
+/** @defgroup  Memory bank session
+  * @brief     Scoped st1vafe6ax_mem_bank_session_enter() / _exit().
+  * @{
+  *
+  */
+
+class mem_bank_session
+{
+public:
+  mem_bank_session(const stmdev_ctx_t *ctx, st1vafe6ax_mem_bank_t val)
+    : ctx_(ctx), ret_(st1vafe6ax_mem_bank_session_enter(ctx, val))
+  {
+  }
+
+  ~mem_bank_session()
+  {
+    if (ret_ == 0)
+    {
+      (void)st1vafe6ax_mem_bank_session_exit(ctx_);
+    }
+  }
+
+  mem_bank_session(const mem_bank_session &) = delete;
+  mem_bank_session &operator=(const mem_bank_session &) = delete;
+
+  /* result of st1vafe6ax_mem_bank_session_enter() */
+  int32_t status() const
+  {
+    return ret_;
+  }
+
+private:
+  const stmdev_ctx_t *ctx_;
+  int32_t ret_;
+};
+
+/**
+  * @}
+  *
+  */
+
+} /* namespace st1vafe6ax */
+
+/**
+  * @}
+  *
+  */
+
+#endif /* ST1VAFE6AX_REGS_HPP */
@@ -0,0 +1,387 @@
+/**
+  ******************************************************************************
+  * @file    st1vafe6ax_bench.c
+  * @author  Sensors Software Solution Team
+  * @brief   Host benchmark of the st1vafe6ax_reg.c hot paths, run against
+  *          the register-map simulator. Results are printed as JSON.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "st1vafe6ax_sim.h"
+#include "st1vafe6ax_trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/*
+ * Usage: st1vafe6ax_bench [scale]
+ *
+ * scale (default 1) multiplies the number of iterations. Bus costs
+ * (transactions, bytes, bus time) and the FIFO drain rate come from the
+ * simulator and do not depend on the host; host times of the bus operations
+ * include the simulator.
+ */
+
+#define BENCH_FIFO_DRAINS                        200U
+#define BENCH_DECODE_WORDS                       512U
+#define BENCH_DECODE_REPS                        2000U
+#define BENCH_CONV_SAMPLES                       4096U
+#define BENCH_CONV_REPS                          500U
+#define BENCH_CONFIG_REPS                        200U
+
+typedef int32_t (*bench_op_t)(const stmdev_ctx_t *ctx, uint32_t i);
+
+static st1vafe6ax_sim_t sim;
+static stmdev_ctx_t ctx;
+static uint32_t scale = 1U;
+
+/* Results are accumulated here, so that the benchmarked code is not dropped */
+static volatile float_t sink_f;
+static volatile int64_t sink_i;
+
+static st1vafe6ax_fifo_out_raw_t fifo[ST1VAFE6AX_SIM_FIFO_WORDS + 1U];
+static uint8_t raw[BENCH_DECODE_WORDS * 7U];
+static int16_t lsb[BENCH_CONV_SAMPLES];
+static float_t out_f[BENCH_CONV_SAMPLES];
+static int32_t out_i32[BENCH_CONV_SAMPLES];
+static int64_t out_i64[BENCH_CONV_SAMPLES];
+
+static uint64_t now_ns(void)
+{
+  return st1vafe6ax_trace_clock_monotonic(NULL);
+}
+
+static void sim_reset(void)
+{
+  st1vafe6ax_sim_init(&sim);
+  st1vafe6ax_sim_ctx_init(&sim, &ctx);
+}
+
+/* FIFO: accelerometer and gyroscope at 3840 Hz, both batched, stream mode */
+static int32_t fifo_setup(void)
+{
+  int32_t ret;
+
+  sim_reset();
+  ret = st1vafe6ax_xl_data_rate_set(&ctx, ST1VAFE6AX_XL_ODR_AT_3840Hz);
+  ret += st1vafe6ax_gy_data_rate_set(&ctx, ST1VAFE6AX_GY_ODR_AT_3840Hz);
+  ret += st1vafe6ax_fifo_xl_batch_set(&ctx, ST1VAFE6AX_XL_BATCHED_AT_3840Hz);
+  ret += st1vafe6ax_fifo_gy_batch_set(&ctx, ST1VAFE6AX_GY_BATCHED_AT_3840Hz);
+  ret += st1vafe6ax_fifo_mode_set(&ctx, ST1VAFE6AX_STREAM_MODE);
+
+  return ret;
+}
+
+/*
+ * Drain a (nearly) full FIFO, with bursts or one word at a time. Rates and
+ * per word costs are taken over all the drains: words_per_s is bounded by
+ * the simulated bus time, host_ns_per_word is the host time spent in the
+ * driver and in the simulator.
+ */
+static int32_t bench_fifo_drain(uint8_t burst, const char *name)
+{
+  st1vafe6ax_fifo_status_t status;
+  st1vafe6ax_sim_stats_t stats;
+  uint64_t host_ns = 0U;
+  uint64_t bus_ns = 0U;
+  uint64_t xfers = 0U;
+  uint64_t words = 0U;
+  uint64_t t0;
+  uint32_t i;
+  uint16_t n;
+  uint16_t k;
+  int32_t ret;
+
+  ret = fifo_setup();
+
+  for (i = 0U; (ret == 0) && (i < (BENCH_FIFO_DRAINS * scale)); i++)
+  {
+    /* 500 words at 7680 words/s, accounting for the drain time */
+    st1vafe6ax_sim_advance(&sim, 60000000U);
+    st1vafe6ax_sim_stats_reset(&sim);
+
+    t0 = now_ns();
+    if (burst == 1U)
+    {
+      ret = st1vafe6ax_fifo_out_raw_burst_get(&ctx, fifo, ST1VAFE6AX_SIM_FIFO_WORDS, &n);
+    }
+    else
+    {
+      ret = st1vafe6ax_fifo_status_get(&ctx, &status);
+      n = status.fifo_level;
+      for (k = 0U; (ret == 0) && (k < n); k++)
+      {
+        ret = st1vafe6ax_fifo_out_raw_get(&ctx, &fifo[k]);
+      }
+    }
+    host_ns += now_ns() - t0;
+
+    st1vafe6ax_sim_stats_get(&sim, &stats);
+    xfers += (uint64_t)stats.rd_count + stats.wr_count;
+    bus_ns += stats.bus_ns;
+    words += n;
+    sink_i += fifo[0].data[0];
+  }
+
+  printf("    \"%s\": { \"words\": %llu, \"words_per_s\": %.0f, "
+         "\"xfers_per_word\": %.4f, \"bus_ns_per_word\": %.1f, "
+         "\"host_ns_per_word\": %.1f }",
+         name, (unsigned long long)words,
+         (bus_ns != 0U) ? ((double)words * 1e9 / (double)bus_ns) : 0.0,
+         (words != 0U) ? ((double)xfers / (double)words) : 0.0,
+         (words != 0U) ? ((double)bus_ns / (double)words) : 0.0,
+         (words != 0U) ? ((double)host_ns / (double)words) : 0.0);
+
+  return ret;
+}
+
+static void bench_fifo_decode(void)
+{
+  uint64_t t0;
+  uint64_t host_ns;
+  uint32_t i;
+
+  for (i = 0U; i < (BENCH_DECODE_WORDS * 7U); i++)
+  {
+    raw[i] = ((i % 7U) == 0U) ?
+             (uint8_t)((((i / 7U) % 2U) + 1U) << 3) : (uint8_t)i;
+  }
+
+  t0 = now_ns();
+  for (i = 0U; i < (BENCH_DECODE_REPS * scale); i++)
+  {
+    st1vafe6ax_fifo_out_raw_decode(raw, BENCH_DECODE_WORDS, fifo);
+    sink_i += fifo[i % BENCH_DECODE_WORDS].data[1];
+  }
+  host_ns = now_ns() - t0;
+
+  printf("    \"ns_per_word\": %.3f\n",
+         (double)host_ns / ((double)BENCH_DECODE_REPS * scale * BENCH_DECODE_WORDS));
+}
+
+/* ns per converted sample: scalar conversions (id 0..3), arrays (4..8) */
+static double bench_conv(uint8_t id)
+{
+  uint64_t t0;
+  uint32_t r;
+  uint32_t i;
+
+  t0 = now_ns();
+  for (r = 0U; r < (BENCH_CONV_REPS * scale); r++)
+  {
+    switch (id)
+    {
+      case 0:
+        for (i = 0U; i < BENCH_CONV_SAMPLES; i++)
+        {
+          out_f[i] = st1vafe6ax_from_fs2_to_mg(lsb[i]);
+        }
+        break;
+      case 1:
+        for (i = 0U; i < BENCH_CONV_SAMPLES; i++)
+        {
+          out_f[i] = st1vafe6ax_from_fs2000_to_mdps(lsb[i]);
+        }
+        break;
+      case 2:
+        for (i = 0U; i < BENCH_CONV_SAMPLES; i++)
+        {
+          out_f[i] = st1vafe6ax_from_lsb_to_celsius(lsb[i]);
+        }
+        break;
+      case 3:
+        for (i = 0U; i < BENCH_CONV_SAMPLES; i++)
+        {
+          out_i32[i] = st1vafe6ax_from_fs2_to_ug(lsb[i]);
+        }
+        break;
+      case 4:
+        (void)st1vafe6ax_from_xl_lsb_to_mg_array(ST1VAFE6AX_2g, lsb, out_f,
+                                                 BENCH_CONV_SAMPLES);
+        break;
+      case 5:
+        (void)st1vafe6ax_from_gy_lsb_to_mdps_array(ST1VAFE6AX_2000dps, lsb, out_f,
+                                                   BENCH_CONV_SAMPLES);
+        break;
+      case 6:
+        st1vafe6ax_from_lsb_to_celsius_array(lsb, out_f, BENCH_CONV_SAMPLES);
+        break;
+      case 7:
+        (void)st1vafe6ax_from_xl_lsb_to_ug_array(ST1VAFE6AX_2g, lsb, out_i32,
+                                                 BENCH_CONV_SAMPLES);
+        break;
+      default:
+        (void)st1vafe6ax_from_gy_lsb_to_udps_array(ST1VAFE6AX_2000dps, lsb, out_i64,
+                                                   BENCH_CONV_SAMPLES);
+        break;
+    }
+    sink_f += out_f[r % BENCH_CONV_SAMPLES];
+    sink_i += out_i32[r % BENCH_CONV_SAMPLES] + out_i64[r % BENCH_CONV_SAMPLES];
+  }
+
+  return (double)(now_ns() - t0) / ((double)BENCH_CONV_REPS * scale * BENCH_CONV_SAMPLES);
+}
+
+static void bench_conversions(void)
+{
+  static const char *const name[] =
+  {
+    "from_fs2_to_mg", "from_fs2000_to_mdps", "from_lsb_to_celsius",
+    "from_fs2_to_ug", "from_xl_lsb_to_mg_array", "from_gy_lsb_to_mdps_array",
+    "from_lsb_to_celsius_array", "from_xl_lsb_to_ug_array",
+    "from_gy_lsb_to_udps_array",
+  };
+  uint8_t id;
+  uint32_t i;
+
+  srand(1U);
+  for (i = 0U; i < BENCH_CONV_SAMPLES; i++)
+  {
+    lsb[i] = (int16_t)((rand() % 65536) - 32768);
+  }
+
+  for (id = 0U; id < (sizeof(name) / sizeof(name[0])); id++)
+  {
+    printf("    \"%s\": { \"ns_per_sample\": %.3f }%s\n", name[id], bench_conv(id),
+           ((id + 1U) < (sizeof(name) / sizeof(name[0]))) ? "," : "");
+  }
+}
+
+/* Every other call routes a different set of signals */
+static int32_t op_pin_int1_route_set(const stmdev_ctx_t *c, uint32_t i)
+{
+  st1vafe6ax_pin_int_route_t route = {0};
+
+  route.fifo_th = 1U;
+  route.double_tap = ((i & 1U) == 0U) ? 1U : 0U;
+  route.fsm1 = ((i & 1U) == 0U) ? 0U : 1U;
+
+  return st1vafe6ax_pin_int1_route_set(c, route);
+}
+
+static int32_t op_ln_pg_write(const stmdev_ctx_t *c, uint32_t i)
+{
+  uint8_t buf[256];
+  uint32_t k;
+
+  for (k = 0U; k < sizeof(buf); k++)
+  {
+    buf[k] = (uint8_t)(k + i);
+  }
+
+  return st1vafe6ax_ln_pg_write(c, 0x200U, buf, (uint16_t)sizeof(buf));
+}
+
+static int32_t op_sflp_game_gbias_set(const stmdev_ctx_t *c, uint32_t i)
+{
+  st1vafe6ax_sflp_gbias_t gbias;
+
+  gbias.gbias_x = (float_t)(i % 8U);
+  gbias.gbias_y = -1.5f;
+  gbias.gbias_z = 0.25f;
+
+  return st1vafe6ax_sflp_game_gbias_set(c, &gbias);
+}
+
+static int32_t op_all_sources_get(const stmdev_ctx_t *c, uint32_t i)
+{
+  st1vafe6ax_all_sources_t val;
+  int32_t ret;
+
+  (void)i;
+  ret = st1vafe6ax_all_sources_get(c, &val);
+  sink_i += val.fifo_th;
+
+  return ret;
+}
+
+/* Average bus and host cost of one call of an API sequence */
+static int32_t bench_op(const char *name, bench_op_t op, uint8_t last)
+{
+  st1vafe6ax_sim_stats_t stats;
+  uint64_t host_ns;
+  uint64_t t0;
+  uint32_t reps = BENCH_CONFIG_REPS * scale;
+  uint32_t i;
+  int32_t ret = 0;
+
+  sim_reset();
+  ret = op(&ctx, 0U);
+  st1vafe6ax_sim_stats_reset(&sim);
+
+  t0 = now_ns();
+  for (i = 1U; (ret == 0) && (i <= reps); i++)
+  {
+    ret = op(&ctx, i);
+  }
+  host_ns = now_ns() - t0;
+
+  st1vafe6ax_sim_stats_get(&sim, &stats);
+
+  printf("    \"%s\": { \"xfers\": %.2f, \"reads\": %.2f, \"writes\": %.2f, "
+         "\"bytes\": %.2f, \"bank_switches\": %.2f, \"bus_ns\": %.0f, "
+         "\"host_ns\": %.0f }%s\n", name,
+         (double)(stats.rd_count + stats.wr_count) / reps,
+         (double)stats.rd_count / reps, (double)stats.wr_count / reps,
+         (double)(stats.rd_bytes + stats.wr_bytes) / reps,
+         (double)stats.bank_switch / reps, (double)stats.bus_ns / reps,
+         (double)host_ns / reps, (last == 1U) ? "" : ",");
+
+  return ret;
+}
+
+int main(int argc, char **argv)
+{
+  int32_t ret;
+
+  if (argc > 1)
+  {
+    scale = (uint32_t)strtoul(argv[1], NULL, 0);
+    scale = (scale == 0U) ? 1U : scale;
+  }
+
+  sim_reset();
+
+  printf("{\n  \"device\": \"st1vafe6ax\",\n  \"scale\": %lu,\n",
+         (unsigned long)scale);
+  printf("  \"bus\": { \"xfer_ns\": %lu, \"byte_ns\": %lu },\n",
+         (unsigned long)sim.xfer_ns, (unsigned long)sim.byte_ns);
+
+  printf("  \"fifo_drain\": {\n");
+  ret = bench_fifo_drain(1U, "burst");
+  printf(",\n");
+  ret += bench_fifo_drain(0U, "single");
+  printf("\n  },\n");
+
+  printf("  \"fifo_decode\": {\n");
+  bench_fifo_decode();
+  printf("  },\n");
+
+  printf("  \"conversion\": {\n");
+  bench_conversions();
+  printf("  },\n");
+
+  printf("  \"config\": {\n");
+  ret += bench_op("pin_int1_route_set", op_pin_int1_route_set, 0U);
+  ret += bench_op("ln_pg_write_256", op_ln_pg_write, 0U);
+  ret += bench_op("sflp_game_gbias_set", op_sflp_game_gbias_set, 1U);
+  printf("  },\n");
+
+  printf("  \"sources\": {\n");
+  ret += bench_op("all_sources_get", op_all_sources_get, 1U);
+  printf("  },\n");
+
+  printf("  \"status\": %ld\n}\n", (long)ret);
+
+  return (ret == 0) ? 0 : 1;
+}
@@ -0,0 +1,94 @@
+/**
+  ******************************************************************************
+  * @file    st1vafe6ax_hpp_check.cpp
+  * @author  Sensors Software Solution Team
+  * @brief   Host check of the st1vafe6ax_reg.hpp conversions against the
+  *          st1vafe6ax_from_* C functions, over the whole int16 range.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "st1vafe6ax_reg.hpp"
+
+#include <cstdio>
+#include <cstring>
+
+/* Usage: st1vafe6ax_hpp_check, exit status 0 if every conversion matches */
+
+static uint32_t mismatch;
+
+/* Results must be bit-exact: both sides evaluate the same expression */
+template <typename T>
+static void check(const char *name, int32_t lsb, T cpp, T c)
+{
+  if (std::memcmp(&cpp, &c, sizeof(T)) != 0)
+  {
+    if (mismatch < 16U)
+    {
+      std::printf("%s(%ld) mismatch\n", name, static_cast<long>(lsb));
+    }
+    mismatch++;
+  }
+}
+
+int main()
+{
+  using namespace st1vafe6ax;
+
+  for (int32_t i = INT16_MIN; i <= INT16_MAX; i++)
+  {
+    const int16_t lsb = static_cast<int16_t>(i);
+
+    check("xl_to_mg<2g>", i, xl_to_mg<ST1VAFE6AX_2g>(lsb), st1vafe6ax_from_fs2_to_mg(lsb));
+    check("xl_to_mg<4g>", i, xl_to_mg<ST1VAFE6AX_4g>(lsb), st1vafe6ax_from_fs4_to_mg(lsb));
+    check("xl_to_mg<8g>", i, xl_to_mg<ST1VAFE6AX_8g>(lsb), st1vafe6ax_from_fs8_to_mg(lsb));
+    check("xl_to_ug<2g>", i, xl_to_ug<ST1VAFE6AX_2g>(lsb), st1vafe6ax_from_fs2_to_ug(lsb));
+    check("xl_to_ug<4g>", i, xl_to_ug<ST1VAFE6AX_4g>(lsb), st1vafe6ax_from_fs4_to_ug(lsb));
+    check("xl_to_ug<8g>", i, xl_to_ug<ST1VAFE6AX_8g>(lsb), st1vafe6ax_from_fs8_to_ug(lsb));
+
+    check("gy_to_mdps<125dps>", i, gy_to_mdps<ST1VAFE6AX_125dps>(lsb),
+          st1vafe6ax_from_fs125_to_mdps(lsb));
+    check("gy_to_mdps<250dps>", i, gy_to_mdps<ST1VAFE6AX_250dps>(lsb),
+          st1vafe6ax_from_fs250_to_mdps(lsb));
+    check("gy_to_mdps<500dps>", i, gy_to_mdps<ST1VAFE6AX_500dps>(lsb),
+          st1vafe6ax_from_fs500_to_mdps(lsb));
+    check("gy_to_mdps<1000dps>", i, gy_to_mdps<ST1VAFE6AX_1000dps>(lsb),
+          st1vafe6ax_from_fs1000_to_mdps(lsb));
+    check("gy_to_mdps<2000dps>", i, gy_to_mdps<ST1VAFE6AX_2000dps>(lsb),
+          st1vafe6ax_from_fs2000_to_mdps(lsb));
+    check("gy_to_mdps<4000dps>", i, gy_to_mdps<ST1VAFE6AX_4000dps>(lsb),
+          st1vafe6ax_from_fs4000_to_mdps(lsb));
+    check("gy_to_udps<125dps>", i, gy_to_udps<ST1VAFE6AX_125dps>(lsb),
+          st1vafe6ax_from_fs125_to_udps(lsb));
+    check("gy_to_udps<250dps>", i, gy_to_udps<ST1VAFE6AX_250dps>(lsb),
+          st1vafe6ax_from_fs250_to_udps(lsb));
+    check("gy_to_udps<500dps>", i, gy_to_udps<ST1VAFE6AX_500dps>(lsb),
+          st1vafe6ax_from_fs500_to_udps(lsb));
+    check("gy_to_udps<1000dps>", i, gy_to_udps<ST1VAFE6AX_1000dps>(lsb),
+          st1vafe6ax_from_fs1000_to_udps(lsb));
+    check("gy_to_udps<2000dps>", i, gy_to_udps<ST1VAFE6AX_2000dps>(lsb),
+          st1vafe6ax_from_fs2000_to_udps(lsb));
+    check("gy_to_udps<4000dps>", i, gy_to_udps<ST1VAFE6AX_4000dps>(lsb),
+          st1vafe6ax_from_fs4000_to_udps(lsb));
+
+    check("sflp_to_mg", i, sflp_to_mg(lsb), st1vafe6ax_from_sflp_to_mg(lsb));
+    check("lsb_to_celsius", i, lsb_to_celsius(lsb), st1vafe6ax_from_lsb_to_celsius(lsb));
+    check("lsb_to_mv", i, lsb_to_mv(lsb), st1vafe6ax_from_lsb_to_mv(lsb));
+    check("lsb_to_nsec", i, lsb_to_nsec(static_cast<uint32_t>(i) << 16),
+          st1vafe6ax_from_lsb_to_nsec(static_cast<uint32_t>(i) << 16));
+  }
+
+  std::printf("st1vafe6ax_reg.hpp conversions: %lu mismatch(es)\n",
+              static_cast<unsigned long>(mismatch));
+
+  return (mismatch == 0U) ? 0 : 1;
+}
@@ -0,0 +1,287 @@
+/**
+  ******************************************************************************
+  * @file    st1vafe6ax_route_check.c
+  * @author  Sensors Software Solution Team
+  * @brief   Host check of st1vafe6ax_pin_int1/2_route_set(): random route
+  *          updates applied to two simulated devices, one driven without
+  *          private data and one with the register shadow (and the
+  *          interrupt route cache) enabled, must give the same registers.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "st1vafe6ax_sim.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/*
+ * Usage: st1vafe6ax_route_check [updates] [seed], exit status 0 if both
+ * devices always match.
+ *
+ * Each step changes a few routes of one pin (step counter overflow
+ * included); one step in sixteen instead writes PEDO_CMD_REG, an embedded
+ * bank route register or CTRL3.sw_reset behind the route cache. After each
+ * step the register maps (main, embedded, pages) of the two devices are
+ * compared, and the embedded routes read back with route_get must be the
+ * ones last requested on that pin.
+ */
+
+#define ROUTE_CHECK_UPDATES                      3000U
+#define ROUTE_CHECK_FIELDS                       33U
+
+static st1vafe6ax_sim_t sim_ref;
+static st1vafe6ax_sim_t sim_dut;
+static stmdev_ctx_t ctx_ref;
+static stmdev_ctx_t ctx_dut;
+static st1vafe6ax_priv_t priv;
+static uint32_t rnd = 0x2545F491U;
+static uint32_t mismatch;
+
+static uint32_t rnd_next(void)
+{
+  rnd ^= rnd << 13;
+  rnd ^= rnd >> 17;
+  rnd ^= rnd << 5;
+
+  return rnd;
+}
+
+/* Route with field k taken from bit k of bits */
+static st1vafe6ax_pin_int_route_t route_from_bits(uint64_t bits)
+{
+  st1vafe6ax_pin_int_route_t r;
+  uint8_t b[ROUTE_CHECK_FIELDS];
+  uint8_t k;
+
+  for (k = 0U; k < ROUTE_CHECK_FIELDS; k++)
+  {
+    b[k] = (uint8_t)((bits >> k) & 1U);
+  }
+
+  r.drdy_xl = b[0];
+  r.drdy_gy = b[1];
+  r.drdy_ah_bio = b[2];
+  r.fifo_th = b[3];
+  r.fifo_ovr = b[4];
+  r.fifo_full = b[5];
+  r.fifo_bdr = b[6];
+  r.timestamp = b[7];
+  r.six_d = b[8];
+  r.double_tap = b[9];
+  r.free_fall = b[10];
+  r.wake_up = b[11];
+  r.single_tap = b[12];
+  r.sleep_change = b[13];
+  r.sleep_status = b[14];
+  r.step_detector = b[15];
+  r.step_count_overflow = b[16];
+  r.tilt = b[17];
+  r.sig_mot = b[18];
+  r.emb_func_stand_by = b[19];
+  r.fsm_lc = b[20];
+  r.fsm1 = b[21];
+  r.fsm2 = b[22];
+  r.fsm3 = b[23];
+  r.fsm4 = b[24];
+  r.fsm5 = b[25];
+  r.fsm6 = b[26];
+  r.fsm7 = b[27];
+  r.fsm8 = b[28];
+  r.mlc1 = b[29];
+  r.mlc2 = b[30];
+  r.mlc3 = b[31];
+  r.mlc4 = b[32];
+
+  return r;
+}
+
+/* Embedded bank routes of a pin, the ones route_get returns as set */
+static uint32_t route_emb_bits(const st1vafe6ax_pin_int_route_t *r)
+{
+  return (uint32_t)r->step_detector | ((uint32_t)r->tilt << 1) |
+         ((uint32_t)r->sig_mot << 2) | ((uint32_t)r->fsm_lc << 3) |
+         ((uint32_t)r->fsm1 << 4) | ((uint32_t)r->fsm2 << 5) |
+         ((uint32_t)r->fsm3 << 6) | ((uint32_t)r->fsm4 << 7) |
+         ((uint32_t)r->fsm5 << 8) | ((uint32_t)r->fsm6 << 9) |
+         ((uint32_t)r->fsm7 << 10) | ((uint32_t)r->fsm8 << 11) |
+         ((uint32_t)r->mlc1 << 12) | ((uint32_t)r->mlc2 << 13) |
+         ((uint32_t)r->mlc3 << 14) | ((uint32_t)r->mlc4 << 15) |
+         ((uint32_t)r->step_count_overflow << 16);
+}
+
+static void fail(uint32_t step, const char *what)
+{
+  if (mismatch < 16U)
+  {
+    printf("step %lu: %s mismatch\n", (unsigned long)step, what);
+  }
+  mismatch++;
+}
+
+static int32_t route_set(const stmdev_ctx_t *ctx, uint8_t pin,
+                         st1vafe6ax_pin_int_route_t route)
+{
+  return (pin == 1U) ? st1vafe6ax_pin_int1_route_set(ctx, route) :
+         st1vafe6ax_pin_int2_route_set(ctx, route);
+}
+
+static int32_t route_get(const stmdev_ctx_t *ctx, uint8_t pin,
+                         st1vafe6ax_pin_int_route_t *route)
+{
+  return (pin == 1U) ? st1vafe6ax_pin_int1_route_get(ctx, route) :
+         st1vafe6ax_pin_int2_route_get(ctx, route);
+}
+
+/* Register change behind the route cache, made on both devices */
+static int32_t side_write(const stmdev_ctx_t *ctx, uint32_t r)
+{
+  static const uint8_t emb_reg[] =
+  {
+    ST1VAFE6AX_EMB_FUNC_INT1, ST1VAFE6AX_FSM_INT1, ST1VAFE6AX_MLC_INT1,
+    ST1VAFE6AX_EMB_FUNC_INT2, ST1VAFE6AX_FSM_INT2, ST1VAFE6AX_MLC_INT2,
+  };
+  uint8_t val = (uint8_t)(r >> 8);
+  int32_t ret;
+
+  switch (r % 3U)
+  {
+    case 0U:
+      ret = st1vafe6ax_ln_pg_write(ctx, ST1VAFE6AX_PEDO_CMD_REG, &val, 1);
+      break;
+    case 1U:
+      ret = st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_EMBED_FUNC_MEM_BANK);
+      ret += st1vafe6ax_write_reg(ctx, emb_reg[(r >> 16) % sizeof(emb_reg)], &val, 1);
+      ret += st1vafe6ax_mem_bank_set(ctx, ST1VAFE6AX_MAIN_MEM_BANK);
+      break;
+    default:
+      val = 0x05U; /* sw_reset, if_inc */
+      ret = st1vafe6ax_write_reg(ctx, ST1VAFE6AX_CTRL3, &val, 1);
+      break;
+  }
+
+  return ret;
+}
+
+int main(int argc, char **argv)
+{
+  st1vafe6ax_pin_int_route_t get_ref;
+  st1vafe6ax_pin_int_route_t get_dut;
+  st1vafe6ax_pin_int_route_t route;
+  st1vafe6ax_sim_stats_t s0;
+  st1vafe6ax_sim_stats_t s1;
+  uint64_t bits[2] = { 0U, 0U };
+  uint8_t known[2] = { 1U, 1U }; /* routes of the pin not changed behind */
+  uint32_t updates = ROUTE_CHECK_UPDATES;
+  uint32_t cost[2][2] = { { 0U, 0U }, { 0U, 0U } }; /* xfers, bank switches */
+  uint32_t step;
+  uint32_t r;
+  uint8_t pin;
+  uint8_t p;
+  uint8_t k;
+  int32_t ret = 0;
+
+  if (argc > 1)
+  {
+    updates = (uint32_t)strtoul(argv[1], NULL, 0);
+  }
+  if (argc > 2)
+  {
+    rnd = (uint32_t)strtoul(argv[2], NULL, 0);
+    rnd = (rnd == 0U) ? 1U : rnd;
+  }
+
+  st1vafe6ax_sim_init(&sim_ref);
+  st1vafe6ax_sim_init(&sim_dut);
+  st1vafe6ax_sim_ctx_init(&sim_ref, &ctx_ref);
+  st1vafe6ax_sim_ctx_init(&sim_dut, &ctx_dut);
+  ctx_ref.priv_data = NULL;
+  ctx_dut.priv_data = &priv;
+  ret = st1vafe6ax_shadow_set(&ctx_dut, PROPERTY_ENABLE);
+
+  for (step = 0U; (ret == 0) && (step < updates); step++)
+  {
+    r = rnd_next();
+    pin = (uint8_t)(1U + (r & 1U));
+
+    if (((r >> 1) & 0x0FU) == 0U)
+    {
+      r = rnd_next();
+      ret = side_write(&ctx_ref, r);
+      ret += side_write(&ctx_dut, r);
+      known[0] = ((r % 3U) == 2U) ? 1U : 0U;
+      known[1] = known[0];
+      if ((r % 3U) == 2U)
+      {
+        bits[0] = 0U;
+        bits[1] = 0U;
+      }
+    }
+    else
+    {
+      /* a few routes change: about two fields out of 33 */
+      for (k = 0U; k < ROUTE_CHECK_FIELDS; k++)
+      {
+        if ((rnd_next() & 0x0FU) == 0U)
+        {
+          bits[pin - 1U] ^= (uint64_t)1U << k;
+        }
+      }
+      /* the step counter overflow route is shared by both pins */
+      bits[2U - pin] &= ~((uint64_t)1U << 16);
+      bits[2U - pin] |= bits[pin - 1U] & ((uint64_t)1U << 16);
+      route = route_from_bits(bits[pin - 1U]);
+      known[pin - 1U] = 1U;
+
+      for (p = 0U; (ret == 0) && (p < 2U); p++)
+      {
+        st1vafe6ax_sim_stats_get((p == 0U) ? &sim_ref : &sim_dut, &s0);
+        ret = route_set((p == 0U) ? &ctx_ref : &ctx_dut, pin, route);
+        st1vafe6ax_sim_stats_get((p == 0U) ? &sim_ref : &sim_dut, &s1);
+        cost[p][0] += (s1.rd_count + s1.wr_count) - (s0.rd_count + s0.wr_count);
+        cost[p][1] += s1.bank_switch - s0.bank_switch;
+      }
+    }
+
+    if ((memcmp(sim_ref.main, sim_dut.main, sizeof(sim_ref.main)) != 0) ||
+        (memcmp(sim_ref.emb, sim_dut.emb, sizeof(sim_ref.emb)) != 0) ||
+        (memcmp(sim_ref.page, sim_dut.page, sizeof(sim_ref.page)) != 0))
+    {
+      fail(step, "registers");
+    }
+
+    for (p = 1U; (ret == 0) && (p <= 2U); p++)
+    {
+      ret = route_get(&ctx_ref, p, &get_ref);
+      ret += route_get(&ctx_dut, p, &get_dut);
+      if (memcmp(&get_ref, &get_dut, sizeof(get_ref)) != 0)
+      {
+        fail(step, "route_get");
+      }
+      route = route_from_bits(bits[p - 1U]);
+      if ((known[p - 1U] == 1U) && (route_emb_bits(&get_dut) != route_emb_bits(&route)))
+      {
+        fail(step, "embedded routes");
+      }
+    }
+  }
+
+  printf("%lu updates, %lu mismatches, status %ld\n", (unsigned long)step,
+         (unsigned long)mismatch, (long)ret);
+  printf("route_set bus cost: no private data %lu xfers, %lu bank switches; "
+         "shadow %lu xfers, %lu bank switches\n",
+         (unsigned long)cost[0][0], (unsigned long)cost[0][1],
+         (unsigned long)cost[1][0], (unsigned long)cost[1][1]);
+
+  return ((ret == 0) && (mismatch == 0U)) ? 0 : 1;
+}
@@ -0,0 +1,565 @@
+/**
+  ******************************************************************************
+  * @file    st1vafe6ax_sim.c
+  * @author  Sensors Software Solution Team
+  * @brief   Host side register-map simulator of the ST1VAFE6AX.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#include "st1vafe6ax_sim.h"
+
+#include <string.h>
+
+/** @addtogroup ST1VAFE6AX_SIM
+  * @{
+  *
+  */
+
+/**
+  * @defgroup  Simulator
+  * @{
+  *
+  */
+
+/* I2C at 400 kHz: 9 clocks per byte, device address + register address */
+#define SIM_BYTE_NS_DEFAULT                      22500U
+#define SIM_XFER_NS_DEFAULT                      (2U * SIM_BYTE_NS_DEFAULT)
+
+/* TIMESTAMP0..3 resolution */
+#define SIM_TIMESTAMP_LSB_NS                     21750U
+
+/* Sample period of ODR / BDR codes 0x1 ... 0xB (ns), 0 -> off */
+static const uint32_t sim_period_ns[16] =
+{
+  0U, 533333333U, 133333333U, 66666667U, 33333333U, 16666667U, 8333333U,
+  4166667U, 2083333U, 1041667U, 520833U, 260417U, 0U, 0U, 0U, 0U,
+};
+
+/* Target of st1vafe6ax_sim_mdelay(), that has no handle */
+static st1vafe6ax_sim_t *sim_delay;
+
+/* Power-on / software reset: registers, FIFO and sample generation */
+static void sim_reset(st1vafe6ax_sim_t *sim)
+{
+  (void)memset(sim->main, 0, sizeof(sim->main));
+  (void)memset(sim->emb, 0, sizeof(sim->emb));
+  (void)memset(sim->page, 0, sizeof(sim->page));
+  (void)memset(sim->fifo_word, 0, sizeof(sim->fifo_word));
+  sim->fifo_head = 0U;
+  sim->fifo_count = 0U;
+  sim->fifo_ovr = 0U;
+  sim->next_ns[ST1VAFE6AX_SIM_XL] = 0U;
+  sim->next_ns[ST1VAFE6AX_SIM_GY] = 0U;
+  sim->seq[ST1VAFE6AX_SIM_XL] = 0U;
+  sim->seq[ST1VAFE6AX_SIM_GY] = 0U;
+
+  sim->main[ST1VAFE6AX_WHO_AM_I] = ST1VAFE6AX_ID;
+  /* CTRL3: bdu, if_inc */
+  sim->main[ST1VAFE6AX_CTRL3] = 0x44U;
+  /* EMB_FUNC_EXEC_STATUS: emb_func_endop, no algorithm is running */
+  sim->emb[ST1VAFE6AX_EMB_FUNC_EXEC_STATUS] = 0x01U;
+}
+
+static void sim_fifo_push(st1vafe6ax_sim_t *sim, const uint8_t *word)
+{
+  uint16_t tail;
+
+  if (sim->fifo_count == ST1VAFE6AX_SIM_FIFO_WORDS)
+  {
+    if ((sim->main[ST1VAFE6AX_FIFO_CTRL4] & 0x07U) == (uint8_t)ST1VAFE6AX_FIFO_MODE)
+    {
+      return;
+    }
+
+    /* continuous: the oldest word is overwritten */
+    sim->fifo_head = (sim->fifo_head + 1U) % ST1VAFE6AX_SIM_FIFO_WORDS;
+    sim->fifo_count--;
+    sim->fifo_ovr = 1U;
+  }
+
+  tail = (sim->fifo_head + sim->fifo_count) % ST1VAFE6AX_SIM_FIFO_WORDS;
+  (void)memcpy(sim->fifo[tail], word, 7);
+  sim->fifo_count++;
+}
+
+/* New sample of a sensor: output registers, STATUS_REG and FIFO batching */
+static void sim_sample(st1vafe6ax_sim_t *sim, uint8_t sensor, uint64_t t_ns)
+{
+  uint32_t seq = sim->seq[sensor];
+  uint32_t odr_ns;
+  uint32_t bdr_ns;
+  uint32_t dec;
+  int16_t data[3];
+  uint8_t word[7];
+  uint8_t out;
+  uint8_t i;
+
+  if (sim->sample_cb != NULL)
+  {
+    sim->sample_cb(sim->sample_user, sensor, seq, t_ns, data);
+  }
+  else
+  {
+    for (i = 0U; i < 3U; i++)
+    {
+      data[i] = (int16_t)((seq << 2) + ((uint32_t)sensor << 8) + i);
+    }
+  }
+
+  for (i = 0U; i < 3U; i++)
+  {
+    word[1U + (2U * i)] = (uint8_t)((uint16_t)data[i] & 0xFFU);
+    word[2U + (2U * i)] = (uint8_t)((uint16_t)data[i] >> 8);
+  }
+
+  /* OUTX_L_G ... OUTZ_H_G is X, Y, Z; OUTZ_L_A ... OUTX_H_A is Z, Y, X */
+  for (i = 0U; i < 3U; i++)
+  {
+    out = (sensor == ST1VAFE6AX_SIM_GY) ? i : (2U - i);
+    out = (sensor == ST1VAFE6AX_SIM_GY) ? (ST1VAFE6AX_OUTX_L_G + (2U * out)) :
+          (ST1VAFE6AX_OUTZ_L_A + (2U * out));
+    sim->main[out] = word[1U + (2U * i)];
+    sim->main[out + 1U] = word[2U + (2U * i)];
+  }
+  sim->main[ST1VAFE6AX_STATUS_REG] |= (sensor == ST1VAFE6AX_SIM_GY) ? 0x02U : 0x01U;
+
+  /* batch one sample every BDR period (at most at ODR) */
+  odr_ns = sim_period_ns[sim->main[ST1VAFE6AX_CTRL1 + sensor] & 0x0FU];
+  bdr_ns = sim_period_ns[(sim->main[ST1VAFE6AX_FIFO_CTRL3] >> (4U * sensor)) & 0x0FU];
+
+  if (((sim->main[ST1VAFE6AX_FIFO_CTRL4] & 0x07U) != (uint8_t)ST1VAFE6AX_BYPASS_MODE) &&
+      (bdr_ns != 0U) && (odr_ns != 0U))
+  {
+    dec = (bdr_ns + (odr_ns / 2U)) / odr_ns;
+    dec = (dec == 0U) ? 1U : dec;
+
+    if ((seq % dec) == 0U)
+    {
+      word[0] = (uint8_t)((sensor == ST1VAFE6AX_SIM_GY) ? ST1VAFE6AX_GY_NC_TAG :
+                          ST1VAFE6AX_XL_NC_TAG) << 3;
+      word[0] |= (uint8_t)(((seq / dec) & 0x03U) << 1);
+      sim_fifo_push(sim, word);
+    }
+  }
+
+  sim->seq[sensor]++;
+}
+
+/* Generate, in time order, the samples up to t_ns */
+static void sim_run(st1vafe6ax_sim_t *sim, uint64_t t_ns)
+{
+  uint32_t odr_ns;
+  uint8_t sensor;
+
+  for (;;)
+  {
+    if ((sim->next_ns[ST1VAFE6AX_SIM_XL] != 0U) &&
+        ((sim->next_ns[ST1VAFE6AX_SIM_GY] == 0U) ||
+         (sim->next_ns[ST1VAFE6AX_SIM_XL] <= sim->next_ns[ST1VAFE6AX_SIM_GY])))
+    {
+      sensor = ST1VAFE6AX_SIM_XL;
+    }
+    else
+    {
+      sensor = ST1VAFE6AX_SIM_GY;
+    }
+
+    if ((sim->next_ns[sensor] == 0U) || (sim->next_ns[sensor] > t_ns))
+    {
+      break;
+    }
+
+    sim_sample(sim, sensor, sim->next_ns[sensor]);
+    odr_ns = sim_period_ns[sim->main[ST1VAFE6AX_CTRL1 + sensor] & 0x0FU];
+    sim->next_ns[sensor] += odr_ns;
+  }
+
+  sim->now_ns = t_ns;
+}
+
+static uint8_t sim_emb_selected(const st1vafe6ax_sim_t *sim)
+{
+  return ((sim->main[ST1VAFE6AX_FUNC_CFG_ACCESS] & 0x80U) != 0U) ? 1U : 0U;
+}
+
+static uint8_t sim_read_byte(st1vafe6ax_sim_t *sim, uint8_t reg)
+{
+  uint16_t wtm = sim->main[ST1VAFE6AX_FIFO_CTRL1];
+  uint64_t ts;
+  uint8_t *pg;
+  uint8_t val;
+
+  if ((reg != ST1VAFE6AX_FUNC_CFG_ACCESS) && (sim_emb_selected(sim) == 1U))
+  {
+    if (reg != ST1VAFE6AX_PAGE_VALUE)
+    {
+      return sim->emb[reg];
+    }
+
+    /* PAGE_RW: page_read */
+    pg = sim->page[sim->emb[ST1VAFE6AX_PAGE_SEL] >> 4];
+    val = ((sim->emb[ST1VAFE6AX_PAGE_RW] & 0x20U) != 0U) ?
+          pg[sim->emb[ST1VAFE6AX_PAGE_ADDRESS]] : 0U;
+    sim->emb[ST1VAFE6AX_PAGE_ADDRESS]++;
+
+    return val;
+  }
+
+  switch (reg)
+  {
+    case ST1VAFE6AX_FIFO_STATUS1:
+      val = (uint8_t)(sim->fifo_count & 0xFFU);
+      break;
+
+    case ST1VAFE6AX_FIFO_STATUS2:
+      val = (uint8_t)((sim->fifo_count >> 8) & 0x01U);
+      val |= (sim->fifo_ovr != 0U) ? 0x48U : 0x00U;
+      val |= (sim->fifo_count == ST1VAFE6AX_SIM_FIFO_WORDS) ? 0x20U : 0x00U;
+      val |= ((wtm != 0U) && (sim->fifo_count >= wtm)) ? 0x80U : 0x00U;
+      break;
+
+    case ST1VAFE6AX_TIMESTAMP0:
+    case ST1VAFE6AX_TIMESTAMP0 + 1U:
+    case ST1VAFE6AX_TIMESTAMP0 + 2U:
+    case ST1VAFE6AX_TIMESTAMP0 + 3U:
+      ts = sim->now_ns / SIM_TIMESTAMP_LSB_NS;
+      val = (uint8_t)((ts >> (8U * (reg - ST1VAFE6AX_TIMESTAMP0))) & 0xFFU);
+      break;
+
+    case ST1VAFE6AX_FIFO_DATA_OUT_TAG:
+      /* pop the next word, an empty FIFO reads as zeros */
+      (void)memset(sim->fifo_word, 0, sizeof(sim->fifo_word));
+      if (sim->fifo_count != 0U)
+      {
+        (void)memcpy(sim->fifo_word, sim->fifo[sim->fifo_head], 7);
+        sim->fifo_head = (sim->fifo_head + 1U) % ST1VAFE6AX_SIM_FIFO_WORDS;
+        sim->fifo_count--;
+        sim->fifo_ovr = 0U;
+        sim->stats.fifo_words++;
+      }
+      val = sim->fifo_word[0];
+      break;
+
+    default:
+      if ((reg > ST1VAFE6AX_FIFO_DATA_OUT_TAG) && (reg <= ST1VAFE6AX_FIFO_DATA_OUT_BYTE_5))
+      {
+        val = sim->fifo_word[reg - ST1VAFE6AX_FIFO_DATA_OUT_TAG];
+      }
+      else
+      {
+        val = sim->main[reg];
+      }
+
+      /* data-ready flags are cleared reading the output registers */
+      if ((reg >= ST1VAFE6AX_OUTX_L_G) && (reg <= ST1VAFE6AX_OUTZ_H_G))
+      {
+        sim->main[ST1VAFE6AX_STATUS_REG] &= (uint8_t)~0x02U;
+      }
+      if ((reg >= ST1VAFE6AX_OUTZ_L_A) && (reg <= ST1VAFE6AX_OUTX_H_A))
+      {
+        sim->main[ST1VAFE6AX_STATUS_REG] &= (uint8_t)~0x01U;
+      }
+      break;
+  }
+
+  return val;
+}
+
+static void sim_write_byte(st1vafe6ax_sim_t *sim, uint8_t reg, uint8_t val)
+{
+  uint32_t odr_ns;
+  uint8_t *pg;
+  uint8_t sensor;
+
+  if ((reg != ST1VAFE6AX_FUNC_CFG_ACCESS) && (sim_emb_selected(sim) == 1U))
+  {
+    if (reg != ST1VAFE6AX_PAGE_VALUE)
+    {
+      sim->emb[reg] = val;
+      return;
+    }
+
+    /* PAGE_RW: page_write */
+    pg = sim->page[sim->emb[ST1VAFE6AX_PAGE_SEL] >> 4];
+    if ((sim->emb[ST1VAFE6AX_PAGE_RW] & 0x40U) != 0U)
+    {
+      pg[sim->emb[ST1VAFE6AX_PAGE_ADDRESS]] = val;
+    }
+    sim->emb[ST1VAFE6AX_PAGE_ADDRESS]++;
+
+    return;
+  }
+
+  switch (reg)
+  {
+    case ST1VAFE6AX_FUNC_CFG_ACCESS:
+      if (((sim->main[reg] ^ val) & 0x80U) != 0U)
+      {
+        sim->stats.bank_switch++;
+      }
+      /* sw_por: power-on reset, the bit reads back as 0 */
+      if ((val & 0x04U) != 0U)
+      {
+        sim_reset(sim);
+      }
+      else
+      {
+        sim->main[reg] = val;
+      }
+      break;
+
+    case ST1VAFE6AX_CTRL1:
+    case ST1VAFE6AX_CTRL2:
+      sensor = (reg == ST1VAFE6AX_CTRL1) ? ST1VAFE6AX_SIM_XL : ST1VAFE6AX_SIM_GY;
+      if (((sim->main[reg] ^ val) & 0x0FU) != 0U)
+      {
+        odr_ns = sim_period_ns[val & 0x0FU];
+        sim->next_ns[sensor] = (odr_ns != 0U) ? (sim->now_ns + odr_ns) : 0U;
+      }
+      sim->main[reg] = val;
+      break;
+
+    case ST1VAFE6AX_CTRL3:
+      /* sw_reset and boot are self-clearing */
+      if ((val & 0x01U) != 0U)
+      {
+        sim_reset(sim);
+      }
+      else
+      {
+        sim->main[reg] = val & (uint8_t)~0x80U;
+      }
+      break;
+
+    case ST1VAFE6AX_FIFO_CTRL4:
+      if ((val & 0x07U) == (uint8_t)ST1VAFE6AX_BYPASS_MODE)
+      {
+        sim->fifo_head = 0U;
+        sim->fifo_count = 0U;
+        sim->fifo_ovr = 0U;
+      }
+      sim->main[reg] = val;
+      break;
+
+    default:
+      sim->main[reg] = val;
+      break;
+  }
+}
+
+/* Next register of a multi-byte access: if_inc, FIFO output rounding */
+static uint8_t sim_next_reg(const st1vafe6ax_sim_t *sim, uint8_t reg)
+{
+  if ((sim->main[ST1VAFE6AX_CTRL3] & 0x04U) == 0U)
+  {
+    return reg;
+  }
+
+  if ((reg == ST1VAFE6AX_FIFO_DATA_OUT_BYTE_5) && (sim_emb_selected(sim) == 0U))
+  {
+    return ST1VAFE6AX_FIFO_DATA_OUT_TAG;
+  }
+
+  return (uint8_t)(reg + 1U);
+}
+
+/* Bus time of a transaction, samples generated meanwhile */
+static void sim_xfer_end(st1vafe6ax_sim_t *sim, uint16_t len)
+{
+  uint64_t ns = (uint64_t)sim->xfer_ns + ((uint64_t)len * sim->byte_ns);
+
+  sim->stats.bus_ns += ns;
+  sim_run(sim, sim->now_ns + ns);
+}
+
+/**
+  * @brief  Power-on state, I2C at 400 kHz, statistics cleared.
+  *
+  * @param  sim      simulator
+  *
+  */
+void st1vafe6ax_sim_init(st1vafe6ax_sim_t *sim)
+{
+  (void)memset(sim, 0, sizeof(st1vafe6ax_sim_t));
+  sim->xfer_ns = SIM_XFER_NS_DEFAULT;
+  sim->byte_ns = SIM_BYTE_NS_DEFAULT;
+  sim_reset(sim);
+}
+
+/**
+  * @brief  Set read_reg, write_reg, mdelay and handle of a driver context
+  *         to use the simulator (mdelay acts on the last one set).
+  *
+  * @param  sim      simulator
+  * @param  ctx      driver context
+  *
+  */
+void st1vafe6ax_sim_ctx_init(st1vafe6ax_sim_t *sim, stmdev_ctx_t *ctx)
+{
+  ctx->read_reg = st1vafe6ax_sim_read;
+  ctx->write_reg = st1vafe6ax_sim_write;
+  ctx->mdelay = st1vafe6ax_sim_mdelay;
+  ctx->handle = sim;
+  sim_delay = sim;
+}
+
+/**
+  * @brief  Bus timing: each transaction takes xfer_ns + len * byte_ns.
+  *
+  * @param  sim      simulator
+  * @param  xfer_ns  fixed cost of a transaction (addressing)
+  * @param  byte_ns  cost of each data byte
+  *
+  */
+void st1vafe6ax_sim_bus_set(st1vafe6ax_sim_t *sim, uint32_t xfer_ns,
+                            uint32_t byte_ns)
+{
+  sim->xfer_ns = xfer_ns;
+  sim->byte_ns = byte_ns;
+}
+
+/**
+  * @brief  Sample generator, NULL -> default pattern
+  *         (x, y, z) = 4 * seq + 256 * sensor + (0, 1, 2).
+  *
+  * @param  sim      simulator
+  * @param  cb       generator
+  * @param  user     passed back to the generator
+  *
+  */
+void st1vafe6ax_sim_sample_cb_set(st1vafe6ax_sim_t *sim,
+                                  st1vafe6ax_sim_sample_cb_t cb, void *user)
+{
+  sim->sample_cb = cb;
+  sim->sample_user = user;
+}
+
+/**
+  * @brief  Let time pass without bus activity.
+  *
+  * @param  sim      simulator
+  * @param  ns       elapsed time
+  *
+  */
+void st1vafe6ax_sim_advance(st1vafe6ax_sim_t *sim, uint64_t ns)
+{
+  sim_run(sim, sim->now_ns + ns);
+}
+
+/**
+  * @brief  Transactions, bytes, bank switches, FIFO words read and bus
+  *         time since init or last reset.
+  *
+  * @param  sim      simulator
+  * @param  val      statistics
+  *
+  */
+void st1vafe6ax_sim_stats_get(const st1vafe6ax_sim_t *sim,
+                              st1vafe6ax_sim_stats_t *val)
+{
+  *val = sim->stats;
+}
+
+/**
+  * @brief  Clear the statistics.
+  *
+  * @param  sim      simulator
+  *
+  */
+void st1vafe6ax_sim_stats_reset(st1vafe6ax_sim_t *sim)
+{
+  (void)memset(&sim->stats, 0, sizeof(st1vafe6ax_sim_stats_t));
+}
+
+/**
+  * @brief  stmdev_read_ptr backend.
+  *
+  * @param  handle   simulator
+  * @param  reg      first register
+  * @param  buf      read data
+  * @param  len      number of bytes
+  * @retval          0
+  *
+  */
+int32_t st1vafe6ax_sim_read(void *handle, uint8_t reg, uint8_t *buf,
+                            uint16_t len)
+{
+  st1vafe6ax_sim_t *sim = (st1vafe6ax_sim_t *)handle;
+  uint16_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    buf[i] = sim_read_byte(sim, reg);
+    reg = sim_next_reg(sim, reg);
+  }
+
+  sim->stats.rd_count++;
+  sim->stats.rd_bytes += len;
+  sim_xfer_end(sim, len);
+
+  return 0;
+}
+
+/**
+  * @brief  stmdev_write_ptr backend.
+  *
+  * @param  handle   simulator
+  * @param  reg      first register
+  * @param  buf      data to write
+  * @param  len      number of bytes
+  * @retval          0
+  *
+  */
+int32_t st1vafe6ax_sim_write(void *handle, uint8_t reg, const uint8_t *buf,
+                             uint16_t len)
+{
+  st1vafe6ax_sim_t *sim = (st1vafe6ax_sim_t *)handle;
+  uint16_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    sim_write_byte(sim, reg, buf[i]);
+    reg = sim_next_reg(sim, reg);
+  }
+
+  sim->stats.wr_count++;
+  sim->stats.wr_bytes += len;
+  sim_xfer_end(sim, len);
+
+  return 0;
+}
+
+/**
+  * @brief  stmdev_mdelay_ptr backend, advances the time of the simulator
+  *         last set with st1vafe6ax_sim_ctx_init().
+  *
+  * @param  millisec delay
+  *
+  */
+void st1vafe6ax_sim_mdelay(uint32_t millisec)
+{
+  if (sim_delay != NULL)
+  {
+    st1vafe6ax_sim_advance(sim_delay, (uint64_t)millisec * 1000000U);
+  }
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
@@ -0,0 +1,135 @@
+/**
+  ******************************************************************************
+  * @file    st1vafe6ax_sim.h
+  * @author  Sensors Software Solution Team
+  * @brief   Host side register-map simulator of the ST1VAFE6AX, usable as
+  *          read_reg / write_reg backend of the st1vafe6ax_reg.c driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef ST1VAFE6AX_SIM_H
+#define ST1VAFE6AX_SIM_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "st1vafe6ax_reg.h"
+
+/** @addtogroup ST1VAFE6AX_SIM
+  * @{
+  *
+  */
+
+/**
+  * @defgroup  Simulator
+  * @brief     Model of the main bank, of the embedded functions bank
+  *            (FUNC_CFG_ACCESS), of the advanced pages (PAGE_SEL,
+  *            PAGE_ADDRESS, PAGE_VALUE) and of the FIFO.
+  *
+  *            Device time only advances with the bus: each transaction
+  *            takes xfer_ns + len * byte_ns (I2C at 400 kHz by default) and
+  *            mdelay() adds the requested delay. Accelerometer and gyroscope
+  *            samples are generated at the ODR set in CTRL1 / CTRL2,
+  *            updating the output registers and STATUS_REG, and batched in
+  *            the FIFO at the BDR set in FIFO_CTRL3. FIFO modes other than
+  *            bypass and FIFO are handled as continuous mode; compression,
+  *            timestamp / temperature batching and the embedded functions
+  *            algorithms are not modelled (their registers are plain memory,
+  *            EMB_FUNC_EXEC_STATUS reports the end of operation).
+  *            CTRL3.sw_reset and FUNC_CFG_ACCESS.sw_por reset the device
+  *            at once.
+  *
+  *            st1vafe6ax_sim_mdelay() has no handle and advances the
+  *            simulator of the last st1vafe6ax_sim_ctx_init() call (file
+  *            static): only one simulated device can be used per process.
+  * @{
+  *
+  */
+
+#define ST1VAFE6AX_SIM_PAGES                     16U
+#define ST1VAFE6AX_SIM_FIFO_WORDS                511U
+
+#define ST1VAFE6AX_SIM_XL                        0U
+#define ST1VAFE6AX_SIM_GY                        1U
+
+/* Fill data (x, y, z) of sample number seq of a sensor taken at t_ns */
+typedef void (*st1vafe6ax_sim_sample_cb_t)(void *user, uint8_t sensor,
+                                           uint32_t seq, uint64_t t_ns,
+                                           int16_t *data);
+
+typedef struct
+{
+  uint32_t rd_count;
+  uint32_t wr_count;
+  uint32_t rd_bytes;
+  uint32_t wr_bytes;
+  uint32_t bank_switch;
+  uint32_t fifo_words;
+  uint64_t bus_ns;
+} st1vafe6ax_sim_stats_t;
+
+typedef struct
+{
+  uint8_t main[256];
+  uint8_t emb[256];
+  uint8_t page[ST1VAFE6AX_SIM_PAGES][256];
+  uint8_t fifo[ST1VAFE6AX_SIM_FIFO_WORDS][7];
+  uint8_t fifo_word[7];
+  uint16_t fifo_head;
+  uint16_t fifo_count;
+  uint8_t fifo_ovr;
+  uint64_t now_ns;
+  uint64_t next_ns[2];
+  uint32_t seq[2];
+  st1vafe6ax_sim_sample_cb_t sample_cb;
+  void *sample_user;
+  uint32_t xfer_ns;
+  uint32_t byte_ns;
+  st1vafe6ax_sim_stats_t stats;
+} st1vafe6ax_sim_t;
+
+void st1vafe6ax_sim_init(st1vafe6ax_sim_t *sim);
+void st1vafe6ax_sim_ctx_init(st1vafe6ax_sim_t *sim, stmdev_ctx_t *ctx);
+void st1vafe6ax_sim_bus_set(st1vafe6ax_sim_t *sim, uint32_t xfer_ns,
+                            uint32_t byte_ns);
+void st1vafe6ax_sim_sample_cb_set(st1vafe6ax_sim_t *sim,
+                                  st1vafe6ax_sim_sample_cb_t cb, void *user);
+void st1vafe6ax_sim_advance(st1vafe6ax_sim_t *sim, uint64_t ns);
+void st1vafe6ax_sim_stats_get(const st1vafe6ax_sim_t *sim,
+                              st1vafe6ax_sim_stats_t *val);
+void st1vafe6ax_sim_stats_reset(st1vafe6ax_sim_t *sim);
+
+int32_t st1vafe6ax_sim_read(void *handle, uint8_t reg, uint8_t *buf,
+                            uint16_t len);
+int32_t st1vafe6ax_sim_write(void *handle, uint8_t reg, const uint8_t *buf,
+                             uint16_t len);
+void st1vafe6ax_sim_mdelay(uint32_t millisec);
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ST1VAFE6AX_SIM_H */
@@ -0,0 +1,513 @@
+/**
+  ******************************************************************************
+  * @file    st1vafe6ax_trace.c
+  * @author  Sensors Software Solution Team
+  * @brief   Bus transaction tracer and trace replayer for the
+  *          st1vafe6ax_reg.c driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+#define _POSIX_C_SOURCE 200112L
+
+#include "st1vafe6ax_trace.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+/** @addtogroup ST1VAFE6AX_TRACE
+  * @{
+  *
+  */
+
+/**
+  * @defgroup  Tracer
+  * @{
+  *
+  */
+
+/* Scratch buffer of the replayed reads */
+static uint8_t replay_buf[0x10000];
+
+static void trace_put_le(uint8_t *buf, uint64_t val, uint8_t len)
+{
+  uint8_t i;
+
+  for (i = 0U; i < len; i++)
+  {
+    buf[i] = (uint8_t)((val >> (8U * i)) & 0xFFU);
+  }
+}
+
+static uint64_t trace_get_le(const uint8_t *buf, uint8_t len)
+{
+  uint64_t val = 0U;
+  uint8_t i;
+
+  for (i = len; i > 0U; i--)
+  {
+    val = (val << 8) | buf[i - 1U];
+  }
+
+  return val;
+}
+
+/* Ring: copy in / out at offset off from the oldest byte */
+static void trace_ring_put(st1vafe6ax_trace_t *tr, const uint8_t *src, uint32_t len)
+{
+  uint32_t pos = (tr->first + tr->used) % tr->size;
+  uint32_t n = ((tr->size - pos) < len) ? (tr->size - pos) : len;
+
+  (void)memcpy(&tr->buf[pos], src, n);
+  (void)memcpy(&tr->buf[0], &src[n], len - n);
+  tr->used += len;
+}
+
+static void trace_ring_get(const st1vafe6ax_trace_t *tr, uint32_t off, uint8_t *dst,
+                           uint32_t len)
+{
+  uint32_t pos = (tr->first + off) % tr->size;
+  uint32_t n = ((tr->size - pos) < len) ? (tr->size - pos) : len;
+
+  (void)memcpy(dst, &tr->buf[pos], n);
+  (void)memcpy(&dst[n], &tr->buf[0], len - n);
+}
+
+static void trace_record(st1vafe6ax_trace_t *tr, uint8_t flags, uint8_t reg,
+                         const uint8_t *data, uint16_t len, uint64_t t_ns,
+                         uint64_t end_ns)
+{
+  uint8_t hdr[ST1VAFE6AX_TRACE_REC_HDR];
+  uint32_t need = ST1VAFE6AX_TRACE_REC_HDR + (uint32_t)len;
+  uint32_t old;
+
+  if (need > tr->size)
+  {
+    tr->dropped++;
+    return;
+  }
+
+  /* make room dropping the oldest records */
+  while ((tr->size - tr->used) < need)
+  {
+    trace_ring_get(tr, 0U, hdr, ST1VAFE6AX_TRACE_REC_HDR);
+    old = ST1VAFE6AX_TRACE_REC_HDR + (uint32_t)trace_get_le(&hdr[2], 2);
+    tr->first = (tr->first + old) % tr->size;
+    tr->used -= old;
+    tr->records--;
+    tr->dropped++;
+  }
+
+  hdr[0] = flags;
+  hdr[1] = reg;
+  trace_put_le(&hdr[2], len, 2);
+  trace_put_le(&hdr[4], end_ns - t_ns, 4);
+  trace_put_le(&hdr[8], t_ns, 8);
+
+  trace_ring_put(tr, hdr, ST1VAFE6AX_TRACE_REC_HDR);
+  trace_ring_put(tr, data, len);
+  tr->records++;
+}
+
+static uint64_t trace_now(const st1vafe6ax_trace_t *tr)
+{
+  return (tr->clock != NULL) ? tr->clock(tr->clock_user) : 0U;
+}
+
+static int32_t trace_file_sink(void *user, const uint8_t *buf, uint32_t len)
+{
+  return (fwrite(buf, 1, len, (FILE *)user) == len) ? 0 : -1;
+}
+
+/**
+  * @brief  Initialize a tracer.
+  *
+  * @param  tr          tracer
+  * @param  buf         ring buffer storage
+  * @param  size        ring buffer size (bytes)
+  * @param  clock       monotonic time source, NULL -> timestamps are 0
+  * @param  clock_user  passed back to clock
+  *
+  */
+void st1vafe6ax_trace_init(st1vafe6ax_trace_t *tr, uint8_t *buf, uint32_t size,
+                           st1vafe6ax_trace_clock_t clock, void *clock_user)
+{
+  (void)memset(tr, 0, sizeof(st1vafe6ax_trace_t));
+  tr->buf = buf;
+  tr->size = size;
+  tr->clock = clock;
+  tr->clock_user = clock_user;
+}
+
+/**
+  * @brief  Trace the transactions of a driver context: its read_reg,
+  *         write_reg and handle are saved and replaced by the tracer ones.
+  *         The main bank must be selected.
+  *
+  * @param  tr       tracer
+  * @param  ctx      driver context
+  *
+  */
+void st1vafe6ax_trace_attach(st1vafe6ax_trace_t *tr, stmdev_ctx_t *ctx)
+{
+  tr->write_reg = ctx->write_reg;
+  tr->read_reg = ctx->read_reg;
+  tr->handle = ctx->handle;
+  tr->bank = 0U;
+
+  ctx->write_reg = st1vafe6ax_trace_write;
+  ctx->read_reg = st1vafe6ax_trace_read;
+  ctx->handle = tr;
+}
+
+/**
+  * @brief  Restore the callbacks of a context set with
+  *         st1vafe6ax_trace_attach().
+  *
+  * @param  tr       tracer
+  * @param  ctx      driver context
+  *
+  */
+void st1vafe6ax_trace_detach(const st1vafe6ax_trace_t *tr, stmdev_ctx_t *ctx)
+{
+  ctx->write_reg = tr->write_reg;
+  ctx->read_reg = tr->read_reg;
+  ctx->handle = tr->handle;
+}
+
+/**
+  * @brief  Output the records, oldest first, and empty the ring.
+  *
+  * @param  tr       tracer
+  * @param  sink     output
+  * @param  user     passed back to sink
+  * @retval          sink status (MANDATORY: return 0 -> no Error)
+  *
+  */
+int32_t st1vafe6ax_trace_flush(st1vafe6ax_trace_t *tr,
+                               st1vafe6ax_trace_sink_t sink, void *user)
+{
+  uint32_t n = ((tr->size - tr->first) < tr->used) ? (tr->size - tr->first) : tr->used;
+  int32_t ret = 0;
+
+  if (n != 0U)
+  {
+    ret = sink(user, &tr->buf[tr->first], n);
+  }
+  if ((ret == 0) && (tr->used > n))
+  {
+    ret = sink(user, &tr->buf[0], tr->used - n);
+  }
+
+  if (ret == 0)
+  {
+    tr->first = 0U;
+    tr->used = 0U;
+    tr->records = 0U;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Append the records to a trace file (created if needed) and
+  *         empty the ring.
+  *
+  * @param  tr       tracer
+  * @param  path     trace file
+  * @retval          0 -> ok, -1 -> file error
+  *
+  */
+int32_t st1vafe6ax_trace_flush_file(st1vafe6ax_trace_t *tr, const char *path)
+{
+  FILE *f = fopen(path, "ab");
+  int32_t ret = 0;
+
+  if (f == NULL)
+  {
+    return -1;
+  }
+
+  if (ftell(f) == 0L)
+  {
+    ret = trace_file_sink(f, (const uint8_t *)ST1VAFE6AX_TRACE_MAGIC, 4U);
+  }
+  if (ret == 0)
+  {
+    ret = st1vafe6ax_trace_flush(tr, trace_file_sink, f);
+  }
+
+  ret += (fclose(f) == 0) ? 0 : -1;
+
+  return ret;
+}
+
+/**
+  * @brief  stmdev_read_ptr of a traced context.
+  *
+  * @param  handle   tracer
+  * @param  reg      first register
+  * @param  buf      read data
+  * @param  len      number of bytes
+  * @retval          status of the wrapped read_reg
+  *
+  */
+int32_t st1vafe6ax_trace_read(void *handle, uint8_t reg, uint8_t *buf,
+                              uint16_t len)
+{
+  st1vafe6ax_trace_t *tr = (st1vafe6ax_trace_t *)handle;
+  uint64_t t_ns = trace_now(tr);
+  uint8_t flags;
+  int32_t ret;
+
+  ret = tr->read_reg(tr->handle, reg, buf, len);
+
+  flags = (tr->bank != 0U) ? ST1VAFE6AX_TRACE_EMB : 0U;
+  flags |= (ret != 0) ? ST1VAFE6AX_TRACE_ERR : 0U;
+  trace_record(tr, flags, reg, buf, len, t_ns, trace_now(tr));
+
+  return ret;
+}
+
+/**
+  * @brief  stmdev_write_ptr of a traced context.
+  *
+  * @param  handle   tracer
+  * @param  reg      first register
+  * @param  buf      data to write
+  * @param  len      number of bytes
+  * @retval          status of the wrapped write_reg
+  *
+  */
+int32_t st1vafe6ax_trace_write(void *handle, uint8_t reg, const uint8_t *buf,
+                               uint16_t len)
+{
+  st1vafe6ax_trace_t *tr = (st1vafe6ax_trace_t *)handle;
+  uint64_t t_ns = trace_now(tr);
+  uint8_t flags;
+  int32_t ret;
+
+  ret = tr->write_reg(tr->handle, reg, buf, len);
+
+  flags = ST1VAFE6AX_TRACE_WRITE;
+  flags |= (tr->bank != 0U) ? ST1VAFE6AX_TRACE_EMB : 0U;
+  flags |= (ret != 0) ? ST1VAFE6AX_TRACE_ERR : 0U;
+  trace_record(tr, flags, reg, buf, len, t_ns, trace_now(tr));
+
+  /* FUNC_CFG_ACCESS: emb_func_reg_access */
+  if ((ret == 0) && (reg <= ST1VAFE6AX_FUNC_CFG_ACCESS) &&
+      (((uint16_t)reg + len) > ST1VAFE6AX_FUNC_CFG_ACCESS))
+  {
+    tr->bank = buf[ST1VAFE6AX_FUNC_CFG_ACCESS - reg] >> 7;
+  }
+
+  return ret;
+}
+
+/**
+  * @brief  Decode the record at *pos of a records buffer (trace file
+  *         content after the magic) and move *pos to the next one.
+  *
+  * @param  buf      records
+  * @param  len      records buffer size
+  * @param  pos      offset of the record, updated
+  * @param  rec      decoded record, data points into buf
+  * @retval          1 -> record decoded, 0 -> end of buffer or truncated record
+  *
+  */
+uint8_t st1vafe6ax_trace_next(const uint8_t *buf, uint32_t len, uint32_t *pos,
+                              st1vafe6ax_trace_rec_t *rec)
+{
+  const uint8_t *hdr = &buf[*pos];
+
+  if ((len < ST1VAFE6AX_TRACE_REC_HDR) || (*pos > (len - ST1VAFE6AX_TRACE_REC_HDR)))
+  {
+    return 0U;
+  }
+
+  rec->flags = hdr[0];
+  rec->reg = hdr[1];
+  rec->len = (uint16_t)trace_get_le(&hdr[2], 2);
+  rec->dur_ns = (uint32_t)trace_get_le(&hdr[4], 4);
+  rec->t_ns = trace_get_le(&hdr[8], 8);
+  rec->data = &hdr[ST1VAFE6AX_TRACE_REC_HDR];
+
+  if ((len - *pos - ST1VAFE6AX_TRACE_REC_HDR) < rec->len)
+  {
+    return 0U;
+  }
+
+  *pos += ST1VAFE6AX_TRACE_REC_HDR + (uint32_t)rec->len;
+
+  return 1U;
+}
+
+/**
+  * @brief  Load the records of a trace file.
+  *
+  * @param  path     trace file
+  * @param  buf      records, to be released with free()
+  * @param  len      records size
+  * @retval          0 -> ok, -1 -> file error or not a trace file
+  *
+  */
+int32_t st1vafe6ax_trace_load_file(const char *path, uint8_t **buf,
+                                   uint32_t *len)
+{
+  uint8_t magic[4];
+  FILE *f = fopen(path, "rb");
+  long size;
+  int32_t ret = 0;
+
+  *buf = NULL;
+  *len = 0U;
+
+  if (f == NULL)
+  {
+    return -1;
+  }
+
+  ret = (fseek(f, 0L, SEEK_END) == 0) ? 0 : -1;
+  size = ftell(f);
+  ret += (fseek(f, 0L, SEEK_SET) == 0) ? 0 : -1;
+
+  if ((ret == 0) && ((size < 4L) || (fread(magic, 1, 4, f) != 4U) ||
+                     (memcmp(magic, ST1VAFE6AX_TRACE_MAGIC, 4) != 0)))
+  {
+    ret = -1;
+  }
+
+  if (ret == 0)
+  {
+    *len = (uint32_t)size - 4U;
+    *buf = (uint8_t *)malloc((*len != 0U) ? *len : 1U);
+    if ((*buf == NULL) || (fread(*buf, 1, *len, f) != *len))
+    {
+      free(*buf);
+      *buf = NULL;
+      *len = 0U;
+      ret = -1;
+    }
+  }
+
+  (void)fclose(f);
+
+  return ret;
+}
+
+/**
+  * @brief  Replay the records against a context: writes are issued with
+  *         the recorded payload, reads are issued and optionally compared
+  *         with the recorded data.
+  *
+  * @param  buf         records (see st1vafe6ax_trace_load_file())
+  * @param  len         records size
+  * @param  ctx         context replayed against
+  * @param  flags       ST1VAFE6AX_TRACE_REPLAY_TIMING: keep the recorded
+  *                     time between the transactions (busy wait on clock),
+  *                     ST1VAFE6AX_TRACE_REPLAY_VERIFY: count the reads
+  *                     returning different data
+  * @param  clock       monotonic time source, NULL -> no timing
+  * @param  clock_user  passed back to clock
+  * @param  stats       replay statistics
+  * @retval             0 -> ok, -1 -> truncated records
+  *
+  */
+int32_t st1vafe6ax_trace_replay(const uint8_t *buf, uint32_t len,
+                                const stmdev_ctx_t *ctx, uint8_t flags,
+                                st1vafe6ax_trace_clock_t clock, void *clock_user,
+                                st1vafe6ax_trace_replay_stats_t *stats)
+{
+  st1vafe6ax_trace_rec_t rec;
+  uint64_t rec_t0 = 0U;
+  uint64_t t0 = 0U;
+  uint32_t pos = 0U;
+  int32_t ret;
+
+  (void)memset(stats, 0, sizeof(st1vafe6ax_trace_replay_stats_t));
+
+  if (clock != NULL)
+  {
+    t0 = clock(clock_user);
+  }
+
+  while (st1vafe6ax_trace_next(buf, len, &pos, &rec) == 1U)
+  {
+    if (stats->records == 0U)
+    {
+      rec_t0 = rec.t_ns;
+    }
+
+    if (((flags & ST1VAFE6AX_TRACE_REPLAY_TIMING) != 0U) && (clock != NULL))
+    {
+      while ((clock(clock_user) - t0) < (rec.t_ns - rec_t0)) {}
+    }
+
+    if ((rec.flags & ST1VAFE6AX_TRACE_WRITE) != 0U)
+    {
+      ret = ctx->write_reg(ctx->handle, rec.reg, rec.data, rec.len);
+      stats->writes++;
+    }
+    else
+    {
+      ret = ctx->read_reg(ctx->handle, rec.reg, replay_buf, rec.len);
+      stats->reads++;
+
+      if (((flags & ST1VAFE6AX_TRACE_REPLAY_VERIFY) != 0U) && (ret == 0) &&
+          ((rec.flags & ST1VAFE6AX_TRACE_ERR) == 0U) &&
+          (memcmp(replay_buf, rec.data, rec.len) != 0))
+      {
+        stats->mismatch++;
+      }
+    }
+
+    stats->errors += (ret != 0) ? 1U : 0U;
+    stats->records++;
+  }
+
+  if (clock != NULL)
+  {
+    stats->elapsed_ns = clock(clock_user) - t0;
+  }
+
+  return (pos == len) ? 0 : -1;
+}
+
+/**
+  * @brief  Host monotonic clock (CLOCK_MONOTONIC), usable as clock of the
+  *         tracer and of the replayer.
+  *
+  * @param  user     not used
+  * @retval          time in ns
+  *
+  */
+uint64_t st1vafe6ax_trace_clock_monotonic(void *user)
+{
+  struct timespec ts;
+
+  (void)user;
+  (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+  return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
@@ -0,0 +1,144 @@
+/**
+  ******************************************************************************
+  * @file    st1vafe6ax_trace.h
+  * @author  Sensors Software Solution Team
+  * @brief   Bus transaction tracer and trace replayer for the
+  *          st1vafe6ax_reg.c driver.
+  ******************************************************************************
+  * @attention
+  *
+  * Copyright (c) 2024 STMicroelectronics.
+  * All rights reserved.
+  *
+  * This software is licensed under terms that can be found in the LICENSE file
+  * in the root directory of this software component.
+  * If no LICENSE file comes with this software, it is provided AS-IS.
+  *
+  ******************************************************************************
+  */
+
+/* Define to prevent recursive inclusion -------------------------------------*/
+#ifndef ST1VAFE6AX_TRACE_H
+#define ST1VAFE6AX_TRACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Includes ------------------------------------------------------------------*/
+#include "st1vafe6ax_reg.h"
+
+/** @addtogroup ST1VAFE6AX_TRACE
+  * @{
+  *
+  */
+
+/**
+  * @defgroup  Tracer
+  * @brief     The tracer wraps read_reg / write_reg of a driver context and
+  *            stores each transaction in a ring buffer provided by the
+  *            application (the oldest records are dropped when full).
+  *
+  *            Record (little endian), followed by len bytes of payload:
+  *              flags (1) | reg (1) | len (2) | dur_ns (4) | t_ns (8)
+  *            A trace file is the 4 bytes ST1VAFE6AX_TRACE_MAGIC followed
+  *            by the records.
+  * @{
+  *
+  */
+
+#define ST1VAFE6AX_TRACE_MAGIC                   "S6T1"
+#define ST1VAFE6AX_TRACE_REC_HDR                 16U
+
+/* record flags */
+#define ST1VAFE6AX_TRACE_WRITE                   0x01U
+#define ST1VAFE6AX_TRACE_EMB                     0x02U
+#define ST1VAFE6AX_TRACE_ERR                     0x04U
+
+/* replay flags */
+#define ST1VAFE6AX_TRACE_REPLAY_TIMING           0x01U
+#define ST1VAFE6AX_TRACE_REPLAY_VERIFY           0x02U
+
+/* Monotonic time in ns */
+typedef uint64_t (*st1vafe6ax_trace_clock_t)(void *user);
+
+/* Output of st1vafe6ax_trace_flush(), MANDATORY: return 0 -> no Error */
+typedef int32_t (*st1vafe6ax_trace_sink_t)(void *user, const uint8_t *buf,
+                                           uint32_t len);
+
+typedef struct
+{
+  uint8_t flags;
+  uint8_t reg;
+  uint16_t len;
+  uint32_t dur_ns;
+  uint64_t t_ns;
+  const uint8_t *data;
+} st1vafe6ax_trace_rec_t;
+
+typedef struct
+{
+  uint8_t *buf;
+  uint32_t size;
+  uint32_t first;
+  uint32_t used;
+  uint32_t records;
+  uint32_t dropped;
+  uint8_t bank;
+  st1vafe6ax_trace_clock_t clock;
+  void *clock_user;
+  /* wrapped context callbacks */
+  stmdev_write_ptr write_reg;
+  stmdev_read_ptr read_reg;
+  void *handle;
+} st1vafe6ax_trace_t;
+
+typedef struct
+{
+  uint32_t records;
+  uint32_t reads;
+  uint32_t writes;
+  uint32_t mismatch;
+  uint32_t errors;
+  uint64_t elapsed_ns;
+} st1vafe6ax_trace_replay_stats_t;
+
+void st1vafe6ax_trace_init(st1vafe6ax_trace_t *tr, uint8_t *buf, uint32_t size,
+                           st1vafe6ax_trace_clock_t clock, void *clock_user);
+void st1vafe6ax_trace_attach(st1vafe6ax_trace_t *tr, stmdev_ctx_t *ctx);
+void st1vafe6ax_trace_detach(const st1vafe6ax_trace_t *tr, stmdev_ctx_t *ctx);
+int32_t st1vafe6ax_trace_flush(st1vafe6ax_trace_t *tr,
+                               st1vafe6ax_trace_sink_t sink, void *user);
+int32_t st1vafe6ax_trace_flush_file(st1vafe6ax_trace_t *tr, const char *path);
+
+int32_t st1vafe6ax_trace_read(void *handle, uint8_t reg, uint8_t *buf,
+                              uint16_t len);
+int32_t st1vafe6ax_trace_write(void *handle, uint8_t reg, const uint8_t *buf,
+                               uint16_t len);
+
+uint8_t st1vafe6ax_trace_next(const uint8_t *buf, uint32_t len, uint32_t *pos,
+                              st1vafe6ax_trace_rec_t *rec);
+int32_t st1vafe6ax_trace_load_file(const char *path, uint8_t **buf,
+                                   uint32_t *len);
+int32_t st1vafe6ax_trace_replay(const uint8_t *buf, uint32_t len,
+                                const stmdev_ctx_t *ctx, uint8_t flags,
+                                st1vafe6ax_trace_clock_t clock, void *clock_user,
+                                st1vafe6ax_trace_replay_stats_t *stats);
+
+uint64_t st1vafe6ax_trace_clock_monotonic(void *user);
+
+/**
+  * @}
+  *
+  */
+
+/**
+  * @}
+  *
+  */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ST1VAFE6AX_TRACE_H */